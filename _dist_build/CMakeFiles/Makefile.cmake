@@ -0,0 +1,414 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/fmt/fmt-config-version.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-config.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-targets-release.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-targets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/GaloisConfig.cmake.in"
+  "/root/repo/cmake/Modules/CheckArchFlags.cmake"
+  "/root/repo/cmake/Modules/CheckEndian.cmake"
+  "/root/repo/cmake/Modules/CheckHugePages.cmake"
+  "/root/repo/cmake/Modules/CheckMmap.cmake"
+  "/root/repo/cmake/Modules/CheckSchedSetAffinity.cmake"
+  "/root/repo/cmake/Modules/FindNUMA.cmake"
+  "/root/repo/cmake/Modules/HandleSanitizer.cmake"
+  "/root/repo/inputs/CMakeLists.txt"
+  "/root/repo/libcusp/CMakeLists.txt"
+  "/root/repo/libdist/CMakeLists.txt"
+  "/root/repo/libgalois/CMakeLists.txt"
+  "/root/repo/libgalois/include/galois/config.h.in"
+  "/root/repo/libgalois/src/Version.cpp.in"
+  "/root/repo/libgalois/test/CMakeLists.txt"
+  "/root/repo/libgluon/CMakeLists.txt"
+  "/root/repo/libpangolin/CMakeLists.txt"
+  "/root/repo/libpygalois/CMakeLists.txt"
+  "/root/repo/libsupport/CMakeLists.txt"
+  "/root/repo/libsupport/test/CMakeLists.txt"
+  "/root/repo/lonestar/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/bfs/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/bipart/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/clustering/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/coloring/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/connected-components/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/gmetis/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/independentset/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/k-core/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/k-truss/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/matching/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/matrixcompletion/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/pagerank/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/pointstoanalysis/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/preflowpush/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/spanningtree/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/betweennesscentrality/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/connected-components/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/k-core/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/pagerank/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/partition/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/sssp/CMakeLists.txt"
+  "/root/repo/lonestar/analytics/distributed/triangle-counting/CMakeLists.txt"
+  "/root/repo/lonestar/eda/CMakeLists.txt"
+  "/root/repo/lonestar/eda/cpu/CMakeLists.txt"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/CMakeLists.txt"
+  "/root/repo/lonestar/eda/cpu/sproute/CMakeLists.txt"
+  "/root/repo/lonestar/libdistbench/CMakeLists.txt"
+  "/root/repo/lonestar/liblonestar/CMakeLists.txt"
+  "/root/repo/lonestar/mining/CMakeLists.txt"
+  "/root/repo/lonestar/mining/cpu/CMakeLists.txt"
+  "/root/repo/lonestar/mining/cpu/frequent-subgraph-mining/CMakeLists.txt"
+  "/root/repo/lonestar/mining/cpu/k-clique-listing/CMakeLists.txt"
+  "/root/repo/lonestar/mining/cpu/motif-counting/CMakeLists.txt"
+  "/root/repo/lonestar/mining/cpu/triangle-counting/CMakeLists.txt"
+  "/root/repo/lonestar/mining/libminingbench/CMakeLists.txt"
+  "/root/repo/lonestar/scientific/CMakeLists.txt"
+  "/root/repo/lonestar/scientific/cpu/CMakeLists.txt"
+  "/root/repo/lonestar/scientific/cpu/barneshut/CMakeLists.txt"
+  "/root/repo/lonestar/scientific/cpu/delaunayrefinement/CMakeLists.txt"
+  "/root/repo/lonestar/scientific/cpu/delaunaytriangulation/CMakeLists.txt"
+  "/root/repo/lonestar/scientific/cpu/longestedge/CMakeLists.txt"
+  "/root/repo/lonestar/tutorial_examples/CMakeLists.txt"
+  "/root/repo/scripts/CMakeLists.txt"
+  "/root/repo/scripts/make_dist.sh.in"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/dist-graph-convert/CMakeLists.txt"
+  "/root/repo/tools/graph-convert/CMakeLists.txt"
+  "/root/repo/tools/graph-remap/CMakeLists.txt"
+  "/root/repo/tools/graph-stats/CMakeLists.txt"
+  "/usr/lib/llvm-14/cmake/FindFFI.cmake"
+  "/usr/lib/llvm-14/cmake/FindTerminfo.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMConfig.cmake"
+  "/usr/lib/llvm-14/cmake/LLVMConfigVersion.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVM-Config.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVMExports-release.cmake"
+  "/usr/lib/llvm-14/lib/cmake/llvm/LLVMExports.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/boost_iostreams-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/boost_iostreams-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/libboost_iostreams-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/libboost_iostreams-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/boost_serialization-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/boost_serialization-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/libboost_serialization-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/libboost_serialization-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  "/usr/share/eigen3/cmake/Eigen3Config.cmake"
+  "/usr/share/eigen3/cmake/Eigen3ConfigVersion.cmake"
+  "/usr/share/eigen3/cmake/Eigen3Targets.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "GaloisConfigVersion.cmake"
+  "GaloisConfig.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libsupport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libsupport/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libgalois/Version.cpp"
+  "libgalois/include/galois/config.h"
+  "libgalois/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libgalois/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libpygalois/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libdist/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libcusp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libgluon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "libpangolin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/libdistbench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/liblonestar/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/betweennesscentrality/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/bfs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/bipart/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/spanningtree/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/clustering/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/coloring/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/connected-components/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/gmetis/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/independentset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/k-core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/k-truss/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/matching/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/matrixcompletion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/pagerank/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/pointstoanalysis/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/preflowpush/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/sssp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/cpu/triangle-counting/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/betweennesscentrality/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/bfs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/connected-components/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/k-core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/pagerank/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/partition/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/matrixcompletion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/sssp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/analytics/distributed/triangle-counting/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/eda/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/eda/cpu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/eda/cpu/aig-rewriting/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/eda/cpu/sproute/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/mining/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/mining/libminingbench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/mining/cpu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/mining/cpu/frequent-subgraph-mining/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/mining/cpu/k-clique-listing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/mining/cpu/motif-counting/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/mining/cpu/triangle-counting/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/scientific/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/scientific/cpu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/scientific/cpu/barneshut/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/scientific/cpu/delaunayrefinement/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/scientific/cpu/delaunaytriangulation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "lonestar/scientific/cpu/longestedge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scripts/make_dist.sh"
+  "scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "inputs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/graph-convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/graph-remap/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/graph-stats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/dist-graph-convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/intrinsics_gen.dir/DependInfo.cmake"
+  "CMakeFiles/omp_gen.dir/DependInfo.cmake"
+  "CMakeFiles/acc_gen.dir/DependInfo.cmake"
+  "CMakeFiles/lib.dir/DependInfo.cmake"
+  "CMakeFiles/apps.dir/DependInfo.cmake"
+  "libsupport/CMakeFiles/galois_support.dir/DependInfo.cmake"
+  "libsupport/test/CMakeFiles/unit-getenv.dir/DependInfo.cmake"
+  "libsupport/test/CMakeFiles/unit-logging.dir/DependInfo.cmake"
+  "libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-acquire.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-bandwidth.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-barriers.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-concurrent-hashmap.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-empty-member-lcgraph.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-execution-groups.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-flatmap.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-floatingPointErrors.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-foreach.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-forward-declare-graph.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-gcollections.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-graph.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-graph-compile.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-gslist.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-hwtopo.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-indexed-bag.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-lc-adaptor.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-lock.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-mem.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-morphgraph.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-move.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-oneach.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-papi.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-pc.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-reduction.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-reduction-barrier.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-set-intersect.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-sort.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-static.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-traits.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-twoleveliteratora.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-vector-reduction.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-wakeup-overhead.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-worklists-compile.dir/DependInfo.cmake"
+  "libgalois/test/CMakeFiles/unit-morphgraph-removal.dir/DependInfo.cmake"
+  "libdist/CMakeFiles/galois_dist_async.dir/DependInfo.cmake"
+  "libgluon/CMakeFiles/galois_gluon.dir/DependInfo.cmake"
+  "libpangolin/CMakeFiles/pangolin.dir/DependInfo.cmake"
+  "lonestar/libdistbench/CMakeFiles/distbench.dir/DependInfo.cmake"
+  "lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-sssp-push-simple.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-sssp-simple.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-sssp-pull-simple.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-hello-world.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-torus.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-torus-improved.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-torus-construction.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-graph-traversal-serial.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-graph-traversal-pull.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-graph-traversal-push.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-conflict-aware-torus.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-spanningtree.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-countlevels.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-malloc.dir/DependInfo.cmake"
+  "lonestar/tutorial_examples/CMakeFiles/example-wrapped-worklist.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/betweennesscentrality/CMakeFiles/betweennesscentrality-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/bfs/CMakeFiles/bfs-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/bfs/CMakeFiles/bfs-directionopt-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/bipart/CMakeFiles/bipart-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/spanningtree/CMakeFiles/minimum-spanningtree-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/clustering/CMakeFiles/louvain-clustering-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/clustering/CMakeFiles/leiden-clustering-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/coloring/CMakeFiles/graph-coloring-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/connected-components/CMakeFiles/connected-components-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/gmetis/CMakeFiles/gmetis-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/independentset/CMakeFiles/maximal-independentset-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/k-core/CMakeFiles/k-core-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/k-truss/CMakeFiles/k-truss-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/k-truss/CMakeFiles/verify-k-truss.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/matching/CMakeFiles/maximum-cardinality-matching-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/matrixcompletion/CMakeFiles/matrixcompletion-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/pagerank/CMakeFiles/pagerank-pull-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/pagerank/CMakeFiles/pagerank-push-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/pointstoanalysis/CMakeFiles/pointstoanalysis-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/preflowpush/CMakeFiles/preflowpush-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/sssp/CMakeFiles/sssp-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/cpu/triangle-counting/CMakeFiles/triangle-counting-cpu.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/betweennesscentrality/CMakeFiles/betweennesscentrality-level-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/betweennesscentrality/CMakeFiles/betweennesscentrality-minrounds-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/bfs/CMakeFiles/bfs-push-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/bfs/CMakeFiles/bfs-pull-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/connected-components/CMakeFiles/connected-components-push-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/connected-components/CMakeFiles/connected-components-pull-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/k-core/CMakeFiles/k-core-push-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/k-core/CMakeFiles/k-core-pull-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/pagerank/CMakeFiles/pagerank-pull-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/pagerank/CMakeFiles/pagerank-push-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/partition/CMakeFiles/partition-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/matrixcompletion/CMakeFiles/matrixcompletion-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/sssp/CMakeFiles/sssp-push-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/sssp/CMakeFiles/sssp-pull-dist.dir/DependInfo.cmake"
+  "lonestar/analytics/distributed/triangle-counting/CMakeFiles/triangle-counting-dist.dir/DependInfo.cmake"
+  "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/DependInfo.cmake"
+  "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/DependInfo.cmake"
+  "lonestar/mining/libminingbench/CMakeFiles/miningbench.dir/DependInfo.cmake"
+  "lonestar/mining/libminingbench/CMakeFiles/miningbench_dist.dir/DependInfo.cmake"
+  "lonestar/mining/cpu/frequent-subgraph-mining/CMakeFiles/frequent-subgraph-mining-cpu.dir/DependInfo.cmake"
+  "lonestar/mining/cpu/k-clique-listing/CMakeFiles/k-clique-listing-cpu.dir/DependInfo.cmake"
+  "lonestar/mining/cpu/motif-counting/CMakeFiles/motif-counting-cpu.dir/DependInfo.cmake"
+  "lonestar/mining/cpu/triangle-counting/CMakeFiles/triangle-counting-mining-cpu.dir/DependInfo.cmake"
+  "lonestar/scientific/cpu/barneshut/CMakeFiles/barneshut-cpu.dir/DependInfo.cmake"
+  "lonestar/scientific/cpu/delaunayrefinement/CMakeFiles/delaunayrefinement-cpu.dir/DependInfo.cmake"
+  "lonestar/scientific/cpu/delaunaytriangulation/CMakeFiles/delaunaytriangulation-cpu.dir/DependInfo.cmake"
+  "lonestar/scientific/cpu/delaunaytriangulation/CMakeFiles/delaunaytriangulation-deterministic-cpu.dir/DependInfo.cmake"
+  "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/DependInfo.cmake"
+  "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedgeTest.dir/DependInfo.cmake"
+  "inputs/CMakeFiles/input.dir/DependInfo.cmake"
+  "tools/graph-convert/CMakeFiles/graph-convert.dir/DependInfo.cmake"
+  "tools/graph-convert/CMakeFiles/graph-convert-huge.dir/DependInfo.cmake"
+  "tools/graph-remap/CMakeFiles/graph-remap.dir/DependInfo.cmake"
+  "tools/graph-stats/CMakeFiles/graph-stats.dir/DependInfo.cmake"
+  "tools/dist-graph-convert/CMakeFiles/dist-graph-convert.dir/DependInfo.cmake"
+  )
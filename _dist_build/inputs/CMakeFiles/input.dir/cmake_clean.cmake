@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/input"
+  "lonestar-cpu-inputs.tar.gz"
+  "small_inputs"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/input.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/galois_dist_async.dir/src/Barrier.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/Barrier.cpp.o.d"
+  "CMakeFiles/galois_dist_async.dir/src/DistGalois.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/DistGalois.cpp.o.d"
+  "CMakeFiles/galois_dist_async.dir/src/DistStats.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/DistStats.cpp.o.d"
+  "CMakeFiles/galois_dist_async.dir/src/Network.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/Network.cpp.o.d"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkBuffered.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkBuffered.cpp.o.d"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkIOMPI.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkIOMPI.cpp.o.d"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkIOSharedMem.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkIOSharedMem.cpp.o.d"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkLCI.cpp.o"
+  "CMakeFiles/galois_dist_async.dir/src/NetworkLCI.cpp.o.d"
+  "libgalois_dist_async.a"
+  "libgalois_dist_async.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/galois_dist_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,89 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/galois_shmem.dir/Version.cpp.o"
+  "CMakeFiles/galois_shmem.dir/Version.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Barrier.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Barrier.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Counting.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Counting.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Dissemination.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Dissemination.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_MCS.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_MCS.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Pthread.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Pthread.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Simple.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Simple.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Topo.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Barrier_Topo.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Context.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Context.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Deterministic.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Deterministic.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/DynamicBitset.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/DynamicBitset.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/EnvCheck.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/EnvCheck.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/FileGraph.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/FileGraph.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/FileGraphParallel.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/FileGraphParallel.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/GraphHelpers.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/GraphHelpers.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/HWTopo.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/HWTopo.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/HWTopoLinux.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/HWTopoLinux.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Mem.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Mem.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/NumaMem.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/NumaMem.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/OCFileGraph.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/OCFileGraph.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/PageAlloc.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/PageAlloc.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/PagePool.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/PagePool.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/ParaMeter.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/ParaMeter.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/PerThreadStorage.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/PerThreadStorage.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/PreAlloc.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/PreAlloc.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Profile.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Profile.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/PtrLock.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/PtrLock.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/SharedMem.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/SharedMem.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/SharedMemSys.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/SharedMemSys.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/SimpleLock.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/SimpleLock.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Statistics.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Statistics.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Substrate.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Substrate.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Support.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Support.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Termination.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Termination.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/ThreadPool.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/ThreadPool.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/ThreadTimer.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/ThreadTimer.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Threads.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Threads.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Timer.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Timer.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/Tracer.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/Tracer.cpp.o.d"
+  "CMakeFiles/galois_shmem.dir/src/gIO.cpp.o"
+  "CMakeFiles/galois_shmem.dir/src/gIO.cpp.o.d"
+  "libgalois_shmem.a"
+  "libgalois_shmem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/galois_shmem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
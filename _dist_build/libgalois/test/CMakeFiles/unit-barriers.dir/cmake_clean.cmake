@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-barriers.dir/barriers.cpp.o"
+  "CMakeFiles/unit-barriers.dir/barriers.cpp.o.d"
+  "unit-barriers"
+  "unit-barriers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-barriers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
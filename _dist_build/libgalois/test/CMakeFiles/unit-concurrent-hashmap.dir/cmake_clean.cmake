@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-concurrent-hashmap.dir/concurrent-hashmap.cpp.o"
+  "CMakeFiles/unit-concurrent-hashmap.dir/concurrent-hashmap.cpp.o.d"
+  "unit-concurrent-hashmap"
+  "unit-concurrent-hashmap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-concurrent-hashmap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libgalois/test/empty-member-lcgraph.cpp" "libgalois/test/CMakeFiles/unit-empty-member-lcgraph.dir/empty-member-lcgraph.cpp.o" "gcc" "libgalois/test/CMakeFiles/unit-empty-member-lcgraph.dir/empty-member-lcgraph.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-empty-member-lcgraph.dir/empty-member-lcgraph.cpp.o"
+  "CMakeFiles/unit-empty-member-lcgraph.dir/empty-member-lcgraph.cpp.o.d"
+  "unit-empty-member-lcgraph"
+  "unit-empty-member-lcgraph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-empty-member-lcgraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-execution-groups.dir/execution-groups.cpp.o"
+  "CMakeFiles/unit-execution-groups.dir/execution-groups.cpp.o.d"
+  "unit-execution-groups"
+  "unit-execution-groups.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-execution-groups.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-forward-declare-graph.dir/forward-declare-graph.cpp.o"
+  "CMakeFiles/unit-forward-declare-graph.dir/forward-declare-graph.cpp.o.d"
+  "unit-forward-declare-graph"
+  "unit-forward-declare-graph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-forward-declare-graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-graph.dir/graph.cpp.o"
+  "CMakeFiles/unit-graph.dir/graph.cpp.o.d"
+  "unit-graph"
+  "unit-graph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-graph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-indexed-bag.dir/indexed-bag.cpp.o"
+  "CMakeFiles/unit-indexed-bag.dir/indexed-bag.cpp.o.d"
+  "unit-indexed-bag"
+  "unit-indexed-bag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-indexed-bag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-lc-adaptor.dir/lc-adaptor.cpp.o"
+  "CMakeFiles/unit-lc-adaptor.dir/lc-adaptor.cpp.o.d"
+  "unit-lc-adaptor"
+  "unit-lc-adaptor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-lc-adaptor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
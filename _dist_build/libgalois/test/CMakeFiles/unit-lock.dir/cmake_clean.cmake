@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-lock.dir/lock.cpp.o"
+  "CMakeFiles/unit-lock.dir/lock.cpp.o.d"
+  "unit-lock"
+  "unit-lock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-lock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
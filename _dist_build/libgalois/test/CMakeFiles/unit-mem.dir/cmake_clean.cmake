@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-mem.dir/mem.cpp.o"
+  "CMakeFiles/unit-mem.dir/mem.cpp.o.d"
+  "unit-mem"
+  "unit-mem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-mem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
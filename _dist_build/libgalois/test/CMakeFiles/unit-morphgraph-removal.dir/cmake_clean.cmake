@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-morphgraph-removal.dir/morphgraph-removal.cpp.o"
+  "CMakeFiles/unit-morphgraph-removal.dir/morphgraph-removal.cpp.o.d"
+  "unit-morphgraph-removal"
+  "unit-morphgraph-removal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-morphgraph-removal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
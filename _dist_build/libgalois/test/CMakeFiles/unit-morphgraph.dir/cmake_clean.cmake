@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-morphgraph.dir/morphgraph.cpp.o"
+  "CMakeFiles/unit-morphgraph.dir/morphgraph.cpp.o.d"
+  "unit-morphgraph"
+  "unit-morphgraph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-morphgraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
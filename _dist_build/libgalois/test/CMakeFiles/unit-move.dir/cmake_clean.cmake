@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-move.dir/move.cpp.o"
+  "CMakeFiles/unit-move.dir/move.cpp.o.d"
+  "unit-move"
+  "unit-move.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-move.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
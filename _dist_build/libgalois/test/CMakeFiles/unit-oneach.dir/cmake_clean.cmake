@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-oneach.dir/oneach.cpp.o"
+  "CMakeFiles/unit-oneach.dir/oneach.cpp.o.d"
+  "unit-oneach"
+  "unit-oneach.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-oneach.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
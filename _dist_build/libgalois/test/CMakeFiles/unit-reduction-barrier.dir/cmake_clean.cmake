@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-reduction-barrier.dir/reduction-barrier.cpp.o"
+  "CMakeFiles/unit-reduction-barrier.dir/reduction-barrier.cpp.o.d"
+  "unit-reduction-barrier"
+  "unit-reduction-barrier.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-reduction-barrier.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
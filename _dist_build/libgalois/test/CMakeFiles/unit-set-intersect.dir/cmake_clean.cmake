@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-set-intersect.dir/set-intersect.cpp.o"
+  "CMakeFiles/unit-set-intersect.dir/set-intersect.cpp.o.d"
+  "unit-set-intersect"
+  "unit-set-intersect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-set-intersect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-static.dir/static.cpp.o"
+  "CMakeFiles/unit-static.dir/static.cpp.o.d"
+  "unit-static"
+  "unit-static.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-traits.dir/traits.cpp.o"
+  "CMakeFiles/unit-traits.dir/traits.cpp.o.d"
+  "unit-traits"
+  "unit-traits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
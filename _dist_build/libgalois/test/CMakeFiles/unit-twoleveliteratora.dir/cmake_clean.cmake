@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-twoleveliteratora.dir/twoleveliteratora.cpp.o"
+  "CMakeFiles/unit-twoleveliteratora.dir/twoleveliteratora.cpp.o.d"
+  "unit-twoleveliteratora"
+  "unit-twoleveliteratora.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-twoleveliteratora.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-vector-reduction.dir/vector-reduction.cpp.o"
+  "CMakeFiles/unit-vector-reduction.dir/vector-reduction.cpp.o.d"
+  "unit-vector-reduction"
+  "unit-vector-reduction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-vector-reduction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
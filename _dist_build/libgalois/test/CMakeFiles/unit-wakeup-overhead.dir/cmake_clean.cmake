@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-wakeup-overhead.dir/wakeup-overhead.cpp.o"
+  "CMakeFiles/unit-wakeup-overhead.dir/wakeup-overhead.cpp.o.d"
+  "unit-wakeup-overhead"
+  "unit-wakeup-overhead.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-wakeup-overhead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-worklists-compile.dir/worklists-compile.cpp.o"
+  "CMakeFiles/unit-worklists-compile.dir/worklists-compile.cpp.o.d"
+  "unit-worklists-compile"
+  "unit-worklists-compile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-worklists-compile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
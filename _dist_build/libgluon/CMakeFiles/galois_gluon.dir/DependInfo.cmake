@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libgluon/src/GlobalObj.cpp" "libgluon/CMakeFiles/galois_gluon.dir/src/GlobalObj.cpp.o" "gcc" "libgluon/CMakeFiles/galois_gluon.dir/src/GlobalObj.cpp.o.d"
+  "/root/repo/libgluon/src/GluonSubstrate.cpp" "libgluon/CMakeFiles/galois_gluon.dir/src/GluonSubstrate.cpp.o" "gcc" "libgluon/CMakeFiles/galois_gluon.dir/src/GluonSubstrate.cpp.o.d"
+  "/root/repo/libgluon/src/SyncStructures.cpp" "libgluon/CMakeFiles/galois_gluon.dir/src/SyncStructures.cpp.o" "gcc" "libgluon/CMakeFiles/galois_gluon.dir/src/SyncStructures.cpp.o.d"
+  "/root/repo/libgluon/src/cuda_device.cpp" "libgluon/CMakeFiles/galois_gluon.dir/src/cuda_device.cpp.o" "gcc" "libgluon/CMakeFiles/galois_gluon.dir/src/cuda_device.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libdist/CMakeFiles/galois_dist_async.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/galois_gluon.dir/src/GlobalObj.cpp.o"
+  "CMakeFiles/galois_gluon.dir/src/GlobalObj.cpp.o.d"
+  "CMakeFiles/galois_gluon.dir/src/GluonSubstrate.cpp.o"
+  "CMakeFiles/galois_gluon.dir/src/GluonSubstrate.cpp.o.d"
+  "CMakeFiles/galois_gluon.dir/src/SyncStructures.cpp.o"
+  "CMakeFiles/galois_gluon.dir/src/SyncStructures.cpp.o.d"
+  "CMakeFiles/galois_gluon.dir/src/cuda_device.cpp.o"
+  "CMakeFiles/galois_gluon.dir/src/cuda_device.cpp.o.d"
+  "libgalois_gluon.a"
+  "libgalois_gluon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/galois_gluon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
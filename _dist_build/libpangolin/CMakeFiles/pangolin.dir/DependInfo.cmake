@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libpangolin/src/BfsMining/embedding_list.cpp" "libpangolin/CMakeFiles/pangolin.dir/src/BfsMining/embedding_list.cpp.o" "gcc" "libpangolin/CMakeFiles/pangolin.dir/src/BfsMining/embedding_list.cpp.o.d"
+  "/root/repo/libpangolin/src/base_embedding.cpp" "libpangolin/CMakeFiles/pangolin.dir/src/base_embedding.cpp.o" "gcc" "libpangolin/CMakeFiles/pangolin.dir/src/base_embedding.cpp.o.d"
+  "/root/repo/libpangolin/src/equivalence.cpp" "libpangolin/CMakeFiles/pangolin.dir/src/equivalence.cpp.o" "gcc" "libpangolin/CMakeFiles/pangolin.dir/src/equivalence.cpp.o.d"
+  "/root/repo/libpangolin/src/quick_pattern.cpp" "libpangolin/CMakeFiles/pangolin.dir/src/quick_pattern.cpp.o" "gcc" "libpangolin/CMakeFiles/pangolin.dir/src/quick_pattern.cpp.o.d"
+  "/root/repo/libpangolin/src/vertex_embedding.cpp" "libpangolin/CMakeFiles/pangolin.dir/src/vertex_embedding.cpp.o" "gcc" "libpangolin/CMakeFiles/pangolin.dir/src/vertex_embedding.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-getenv.dir/getenv.cpp.o"
+  "CMakeFiles/unit-getenv.dir/getenv.cpp.o.d"
+  "unit-getenv"
+  "unit-getenv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-getenv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
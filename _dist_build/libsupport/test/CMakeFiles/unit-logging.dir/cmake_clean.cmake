@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit-logging.dir/logging.cpp.o"
+  "CMakeFiles/unit-logging.dir/logging.cpp.o.d"
+  "unit-logging"
+  "unit-logging.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit-logging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
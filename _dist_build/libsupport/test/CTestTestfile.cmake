@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/libsupport/test
+# Build directory: /root/repo/_dist_build/libsupport/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit-getenv "/root/repo/_dist_build/libsupport/test/unit-getenv")
+set_tests_properties(unit-getenv PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/libsupport/test/CMakeLists.txt;9;add_test;/root/repo/libsupport/test/CMakeLists.txt;19;add_test_unit;/root/repo/libsupport/test/CMakeLists.txt;0;")
+add_test(unit-logging "/root/repo/_dist_build/libsupport/test/unit-logging")
+set_tests_properties(unit-logging PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/libsupport/test/CMakeLists.txt;9;add_test;/root/repo/libsupport/test/CMakeLists.txt;20;add_test_unit;/root/repo/libsupport/test/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/betweennesscentrality-cpu.dir/BetweennessCentrality.cpp.o"
+  "CMakeFiles/betweennesscentrality-cpu.dir/BetweennessCentrality.cpp.o.d"
+  "betweennesscentrality-cpu"
+  "betweennesscentrality-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/betweennesscentrality-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
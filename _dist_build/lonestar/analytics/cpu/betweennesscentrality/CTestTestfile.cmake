@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/betweennesscentrality
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/betweennesscentrality
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-level-betweennesscentrality-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/betweennesscentrality/betweennesscentrality-cpu" "-algo=Level" "-numOfSources=4" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-t" "1")
+set_tests_properties(run-small-level-betweennesscentrality-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;5;add_test_scale;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;0;")
+add_test(run-small-async-betweennesscentrality-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/betweennesscentrality/betweennesscentrality-cpu" "-algo=Async" "-numOfSources=4" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-t" "1")
+set_tests_properties(run-small-async-betweennesscentrality-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;0;")
+add_test(run-small-outer-betweennesscentrality-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/betweennesscentrality/betweennesscentrality-cpu" "-algo=Outer" "-numOfSources=4" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-t" "1")
+set_tests_properties(run-small-outer-betweennesscentrality-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;0;")
+add_test(run-small-multisource-betweennesscentrality-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/betweennesscentrality/betweennesscentrality-cpu" "-algo=MultiSource" "-numOfSources=4" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-t" "1")
+set_tests_properties(run-small-multisource-betweennesscentrality-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;8;add_test_scale;/root/repo/lonestar/analytics/cpu/betweennesscentrality/CMakeLists.txt;0;")
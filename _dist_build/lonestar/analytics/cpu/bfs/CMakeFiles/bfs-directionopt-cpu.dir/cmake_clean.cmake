@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bfs-directionopt-cpu.dir/bfsDirectionOpt.cpp.o"
+  "CMakeFiles/bfs-directionopt-cpu.dir/bfsDirectionOpt.cpp.o.d"
+  "bfs-directionopt-cpu"
+  "bfs-directionopt-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bfs-directionopt-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/bipart
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/bipart
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-bipart-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/bipart/bipart-cpu" "-hMetisGraph" "/root/repo/_dist_build/inputs/partitioning/ibm01.hgr" "-t" "1")
+set_tests_properties(run-small1-bipart-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/bipart/CMakeLists.txt;5;add_test_scale;/root/repo/lonestar/analytics/cpu/bipart/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/leiden-clustering-cpu.dir/leidenClustering.cpp.o"
+  "CMakeFiles/leiden-clustering-cpu.dir/leidenClustering.cpp.o.d"
+  "leiden-clustering-cpu"
+  "leiden-clustering-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/leiden-clustering-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graph-coloring-cpu.dir/GraphColoring.cpp.o"
+  "CMakeFiles/graph-coloring-cpu.dir/GraphColoring.cpp.o.d"
+  "graph-coloring-cpu"
+  "graph-coloring-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graph-coloring-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
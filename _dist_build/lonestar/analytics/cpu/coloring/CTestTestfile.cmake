@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/coloring
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/coloring
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-jpldf-graph-coloring-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/coloring/graph-coloring-cpu" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-symmetricGraph" "-algo=JPLargestDegreeFirst" "-t" "1")
+set_tests_properties(run-small-jpldf-graph-coloring-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/coloring/CMakeLists.txt;5;add_test_scale;/root/repo/lonestar/analytics/cpu/coloring/CMakeLists.txt;0;")
+add_test(run-small-jpsl-graph-coloring-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/coloring/graph-coloring-cpu" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-symmetricGraph" "-algo=JPSmallestLast" "-t" "1")
+set_tests_properties(run-small-jpsl-graph-coloring-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/coloring/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/coloring/CMakeLists.txt;0;")
+add_test(run-small-spec-graph-coloring-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/coloring/graph-coloring-cpu" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-symmetricGraph" "-algo=Speculative" "-t" "1")
+set_tests_properties(run-small-spec-graph-coloring-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/coloring/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/coloring/CMakeLists.txt;0;")
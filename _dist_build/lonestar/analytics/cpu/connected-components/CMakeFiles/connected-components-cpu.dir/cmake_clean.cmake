@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/connected-components-cpu.dir/ConnectedComponents.cpp.o"
+  "CMakeFiles/connected-components-cpu.dir/ConnectedComponents.cpp.o.d"
+  "connected-components-cpu"
+  "connected-components-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/connected-components-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gmetis-cpu.dir/Coarsening.cpp.o"
+  "CMakeFiles/gmetis-cpu.dir/Coarsening.cpp.o.d"
+  "CMakeFiles/gmetis-cpu.dir/GMetis.cpp.o"
+  "CMakeFiles/gmetis-cpu.dir/GMetis.cpp.o.d"
+  "CMakeFiles/gmetis-cpu.dir/Metric.cpp.o"
+  "CMakeFiles/gmetis-cpu.dir/Metric.cpp.o.d"
+  "CMakeFiles/gmetis-cpu.dir/Partitioning.cpp.o"
+  "CMakeFiles/gmetis-cpu.dir/Partitioning.cpp.o.d"
+  "CMakeFiles/gmetis-cpu.dir/Refine.cpp.o"
+  "CMakeFiles/gmetis-cpu.dir/Refine.cpp.o.d"
+  "gmetis-cpu"
+  "gmetis-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gmetis-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
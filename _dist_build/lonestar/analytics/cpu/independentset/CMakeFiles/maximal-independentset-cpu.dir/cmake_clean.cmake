@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/maximal-independentset-cpu.dir/IndependentSet.cpp.o"
+  "CMakeFiles/maximal-independentset-cpu.dir/IndependentSet.cpp.o.d"
+  "maximal-independentset-cpu"
+  "maximal-independentset-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/maximal-independentset-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/k-core-cpu.dir/kcore.cpp.o"
+  "CMakeFiles/k-core-cpu.dir/kcore.cpp.o.d"
+  "k-core-cpu"
+  "k-core-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/k-core-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/k-core
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/k-core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-k-core-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/k-core/k-core-cpu" "--kcore=4" "-symmetricGraph" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small-k-core-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/k-core/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/k-core/CMakeLists.txt;0;")
+add_test(run-small-decompose-k-core-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/k-core/k-core-cpu" "-algo=Decompose" "-symmetricGraph" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat10.sgr" "-t" "1")
+set_tests_properties(run-small-decompose-k-core-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/k-core/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/k-core/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/verify-k-truss.dir/Verify.cpp.o"
+  "CMakeFiles/verify-k-truss.dir/Verify.cpp.o.d"
+  "verify-k-truss"
+  "verify-k-truss.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/verify-k-truss.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
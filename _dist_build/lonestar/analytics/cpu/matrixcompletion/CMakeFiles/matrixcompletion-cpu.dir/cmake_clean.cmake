@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matrixcompletion-cpu.dir/matrixCompletion.cpp.o"
+  "CMakeFiles/matrixcompletion-cpu.dir/matrixCompletion.cpp.o.d"
+  "matrixcompletion-cpu"
+  "matrixcompletion-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matrixcompletion-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/preflowpush
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/preflowpush
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-preflowpush-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/preflowpush/preflowpush-cpu" "/root/repo/_dist_build/inputs/reference/structured/torus5.gr" "-sourceNode=0" "-sinkNode=10" "-t" "1")
+set_tests_properties(run-small1-preflowpush-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/preflowpush/CMakeLists.txt;5;add_test_scale;/root/repo/lonestar/analytics/cpu/preflowpush/CMakeLists.txt;0;")
+add_test(run-small-nogap-preflowpush-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/preflowpush/preflowpush-cpu" "/root/repo/_dist_build/inputs/reference/structured/torus5.gr" "-sourceNode=0" "-sinkNode=10" "-gap=false" "-t" "1")
+set_tests_properties(run-small-nogap-preflowpush-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/preflowpush/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/preflowpush/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/minimum-spanningtree-cpu.dir/Boruvka.cpp.o"
+  "CMakeFiles/minimum-spanningtree-cpu.dir/Boruvka.cpp.o.d"
+  "minimum-spanningtree-cpu"
+  "minimum-spanningtree-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/minimum-spanningtree-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
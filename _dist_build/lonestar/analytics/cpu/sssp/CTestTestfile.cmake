@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/sssp
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/sssp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-sssp-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/sssp/sssp-cpu" "/root/repo/_dist_build/inputs/reference/structured/rome99.gr" "-delta" "8" "-t" "1")
+set_tests_properties(run-small1-sssp-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;0;")
+add_test(run-small2-sssp-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/sssp/sssp-cpu" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-delta" "8" "-t" "1")
+set_tests_properties(run-small2-sssp-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;0;")
+add_test(run-small-rho-sssp-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/sssp/sssp-cpu" "/root/repo/_dist_build/inputs/reference/structured/rome99.gr" "-algo=rhoStep" "-t" "1")
+set_tests_properties(run-small-rho-sssp-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;8;add_test_scale;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;0;")
+add_test(run-small-radius-sssp-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/sssp/sssp-cpu" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-algo=radiusStep" "-t" "1")
+set_tests_properties(run-small-radius-sssp-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;9;add_test_scale;/root/repo/lonestar/analytics/cpu/sssp/CMakeLists.txt;0;")
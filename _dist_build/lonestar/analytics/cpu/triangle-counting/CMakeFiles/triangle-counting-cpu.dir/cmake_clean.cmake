@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangle-counting-cpu.dir/Triangles.cpp.o"
+  "CMakeFiles/triangle-counting-cpu.dir/Triangles.cpp.o.d"
+  "triangle-counting-cpu"
+  "triangle-counting-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangle-counting-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
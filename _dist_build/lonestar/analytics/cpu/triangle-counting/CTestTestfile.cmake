@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/cpu/triangle-counting
+# Build directory: /root/repo/_dist_build/lonestar/analytics/cpu/triangle-counting
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-ordered-relabel-triangle-counting-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/triangle-counting/triangle-counting-cpu" "-symmetricGraph" "-algo=orderedCount" "--relabel=true" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat15.csgr" "-t" "1")
+set_tests_properties(run-small-ordered-relabel-triangle-counting-cpu-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;0;")
+add_test(run-small-ordered-triangle-counting-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/triangle-counting/triangle-counting-cpu" "-symmetricGraph" "-algo=orderedCount" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat15.csgr" "-t" "1")
+set_tests_properties(run-small-ordered-triangle-counting-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;7;add_test_scale;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;0;")
+add_test(run-small-node-triangle-counting-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/triangle-counting/triangle-counting-cpu" "-symmetricGraph" "-algo=nodeiterator" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat15.csgr" "-t" "1")
+set_tests_properties(run-small-node-triangle-counting-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;8;add_test_scale;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;0;")
+add_test(run-small-edge-triangle-counting-cpu-1 "/root/repo/_dist_build/lonestar/analytics/cpu/triangle-counting/triangle-counting-cpu" "-symmetricGraph" "-algo=edgeiterator" "/root/repo/_dist_build/inputs/scalefree/symmetric/rmat15.csgr" "-t" "1")
+set_tests_properties(run-small-edge-triangle-counting-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;9;add_test_scale;/root/repo/lonestar/analytics/cpu/triangle-counting/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/betweennesscentrality-level-dist.dir/bc_level.cpp.o"
+  "CMakeFiles/betweennesscentrality-level-dist.dir/bc_level.cpp.o.d"
+  "betweennesscentrality-level-dist"
+  "betweennesscentrality-level-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/betweennesscentrality-level-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
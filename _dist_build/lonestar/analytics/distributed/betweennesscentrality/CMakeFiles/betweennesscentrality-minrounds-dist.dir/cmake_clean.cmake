@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/betweennesscentrality-minrounds-dist.dir/bc_mr.cpp.o"
+  "CMakeFiles/betweennesscentrality-minrounds-dist.dir/bc_mr.cpp.o.d"
+  "betweennesscentrality-minrounds-dist"
+  "betweennesscentrality-minrounds-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/betweennesscentrality-minrounds-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bfs-pull-dist.dir/bfs_pull.cpp.o"
+  "CMakeFiles/bfs-pull-dist.dir/bfs_pull.cpp.o.d"
+  "bfs-pull-dist"
+  "bfs-pull-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bfs-pull-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,54 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/distributed/bfs
+# Build directory: /root/repo/_dist_build/lonestar/analytics/distributed/bfs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-bfs-push-dist-sync-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-sync-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-push-dist-sync-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-push-dist-async-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-push-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-push-dist-async-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=oec")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=iec")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hovc")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-sync-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Sync" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-pull-dist-sync-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;209;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
+add_test(run-bfs-pull-dist-async-cpu-rmat15-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./bfs-pull-dist" "/root/repo/_dist_build/inputs/scalefree/rmat15.gr" "-graphTranspose=/root/repo/_dist_build/inputs/scalefree/transpose/rmat15.tgr" "-exec=Async" "-t=1" "-partition=hivc")
+set_tests_properties(run-bfs-pull-dist-async-cpu-rmat15-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;210;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;5;add_test_dist;/root/repo/lonestar/analytics/distributed/bfs/CMakeLists.txt;0;")
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lonestar/analytics/distributed/k-core/kcore_pull.cpp" "lonestar/analytics/distributed/k-core/CMakeFiles/k-core-pull-dist.dir/kcore_pull.cpp.o" "gcc" "lonestar/analytics/distributed/k-core/CMakeFiles/k-core-pull-dist.dir/kcore_pull.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/libdistbench/CMakeFiles/distbench.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/libgluon/CMakeFiles/galois_gluon.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/libdist/CMakeFiles/galois_dist_async.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
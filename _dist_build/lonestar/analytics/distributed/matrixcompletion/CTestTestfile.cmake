@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/analytics/distributed/matrixcompletion
+# Build directory: /root/repo/_dist_build/lonestar/analytics/distributed/matrixcompletion
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-oec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./matrixcompletion-dist" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-graphTranspose=/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.tgr" "-maxIterations=2" "-t=1" "-partition=oec")
+set_tests_properties(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-oec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;212;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./matrixcompletion-dist" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-graphTranspose=/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.tgr" "-maxIterations=2" "-t=1" "-partition=iec")
+set_tests_properties(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;212;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-cvc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./matrixcompletion-dist" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-graphTranspose=/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.tgr" "-maxIterations=2" "-t=1" "-partition=cvc")
+set_tests_properties(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-cvc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;212;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-cvc-iec-1 "mpiexec" "--bind-to" "none" "-n" "1" "./matrixcompletion-dist" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-graphTranspose=/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.tgr" "-maxIterations=2" "-t=1" "-partition=cvc-iec")
+set_tests_properties(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-cvc-iec-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;212;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-hovc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./matrixcompletion-dist" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-graphTranspose=/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.tgr" "-maxIterations=2" "-t=1" "-partition=hovc")
+set_tests_properties(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-hovc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;212;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;0;")
+add_test(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-hivc-1 "mpiexec" "--bind-to" "none" "-n" "1" "./matrixcompletion-dist" "/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.gr" "-graphTranspose=/root/repo/_dist_build/inputs/weighted/bipartite/Epinions_dataset.tgr" "-maxIterations=2" "-t=1" "-partition=hivc")
+set_tests_properties(run-matrixcompletion-dist-sync-cpu-Epinions_dataset-hivc-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;133;add_test;/root/repo/lonestar/CMakeLists.txt;169;add_test_dist_and_verify;/root/repo/lonestar/CMakeLists.txt;212;add_test_dist_for_partitions;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;2;add_test_dist;/root/repo/lonestar/analytics/distributed/matrixcompletion/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pagerank-push-dist.dir/pagerank_push.cpp.o"
+  "CMakeFiles/pagerank-push-dist.dir/pagerank_push.cpp.o.d"
+  "pagerank-push-dist"
+  "pagerank-push-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pagerank-push-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
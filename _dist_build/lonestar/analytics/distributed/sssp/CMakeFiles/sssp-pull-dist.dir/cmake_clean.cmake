@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sssp-pull-dist.dir/sssp_pull.cpp.o"
+  "CMakeFiles/sssp-pull-dist.dir/sssp_pull.cpp.o.d"
+  "sssp-pull-dist"
+  "sssp-pull-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sssp-pull-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
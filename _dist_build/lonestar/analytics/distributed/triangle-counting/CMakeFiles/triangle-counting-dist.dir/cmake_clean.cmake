@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/triangle-counting-dist.dir/tc.cpp.o"
+  "CMakeFiles/triangle-counting-dist.dir/tc.cpp.o.d"
+  "triangle-counting-dist"
+  "triangle-counting-dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/triangle-counting-dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
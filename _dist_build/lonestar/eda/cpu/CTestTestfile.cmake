@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/eda/cpu
+# Build directory: /root/repo/_dist_build/lonestar/eda/cpu
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("aig-rewriting")
+subdirs("sproute")
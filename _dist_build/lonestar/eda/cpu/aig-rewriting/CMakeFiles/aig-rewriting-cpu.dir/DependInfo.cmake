@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/xxHash/xxhash.c" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/xxHash/xxhash.c.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/xxHash/xxhash.c.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/ChoiceManager.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/ChoiceManager.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/ChoiceManager.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/CutManager.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutManager.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutManager.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/CutPool.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutPool.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutPool.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/NPNManager.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/NPNManager.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/NPNManager.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/PreCompGraphManager.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/PreCompGraphManager.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/PreCompGraphManager.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/PriorityCutManager.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutManager.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutManager.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/PriorityCutPool.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutPool.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutPool.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/ReconvDrivenCut.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/ReconvDrivenCut.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/ReconvDrivenCut.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/algorithms/RewriteManager.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/RewriteManager.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/algorithms/RewriteManager.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/functional/BitVectorPool.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/functional/BitVectorPool.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/functional/BitVectorPool.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/functional/FunctionUtil.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/functional/FunctionUtil.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/functional/FunctionUtil.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/main.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/main.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/main.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/misc/util/utilString.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/misc/util/utilString.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/misc/util/utilString.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/parsers/AigParser.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/AigParser.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/AigParser.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/parsers/LookupTableParser.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/LookupTableParser.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/LookupTableParser.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/parsers/semantic_error.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/semantic_error.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/semantic_error.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/parsers/syntax_error.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/syntax_error.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/syntax_error.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/parsers/unexpected_eof.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/unexpected_eof.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/parsers/unexpected_eof.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/subjectgraph/aig/Aig.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/subjectgraph/aig/Aig.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/subjectgraph/aig/Aig.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/writers/AigWriter.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/writers/AigWriter.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/writers/AigWriter.cpp.o.d"
+  "/root/repo/lonestar/eda/cpu/aig-rewriting/writers/BlifWriter.cpp" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/writers/BlifWriter.cpp.o" "gcc" "lonestar/eda/cpu/aig-rewriting/CMakeFiles/aig-rewriting-cpu.dir/writers/BlifWriter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
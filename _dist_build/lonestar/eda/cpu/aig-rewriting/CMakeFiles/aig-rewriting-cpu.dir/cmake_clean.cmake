@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/ChoiceManager.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/ChoiceManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutManager.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutPool.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/CutPool.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/NPNManager.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/NPNManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/PreCompGraphManager.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/PreCompGraphManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutManager.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutPool.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/PriorityCutPool.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/ReconvDrivenCut.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/ReconvDrivenCut.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/RewriteManager.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/algorithms/RewriteManager.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/functional/BitVectorPool.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/functional/BitVectorPool.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/functional/FunctionUtil.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/functional/FunctionUtil.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/main.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/main.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/misc/util/utilString.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/misc/util/utilString.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/AigParser.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/AigParser.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/LookupTableParser.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/LookupTableParser.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/semantic_error.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/semantic_error.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/syntax_error.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/syntax_error.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/unexpected_eof.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/parsers/unexpected_eof.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/subjectgraph/aig/Aig.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/subjectgraph/aig/Aig.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/writers/AigWriter.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/writers/AigWriter.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/writers/BlifWriter.cpp.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/writers/BlifWriter.cpp.o.d"
+  "CMakeFiles/aig-rewriting-cpu.dir/xxHash/xxhash.c.o"
+  "CMakeFiles/aig-rewriting-cpu.dir/xxHash/xxhash.c.o.d"
+  "aig-rewriting-cpu"
+  "aig-rewriting-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/aig-rewriting-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lonestar/eda/cpu/sproute/bookshelf_IO.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/bookshelf_IO.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/bookshelf_IO.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/dist.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/dist.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/dist.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/dl.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/dl.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/dl.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/err.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/err.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/err.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/heap.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/heap.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/heap.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/memAlloc.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/memAlloc.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/memAlloc.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/mst2.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/mst2.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/mst2.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/neighbors.c" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/neighbors.c.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/neighbors.c.o.d"
+  "/root/repo/lonestar/eda/cpu/sproute/main.cpp" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/main.cpp.o" "gcc" "lonestar/eda/cpu/sproute/CMakeFiles/sproute-cpu.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/eda/cpu/sproute
+# Build directory: /root/repo/_dist_build/lonestar/eda/cpu/sproute
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small1-sproute-cpu-1 "/root/repo/_dist_build/lonestar/eda/cpu/sproute/sproute-cpu" "-ISPD2008Graph" "/root/repo/_dist_build/inputs/eda/routing/test.gr" "--flute" "/root/repo/_dist_build/inputs/eda/routing" "-t" "1")
+set_tests_properties(run-small1-sproute-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/eda/cpu/sproute/CMakeLists.txt;6;add_test_scale;/root/repo/lonestar/eda/cpu/sproute/CMakeLists.txt;0;")
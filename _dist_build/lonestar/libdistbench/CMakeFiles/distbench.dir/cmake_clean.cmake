@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/distbench.dir/src/Input.cpp.o"
+  "CMakeFiles/distbench.dir/src/Input.cpp.o.d"
+  "CMakeFiles/distbench.dir/src/Output.cpp.o"
+  "CMakeFiles/distbench.dir/src/Output.cpp.o.d"
+  "CMakeFiles/distbench.dir/src/Start.cpp.o"
+  "CMakeFiles/distbench.dir/src/Start.cpp.o.d"
+  "libdistbench.a"
+  "libdistbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/mining
+# Build directory: /root/repo/_dist_build/lonestar/mining
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("libminingbench")
+subdirs("cpu")
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/mining/cpu
+# Build directory: /root/repo/_dist_build/lonestar/mining/cpu
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("frequent-subgraph-mining")
+subdirs("k-clique-listing")
+subdirs("motif-counting")
+subdirs("triangle-counting")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/k-clique-listing-cpu.dir/kcl.cpp.o"
+  "CMakeFiles/k-clique-listing-cpu.dir/kcl.cpp.o.d"
+  "k-clique-listing-cpu"
+  "k-clique-listing-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/k-clique-listing-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/motif-counting-cpu.dir/motif.cpp.o"
+  "CMakeFiles/motif-counting-cpu.dir/motif.cpp.o.d"
+  "motif-counting-cpu"
+  "motif-counting-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/motif-counting-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lonestar/mining/cpu/triangle-counting/tc_mine.cpp" "lonestar/mining/cpu/triangle-counting/CMakeFiles/triangle-counting-mining-cpu.dir/tc_mine.cpp.o" "gcc" "lonestar/mining/cpu/triangle-counting/CMakeFiles/triangle-counting-mining-cpu.dir/tc_mine.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libpangolin/CMakeFiles/pangolin.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/mining/libminingbench/CMakeFiles/miningbench.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
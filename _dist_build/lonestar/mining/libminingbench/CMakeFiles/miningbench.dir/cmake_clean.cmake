@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/miningbench.dir/src/Input.cpp.o"
+  "CMakeFiles/miningbench.dir/src/Input.cpp.o.d"
+  "CMakeFiles/miningbench.dir/src/Start.cpp.o"
+  "CMakeFiles/miningbench.dir/src/Start.cpp.o.d"
+  "libminingbench.a"
+  "libminingbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/miningbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/miningbench_dist.dir/src/Start.cpp.o"
+  "CMakeFiles/miningbench_dist.dir/src/Start.cpp.o.d"
+  "libminingbench_dist.a"
+  "libminingbench_dist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/miningbench_dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
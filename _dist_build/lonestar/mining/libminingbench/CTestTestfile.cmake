@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/mining/libminingbench
+# Build directory: /root/repo/_dist_build/lonestar/mining/libminingbench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/scientific
+# Build directory: /root/repo/_dist_build/lonestar/scientific
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("cpu")
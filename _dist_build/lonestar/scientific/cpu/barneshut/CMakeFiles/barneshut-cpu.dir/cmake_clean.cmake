@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/barneshut-cpu.dir/Barneshut.cpp.o"
+  "CMakeFiles/barneshut-cpu.dir/Barneshut.cpp.o.d"
+  "barneshut-cpu"
+  "barneshut-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/barneshut-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/scientific/cpu/barneshut
+# Build directory: /root/repo/_dist_build/lonestar/scientific/cpu/barneshut
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-barneshut-cpu-1 "/root/repo/_dist_build/lonestar/scientific/cpu/barneshut/barneshut-cpu" "-n" "10000" "-steps" "1" "-seed" "0" "-t" "1")
+set_tests_properties(run-small-barneshut-cpu-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/scientific/cpu/barneshut/CMakeLists.txt;10;add_test_scale;/root/repo/lonestar/scientific/cpu/barneshut/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/delaunaytriangulation-cpu.dir/DelaunayTriangulation.cpp.o"
+  "CMakeFiles/delaunaytriangulation-cpu.dir/DelaunayTriangulation.cpp.o.d"
+  "CMakeFiles/delaunaytriangulation-cpu.dir/Element.cpp.o"
+  "CMakeFiles/delaunaytriangulation-cpu.dir/Element.cpp.o.d"
+  "delaunaytriangulation-cpu"
+  "delaunaytriangulation-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delaunaytriangulation-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/delaunaytriangulation-deterministic-cpu.dir/DelaunayTriangulationDet.cpp.o"
+  "CMakeFiles/delaunaytriangulation-deterministic-cpu.dir/DelaunayTriangulationDet.cpp.o.d"
+  "CMakeFiles/delaunaytriangulation-deterministic-cpu.dir/Element.cpp.o"
+  "CMakeFiles/delaunaytriangulation-deterministic-cpu.dir/Element.cpp.o.d"
+  "delaunaytriangulation-deterministic-cpu"
+  "delaunaytriangulation-deterministic-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delaunaytriangulation-deterministic-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/mgrs.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/mgrs.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/mgrs.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/polarst.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/polarst.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/polarst.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/tranmerc.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/tranmerc.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/tranmerc.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/ups.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/ups.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/ups.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/libmgrs/utm.c" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/utm.c.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/libmgrs/utm.c.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/LongestEdge.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/LongestEdge.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/LongestEdge.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/model/Map.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/model/Map.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/model/Map.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/readers/AsciiReader.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/readers/AsciiReader.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/readers/AsciiReader.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/readers/InpReader.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/readers/InpReader.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/readers/InpReader.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/readers/SrtmReader.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/readers/SrtmReader.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/readers/SrtmReader.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/utils/Utils.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/utils/Utils.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/utils/Utils.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/writers/InpWriter.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/writers/InpWriter.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/writers/InpWriter.cpp.o.d"
+  "/root/repo/lonestar/scientific/cpu/longestedge/src/writers/TriangleFormatWriter.cpp" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/writers/TriangleFormatWriter.cpp.o" "gcc" "lonestar/scientific/cpu/longestedge/CMakeFiles/longestedge-cpu.dir/src/writers/TriangleFormatWriter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dist_build/libgalois/CMakeFiles/galois_shmem.dir/DependInfo.cmake"
+  "/root/repo/_dist_build/lonestar/liblonestar/CMakeFiles/lonestar.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
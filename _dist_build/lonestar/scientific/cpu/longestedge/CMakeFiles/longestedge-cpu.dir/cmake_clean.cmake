@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/longestedge-cpu.dir/src/LongestEdge.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/LongestEdge.cpp.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/mgrs.c.o"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/mgrs.c.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/polarst.c.o"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/polarst.c.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/tranmerc.c.o"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/tranmerc.c.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/ups.c.o"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/ups.c.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/utm.c.o"
+  "CMakeFiles/longestedge-cpu.dir/src/libmgrs/utm.c.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/model/Map.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/model/Map.cpp.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/readers/AsciiReader.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/readers/AsciiReader.cpp.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/readers/InpReader.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/readers/InpReader.cpp.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/readers/SrtmReader.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/readers/SrtmReader.cpp.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/utils/Utils.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/utils/Utils.cpp.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/writers/InpWriter.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/writers/InpWriter.cpp.o.d"
+  "CMakeFiles/longestedge-cpu.dir/src/writers/TriangleFormatWriter.cpp.o"
+  "CMakeFiles/longestedge-cpu.dir/src/writers/TriangleFormatWriter.cpp.o.d"
+  "longestedge-cpu"
+  "longestedge-cpu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/longestedge-cpu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
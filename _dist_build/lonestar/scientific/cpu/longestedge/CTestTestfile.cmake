@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/scientific/cpu/longestedge
+# Build directory: /root/repo/_dist_build/lonestar/scientific/cpu/longestedge
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_longest_edge "longestedgeTest")
+set_tests_properties(test_longest_edge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/lonestar/scientific/cpu/longestedge/CMakeLists.txt;17;add_test;/root/repo/lonestar/scientific/cpu/longestedge/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-countlevels.dir/CountLevels.cpp.o"
+  "CMakeFiles/example-countlevels.dir/CountLevels.cpp.o.d"
+  "example-countlevels"
+  "example-countlevels.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-countlevels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-graph-traversal-serial.dir/GraphTraversalSerial.cpp.o"
+  "CMakeFiles/example-graph-traversal-serial.dir/GraphTraversalSerial.cpp.o.d"
+  "example-graph-traversal-serial"
+  "example-graph-traversal-serial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-graph-traversal-serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
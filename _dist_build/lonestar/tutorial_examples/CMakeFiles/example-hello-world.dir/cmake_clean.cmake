@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-hello-world.dir/HelloWorld.cpp.o"
+  "CMakeFiles/example-hello-world.dir/HelloWorld.cpp.o.d"
+  "example-hello-world"
+  "example-hello-world.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-hello-world.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
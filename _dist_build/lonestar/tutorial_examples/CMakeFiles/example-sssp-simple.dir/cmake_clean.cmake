@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-sssp-simple.dir/SSSPsimple.cpp.o"
+  "CMakeFiles/example-sssp-simple.dir/SSSPsimple.cpp.o.d"
+  "example-sssp-simple"
+  "example-sssp-simple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-sssp-simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
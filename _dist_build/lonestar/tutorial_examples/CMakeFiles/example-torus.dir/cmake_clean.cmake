@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-torus.dir/Torus.cpp.o"
+  "CMakeFiles/example-torus.dir/Torus.cpp.o.d"
+  "example-torus"
+  "example-torus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-torus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
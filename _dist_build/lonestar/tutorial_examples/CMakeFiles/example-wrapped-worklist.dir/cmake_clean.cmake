@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/example-wrapped-worklist.dir/ExampleWrappedWorklist.cpp.o"
+  "CMakeFiles/example-wrapped-worklist.dir/ExampleWrappedWorklist.cpp.o.d"
+  "example-wrapped-worklist"
+  "example-wrapped-worklist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example-wrapped-worklist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/lonestar/tutorial_examples
+# Build directory: /root/repo/_dist_build/lonestar/tutorial_examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run-small-example-hello-world-1 "/root/repo/_dist_build/lonestar/tutorial_examples/example-hello-world" "2" "10" "-t" "1")
+set_tests_properties(run-small-example-hello-world-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;24;add_test_scale;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;0;")
+add_test(run-small-example-torus-1 "/root/repo/_dist_build/lonestar/tutorial_examples/example-torus" "2" "100" "-t" "1")
+set_tests_properties(run-small-example-torus-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;25;add_test_scale;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;0;")
+add_test(run-small-example-torus-improved-1 "/root/repo/_dist_build/lonestar/tutorial_examples/example-torus-improved" "2" "100" "-t" "1")
+set_tests_properties(run-small-example-torus-improved-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;26;add_test_scale;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;0;")
+add_test(run-small1-example-spanningtree-1 "/root/repo/_dist_build/lonestar/tutorial_examples/example-spanningtree" "/root/repo/_dist_build/inputs/reference/structured/rome99.gr" "-t" "1")
+set_tests_properties(run-small1-example-spanningtree-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;27;add_test_scale;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;0;")
+add_test(run-small2-example-spanningtree-1 "/root/repo/_dist_build/lonestar/tutorial_examples/example-spanningtree" "/root/repo/_dist_build/inputs/scalefree/rmat10.gr" "-t" "1")
+set_tests_properties(run-small2-example-spanningtree-1 PROPERTIES  ENVIRONMENT "GALOIS_DO_NOT_BIND_THREADS=1" LABELS "quick" _BACKTRACE_TRIPLES "/root/repo/lonestar/CMakeLists.txt;17;add_test;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;28;add_test_scale;/root/repo/lonestar/tutorial_examples/CMakeLists.txt;0;")
@@ -0,0 +1,9 @@
+#!/bin/bash
+
+scriptsDir=$(dirname $0)
+
+source $scriptsDir/buildFunc.sh
+
+galoisBuildMultiCompiler
+
+
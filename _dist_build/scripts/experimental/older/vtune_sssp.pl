@@ -0,0 +1,5 @@
+#!/usr/bin/perl
+
+require "backend.pl";
+
+vtune_prog("../apps/sssp/sssp /net/faraday/workspace/inputs/weighted/random4-24.structure 1 2");
@@ -0,0 +1,10 @@
+#!/bin/bash
+
+# This script was obtained from: https://stackoverflow.com/a/42544963
+
+git rev-list --objects --all \
+  | git cat-file --batch-check='%(objecttype) %(objectname) %(objectsize) %(rest)' \
+  | sed -n 's/^blob //p' \
+  | sort --numeric-sort --key=2 \
+  | cut -c 1-12,41- \
+  | numfmt --field=2 --to=iec-i --suffix=B --padding=7 --round=nearest
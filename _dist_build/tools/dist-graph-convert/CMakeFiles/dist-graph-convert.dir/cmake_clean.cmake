@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dist-graph-convert.dir/dist-graph-convert-helpers.cpp.o"
+  "CMakeFiles/dist-graph-convert.dir/dist-graph-convert-helpers.cpp.o.d"
+  "CMakeFiles/dist-graph-convert.dir/dist-graph-convert.cpp.o"
+  "CMakeFiles/dist-graph-convert.dir/dist-graph-convert.cpp.o.d"
+  "dist-graph-convert"
+  "dist-graph-convert.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dist-graph-convert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -65,6 +65,31 @@ public:
   void saveGIDToHost(std::vector<std::pair<uint64_t, uint64_t>>& gid2host) {
     _gid2host = gid2host;
   }
+
+  /**
+   * Number of passes the master assignment phase makes over the locally
+   * read nodes; only restreaming policies make more than one.
+   */
+  uint32_t numStreamPasses() const { return 1; }
+
+  /**
+   * Serialize the state needed to answer master queries without going
+   * through partitioning again (used by saved local graphs).
+   *
+   * @param buf Buffer to serialize into
+   */
+  void serializePartitioner(galois::runtime::SendBuffer& buf) const {
+    galois::runtime::gSerialize(buf, _gid2host);
+  }
+
+  /**
+   * Restore state written by serializePartitioner.
+   *
+   * @param buf Buffer to deserialize from
+   */
+  void deserializePartitioner(galois::runtime::RecvBuffer& buf) {
+    galois::runtime::gDeserialize(buf, _gid2host);
+  }
 };
 
 /**
@@ -264,6 +289,44 @@ public:
     _status = 1;
   }
 
+  /**
+   * Serialize the master assignment in addition to the read assignment.
+   *
+   * @param buf Buffer to serialize into
+   */
+  void serializePartitioner(galois::runtime::SendBuffer& buf) const {
+    PartitioningScaffold::serializePartitioner(buf);
+    // unordered maps aren't serializable; send as key and value vectors
+    std::vector<uint64_t> gids;
+    std::vector<uint32_t> masters;
+    gids.reserve(_gid2masters.size());
+    masters.reserve(_gid2masters.size());
+    for (auto& gidMaster : _gid2masters) {
+      gids.push_back(gidMaster.first);
+      masters.push_back(gidMaster.second);
+    }
+    galois::runtime::gSerialize(buf, _status, _localNodeToMaster, _nodeOffset,
+                                gids, masters);
+  }
+
+  /**
+   * Restore state written by serializePartitioner.
+   *
+   * @param buf Buffer to deserialize from
+   */
+  void deserializePartitioner(galois::runtime::RecvBuffer& buf) {
+    PartitioningScaffold::deserializePartitioner(buf);
+    std::vector<uint64_t> gids;
+    std::vector<uint32_t> masters;
+    galois::runtime::gDeserialize(buf, _status, _localNodeToMaster,
+                                  _nodeOffset, gids, masters);
+    _gid2masters.clear();
+    _gid2masters.reserve(gids.size());
+    for (size_t i = 0; i < gids.size(); ++i) {
+      _gid2masters[gids[i]] = masters[i];
+    }
+  }
+
   //! Returns true as policies that inherit from this should define master
   //! assignment function
   bool masterAssignPhase() const { return true; }
@@ -29,12 +29,20 @@
 
 #include <unordered_map>
 #include <fstream>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "galois/graphs/LC_CSR_Graph.h"
 #include "galois/graphs/BufferedGraph.h"
 #include "galois/runtime/DistStats.h"
 #include "galois/graphs/OfflineGraph.h"
 #include "galois/DynamicBitset.h"
+#include "galois/DReducible.h"
 
 /*
  * Headers for boost serialization
@@ -91,6 +99,57 @@ private:
   //! Like specificRanges, but for in edges
   std::vector<NodeRangeType> specificRangesIn;
 
+  //! Read-only memory mapping of a saved local graph file
+  struct LocalGraphMapping {
+    void* base = nullptr;
+    size_t size = 0;
+
+    ~LocalGraphMapping() {
+      if (base) {
+        munmap(base, size);
+      }
+    }
+  };
+
+  //! Fixed-size start of a saved local graph file; array sections follow at
+  //! the recorded (page aligned) offsets
+  struct LocalGraphHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t hostID;
+    uint32_t numHosts;
+    uint32_t numNodes;
+    uint32_t numOwned;
+    uint32_t beginMaster;
+    uint32_t numNodesWithEdges;
+    uint32_t transposed;
+    uint64_t edgeDataSize;
+    uint64_t numEdges;
+    uint64_t numGlobalNodes;
+    uint64_t numGlobalEdges;
+    uint64_t edgeIndOffset;
+    uint64_t edgeDstOffset;
+    uint64_t edgeDataOffset;
+    uint64_t localToGlobalOffset;
+    uint64_t metadataOffset;
+    uint64_t metadataSize;
+    uint64_t fileSize;
+  };
+
+  //! First bytes of a saved local graph ("GLOCALGR")
+  constexpr static uint64_t localGraphMagic = 0x52474c41434f4c47;
+  //! Current version of the saved local graph format
+  constexpr static uint32_t localGraphVersion = 1;
+
+  //! Rounds a file offset up to the alignment of sections in a saved graph
+  static uint64_t alignLocalGraphOffset(uint64_t offset) {
+    constexpr uint64_t align = 4096;
+    return (offset + align - 1) / align * align;
+  }
+
+  //! Must be declared before graph: graph may point into the mapping
+  LocalGraphMapping localGraphMapping;
+
 protected:
   //! The internal graph used by DistGraph to represent the graph
   GraphTy graph;
@@ -536,6 +595,15 @@ private:
   virtual std::pair<unsigned, unsigned> cartesianGridImpl() const {
     return std::make_pair(0u, 0u);
   }
+  //! Identifies the partitioning policy in saved local graphs
+  virtual std::string partitionPolicyImpl() const { return ""; }
+  //! Appends what the partitioner needs to answer master queries to a
+  //! saved local graph
+  virtual void savePartitionerImpl(galois::runtime::SendBuffer&) const {}
+  //! Restores the partitioner from a saved local graph
+  virtual void loadPartitionerImpl(galois::runtime::RecvBuffer&) {
+    GALOIS_DIE("this graph type cannot be read from a local graph file");
+  }
 
 public:
   virtual ~DistGraph() {}
@@ -847,19 +915,265 @@ protected:
 
 public:
   /**
-   * Write the local LC_CSR graph to the file on a disk.
+   * Compute and report the quality of this partitioning. Each host reports
+   * its master, mirror and edge counts and its number of communication
+   * partners (hosts it shares a master or mirror proxy with); host 0
+   * reports the replication factor and the master and edge imbalance (max
+   * over mean) and prints a summary. Collective: all hosts must call this.
+   */
+  void reportPartitionQuality() {
+    auto& net = galois::runtime::getSystemNetworkInterface();
+
+    // tell each host how many of its masters have a mirror here
+    for (unsigned h = 0; h < numHosts; ++h) {
+      if (h == id) {
+        continue;
+      }
+      galois::runtime::SendBuffer b;
+      galois::runtime::gSerialize(b, (uint64_t)mirrorNodes[h].size());
+      net.sendTagged(h, galois::runtime::evilPhase, b);
+    }
+    std::vector<uint64_t> mastersMirroredOn(numHosts, 0);
+    for (unsigned h = 0; h < numHosts - 1; ++h) {
+      decltype(net.recieveTagged(galois::runtime::evilPhase, nullptr)) p;
+      do {
+        p = net.recieveTagged(galois::runtime::evilPhase, nullptr);
+      } while (!p);
+      galois::runtime::gDeserialize(p->second, mastersMirroredOn[p->first]);
+    }
+    increment_evilPhase();
+
+    uint64_t numMirrors = numNodes - numOwned;
+    uint32_t partners   = 0;
+    for (unsigned h = 0; h < numHosts; ++h) {
+      if (h != id && (mirrorNodes[h].size() || mastersMirroredOn[h])) {
+        partners++;
+      }
+    }
+
+    // max over hosts; per host values with PRINT_PER_HOST_STATS
+    galois::runtime::reportStat_Tmax(GRNAME, "PartitionMasters", numOwned);
+    galois::runtime::reportStat_Tmax(GRNAME, "PartitionMirrors", numMirrors);
+    galois::runtime::reportStat_Tmax(GRNAME, "PartitionEdges", numEdges);
+    galois::runtime::reportStat_Tmax(GRNAME, "PartitionCommPartners",
+                                     partners);
+
+    galois::DGAccumulator<uint64_t> totalProxies;
+    galois::DGReduceMax<uint64_t> maxMasters;
+    galois::DGReduceMax<uint64_t> maxEdges;
+    totalProxies.reset();
+    totalProxies += numNodes;
+    maxMasters.update(numOwned);
+    maxEdges.update(numEdges);
+
+    uint64_t mostEdges   = maxEdges.reduce();
+    double replication   = (double)totalProxies.reduce() / numGlobalNodes;
+    double meanMasters   = (double)numGlobalNodes / numHosts;
+    double meanEdges     = (double)numGlobalEdges / numHosts;
+    double masterBalance = maxMasters.reduce() / meanMasters;
+    double edgeBalance   = numGlobalEdges ? mostEdges / meanEdges : 1.0;
+
+    if (id == 0) {
+      galois::runtime::reportStat_Single(GRNAME, "PartitionReplicationFactor",
+                                         replication);
+      galois::runtime::reportStat_Single(GRNAME, "PartitionMasterImbalance",
+                                         masterBalance);
+      galois::runtime::reportStat_Single(GRNAME, "PartitionEdgeImbalance",
+                                         edgeBalance);
+      galois::gPrint("Partition quality: replication factor ", replication,
+                     ", master imbalance ", masterBalance,
+                     ", edge imbalance ", edgeBalance, "\n");
+    }
+  }
+
+  /**
+   * Write this host's partition to <localGraphFileName>_<host id> so that
+   * later runs with the same number of hosts and partitioning policy can
+   * read it instead of partitioning the input again.
    *
-   * @todo revive this
+   * The file holds a versioned header, the local CSR arrays, the local to
+   * global id map (the global to local map is rebuilt from it), the read
+   * assignment, the mirror lists (masters are the contiguous local ids
+   * recorded in the header), and the partitioner's master assignment. Node
+   * data is not saved.
+   *
+   * @param localGraphFileName prefix of the file to write
    */
-  void save_local_graph_to_file(std::string) { GALOIS_DIE("not implemented"); }
+  void save_local_graph_to_file(std::string localGraphFileName) {
+    static_assert(std::is_void<EdgeTy>::value ||
+                      std::is_trivially_copyable<EdgeTy>::value,
+                  "saved local graphs need trivially copyable edge data");
+    galois::StatTimer saveTimer("SaveLocalGraphTime", GRNAME);
+    saveTimer.start();
+
+    galois::runtime::SendBuffer metadata;
+    galois::runtime::gSerialize(metadata, partitionPolicyImpl(), gid2host,
+                                mirrorNodes);
+    savePartitionerImpl(metadata);
+
+    LocalGraphHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic             = localGraphMagic;
+    header.version           = localGraphVersion;
+    header.hostID            = id;
+    header.numHosts          = numHosts;
+    header.numNodes          = numNodes;
+    header.numOwned          = numOwned;
+    header.beginMaster       = beginMaster;
+    header.numNodesWithEdges = numNodesWithEdges;
+    header.transposed        = transposed;
+    header.edgeDataSize      = galois::LargeArray<EdgeTy>::size_of::value;
+    header.numEdges          = numEdges;
+    header.numGlobalNodes    = numGlobalNodes;
+    header.numGlobalEdges    = numGlobalEdges;
+
+    // each section starts page aligned so that it can be used in place
+    // once mapped
+    header.edgeIndOffset = alignLocalGraphOffset(sizeof(header));
+    header.edgeDstOffset = alignLocalGraphOffset(
+        header.edgeIndOffset + numNodes * sizeof(uint64_t));
+    header.edgeDataOffset = alignLocalGraphOffset(
+        header.edgeDstOffset + numEdges * sizeof(uint32_t));
+    header.localToGlobalOffset = alignLocalGraphOffset(
+        header.edgeDataOffset + numEdges * header.edgeDataSize);
+    header.metadataOffset = alignLocalGraphOffset(
+        header.localToGlobalOffset + numNodes * sizeof(uint64_t));
+    header.metadataSize = metadata.size();
+    header.fileSize     = header.metadataOffset + header.metadataSize;
+
+    std::string fileName = localGraphFileName + "_" + std::to_string(id);
+    std::ofstream out(fileName + ".tmp", std::ios::binary);
+    auto writeAt = [&](uint64_t offset, const void* data, size_t bytes) {
+      out.seekp(offset);
+      out.write(reinterpret_cast<const char*>(data), bytes);
+    };
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.edgeIndOffset, graph.edgeIndexArray(),
+            numNodes * sizeof(uint64_t));
+    writeAt(header.edgeDstOffset, graph.edgeDstArray(),
+            numEdges * sizeof(uint32_t));
+    writeAt(header.edgeDataOffset, graph.edgeDataArray(),
+            numEdges * header.edgeDataSize);
+    writeAt(header.localToGlobalOffset, localToGlobalVector.data(),
+            numNodes * sizeof(uint64_t));
+    writeAt(header.metadataOffset, metadata.linearData(), metadata.size());
+    out.close();
+    if (!out) {
+      GALOIS_DIE("could not write local graph ", fileName);
+    }
+    // a partially written file never has the final name
+    if (std::rename((fileName + ".tmp").c_str(), fileName.c_str()) != 0) {
+      GALOIS_DIE("could not rename local graph ", fileName);
+    }
+
+    saveTimer.stop();
+    galois::gPrint("[", id, "] Saved local graph to ", fileName, "\n");
+  }
 
   /**
-   * Read the local LC_CSR graph from the file on a disk.
+   * Read this host's partition from <localGraphFileName>_<host id>, written
+   * by save_local_graph_to_file. The CSR arrays are used in place from a
+   * private memory mapping (pages are read on first touch and copied only
+   * if written to); the rest of the metadata is copied out in parallel.
+   *
+   * Dies if the file was written by a different host id, host count, file
+   * format version, edge data size, or partitioning policy.
    *
-   * @todo revive this
+   * @param localGraphFileName prefix of the file to read
    */
-  void read_local_graph_from_file(std::string) {
-    GALOIS_DIE("not implemented");
+  void read_local_graph_from_file(std::string localGraphFileName) {
+    static_assert(std::is_void<EdgeTy>::value ||
+                      std::is_trivially_copyable<EdgeTy>::value,
+                  "saved local graphs need trivially copyable edge data");
+    std::string fileName = localGraphFileName + "_" + std::to_string(id);
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd == -1) {
+      GALOIS_SYS_DIE("could not open local graph ", fileName);
+    }
+    struct stat buf;
+    if (fstat(fd, &buf) == -1) {
+      GALOIS_SYS_DIE("could not stat local graph ", fileName);
+    }
+    size_t fileSize = buf.st_size;
+    if (fileSize < sizeof(LocalGraphHeader)) {
+      GALOIS_DIE("local graph ", fileName, " is truncated");
+    }
+    void* base =
+        mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+      GALOIS_SYS_DIE("could not map local graph ", fileName);
+    }
+    localGraphMapping.base = base;
+    localGraphMapping.size = fileSize;
+    char* bytes            = static_cast<char*>(base);
+
+    LocalGraphHeader header;
+    std::memcpy(&header, bytes, sizeof(header));
+    if (header.magic != localGraphMagic) {
+      GALOIS_DIE(fileName, " is not a saved local graph");
+    }
+    if (header.version != localGraphVersion) {
+      GALOIS_DIE("local graph ", fileName, " has format version ",
+                 header.version, "; expected ", localGraphVersion);
+    }
+    if (header.fileSize != fileSize) {
+      GALOIS_DIE("local graph ", fileName, " is truncated");
+    }
+    if (header.hostID != id || header.numHosts != numHosts) {
+      GALOIS_DIE("local graph ", fileName, " was saved by host ",
+                 header.hostID, " of ", header.numHosts, "; this is host ", id,
+                 " of ", numHosts);
+    }
+    if (header.edgeDataSize != galois::LargeArray<EdgeTy>::size_of::value) {
+      GALOIS_DIE("local graph ", fileName, " has ", header.edgeDataSize,
+                 " byte edge data; expected ",
+                 galois::LargeArray<EdgeTy>::size_of::value);
+    }
+
+    galois::runtime::RecvBuffer metadata(bytes + header.metadataOffset,
+                                         bytes + header.fileSize);
+    std::string policy;
+    galois::runtime::gDeserialize(metadata, policy, gid2host, mirrorNodes);
+    if (policy != partitionPolicyImpl()) {
+      GALOIS_DIE("local graph ", fileName, " was partitioned with ", policy,
+                 "; this run uses ", partitionPolicyImpl());
+    }
+
+    numNodes          = header.numNodes;
+    numEdges          = header.numEdges;
+    numOwned          = header.numOwned;
+    beginMaster       = header.beginMaster;
+    numNodesWithEdges = header.numNodesWithEdges;
+    transposed        = header.transposed;
+    numGlobalNodes    = header.numGlobalNodes;
+    numGlobalEdges    = header.numGlobalEdges;
+    loadPartitionerImpl(metadata);
+
+    graph.allocateFromExisting(
+        numNodes, numEdges,
+        reinterpret_cast<uint64_t*>(bytes + header.edgeIndOffset),
+        reinterpret_cast<uint32_t*>(bytes + header.edgeDstOffset),
+        bytes + header.edgeDataOffset);
+    graph.constructNodes();
+
+    const uint64_t* localToGlobal =
+        reinterpret_cast<const uint64_t*>(bytes + header.localToGlobalOffset);
+    localToGlobalVector.resize(numNodes);
+    galois::do_all(
+        galois::iterate(uint32_t{0}, numNodes),
+        [&](uint32_t lid) { localToGlobalVector[lid] = localToGlobal[lid]; },
+        galois::no_stats());
+    globalToLocalMap.reserve(numNodes);
+    for (uint32_t lid = 0; lid < numNodes; ++lid) {
+      globalToLocalMap[localToGlobalVector[lid]] = lid;
+    }
+
+    determineThreadRanges();
+    determineThreadRangesMaster();
+    determineThreadRangesWithEdges();
+    initializeSpecificRanges();
   }
 
   /**
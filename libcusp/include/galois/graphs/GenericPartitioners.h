@@ -5,6 +5,7 @@
 #include "BasePolicies.h"
 #include <utility>
 #include <cmath>
+#include <algorithm>
 #include <limits>
 
 class NoCommunication : public galois::graphs::ReadMasterAssignment {
@@ -905,4 +906,188 @@ public:
   }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+
+//! Tunables shared by the restreaming edge-cut policies; set before
+//! partitioning
+struct RestreamOptions {
+  //! Total passes over the locally read nodes (the first is a normal stream)
+  static inline uint32_t passes = 3;
+  //! Allowed node and edge load above a perfectly balanced partition
+  static inline double imbalance = 0.1;
+};
+
+//! Scoring function used by RestreamP
+enum class RestreamObjective {
+  LDG,   //!< linear deterministic greedy
+  FENNEL //!< Fennel with Ginger's composite node/edge load
+};
+
+/**
+ * Restreaming edge cut: the first pass is a single streaming pass like
+ * FennelP; later passes re-stream the same nodes knowing every neighbor's
+ * assignment from the previous pass and move nodes whose score improved.
+ * Unlike FennelP, high degree nodes are scored as well and every host is
+ * held to a capacity of (1 + imbalance) times its fair share of both nodes
+ * and edges.
+ */
+template <RestreamObjective Objective>
+class RestreamP : public galois::graphs::CustomMasterAssignment {
+  uint32_t _passes;
+  // fennel scoring constants
+  double _gamma;
+  double _alpha;
+  // ginger node/edge ratio
+  double _neRatio;
+  // hard balance constraints
+  double _nodeCapacity;
+  double _edgeCapacity;
+
+  /**
+   * Returns how full a host is relative to its node and edge capacity
+   * (whichever is fuller)
+   */
+  double getFill(uint64_t hostNodeLoad, uint64_t hostEdgeLoad) const {
+    return std::max(hostNodeLoad / _nodeCapacity,
+                    hostEdgeLoad / _edgeCapacity);
+  }
+
+  /**
+   * Scores placing a node with the given number of neighbors on a host
+   */
+  double getScore(double neighbors, uint64_t hostNodeLoad,
+                  uint64_t hostEdgeLoad) const {
+    if (Objective == RestreamObjective::LDG) {
+      return neighbors * (1.0 - getFill(hostNodeLoad, hostEdgeLoad));
+    } else {
+      double param = (hostNodeLoad + (_neRatio * hostEdgeLoad)) / 2;
+      return neighbors - _alpha * _gamma * pow(param, _gamma - 1);
+    }
+  }
+
+public:
+  RestreamP(uint32_t hostID, uint32_t numHosts, uint64_t numNodes,
+            uint64_t numEdges)
+      : galois::graphs::CustomMasterAssignment(hostID, numHosts, numNodes,
+                                               numEdges) {
+    _passes  = std::max(RestreamOptions::passes, 1u);
+    _gamma   = 1.5;
+    _alpha   = numEdges * pow(numHosts, _gamma - 1.0) / pow(numNodes, _gamma);
+    _neRatio = (double)numNodes / (double)numEdges;
+    _nodeCapacity =
+        std::max((1.0 + RestreamOptions::imbalance) * numNodes / numHosts, 1.0);
+    _edgeCapacity =
+        std::max((1.0 + RestreamOptions::imbalance) * numEdges / numHosts, 1.0);
+  }
+
+  uint32_t numStreamPasses() const { return _passes; }
+
+  template <typename EdgeTy>
+  uint32_t getMaster(uint32_t src,
+                     galois::graphs::BufferedGraph<EdgeTy>& bufGraph,
+                     const std::vector<uint32_t>& localNodeToMaster,
+                     std::unordered_map<uint64_t, uint32_t>& gid2offsets,
+                     const std::vector<uint64_t>& nodeLoads,
+                     std::vector<galois::CopyableAtomic<uint64_t>>& nodeAccum,
+                     const std::vector<uint64_t>& edgeLoads,
+                     std::vector<galois::CopyableAtomic<uint64_t>>& edgeAccum) {
+    auto ii = bufGraph.edgeBegin(src);
+    auto ee = bufGraph.edgeEnd(src);
+    // number of edges
+    uint64_t ne = std::distance(ii, ee);
+
+    // when restreaming, take this node's previous placement out of the loads
+    // before scoring it again (accumulations may wrap; the sums won't)
+    uint32_t previous = localNodeToMaster[src - bufGraph.getNodeOffset()];
+    if (previous != (uint32_t)-1) {
+      galois::atomicSubtract(nodeAccum[previous], (uint64_t)1);
+      galois::atomicSubtract(edgeAccum[previous], ne);
+    }
+
+    galois::PODResizeableArray<double> neighbors;
+    neighbors.resize(_numHosts);
+    for (unsigned i = 0; i < _numHosts; i++) {
+      neighbors[i] = 0.0;
+    }
+
+    for (; ii < ee; ++ii) {
+      uint64_t dst         = bufGraph.edgeDestination(*ii);
+      size_t offsetIntoMap = (unsigned)-1;
+
+      auto it = gid2offsets.find(dst);
+      if (it != gid2offsets.end()) {
+        offsetIntoMap = it->second;
+      } else {
+        // determine offset
+        offsetIntoMap = dst - bufGraph.getNodeOffset();
+      }
+
+      assert(offsetIntoMap != (unsigned)-1);
+      assert(offsetIntoMap < localNodeToMaster.size());
+
+      unsigned currentAssignment = localNodeToMaster[offsetIntoMap];
+      if (currentAssignment != (unsigned)-1) {
+        neighbors[currentAssignment] += 1.0;
+      }
+    }
+
+    // best host that stays within capacity; ties go to the previous host
+    // (to avoid oscillating between passes), then to the emptier host
+    unsigned bestHost     = -1;
+    double bestScore      = std::numeric_limits<double>::lowest();
+    double bestFill       = std::numeric_limits<double>::max();
+    unsigned emptiestHost = 0;
+    double emptiestFill   = std::numeric_limits<double>::max();
+    for (unsigned i = 0; i < _numHosts; i++) {
+      uint64_t hostNodeLoad = nodeLoads[i] + nodeAccum[i].load();
+      uint64_t hostEdgeLoad = edgeLoads[i] + edgeAccum[i].load();
+      double fill           = getFill(hostNodeLoad, hostEdgeLoad);
+      if (fill < emptiestFill) {
+        emptiestFill = fill;
+        emptiestHost = i;
+      }
+      if (hostNodeLoad + 1 > _nodeCapacity ||
+          hostEdgeLoad + ne > _edgeCapacity) {
+        continue;
+      }
+
+      double score = getScore(neighbors[i], hostNodeLoad, hostEdgeLoad);
+      if (score > bestScore ||
+          (score == bestScore && bestHost != previous &&
+           (i == previous || fill < bestFill))) {
+        bestScore = score;
+        bestFill  = fill;
+        bestHost  = i;
+      }
+    }
+    // nothing has room (e.g. a node with more edges than a host may hold)
+    if (bestHost == (unsigned)-1) {
+      bestHost = emptiestHost;
+    }
+
+    galois::atomicAdd(nodeAccum[bestHost], (uint64_t)1);
+    galois::atomicAdd(edgeAccum[bestHost], ne);
+
+    return bestHost;
+  }
+
+  // restreaming is an edge cut: all edges on source
+  uint32_t getEdgeOwner(uint32_t src, uint32_t, uint64_t) const {
+    return retrieveMaster(src);
+  }
+
+  bool noCommunication() { return false; }
+  bool isVertexCut() const { return false; }
+  void serializePartition(boost::archive::binary_oarchive&) {}
+  void deserializePartition(boost::archive::binary_iarchive&) {}
+  std::pair<unsigned, unsigned> cartesianGrid() {
+    return std::make_pair(0u, 0u);
+  }
+};
+
+//! Restreaming linear deterministic greedy edge cut
+using LDGRestreamP = RestreamP<RestreamObjective::LDG>;
+//! Restreaming Fennel edge cut
+using FennelRestreamP = RestreamP<RestreamObjective::FENNEL>;
+
 #endif
@@ -31,6 +31,7 @@
 #include "galois/DReducible.h"
 #include <optional>
 #include <sstream>
+#include <typeinfo>
 
 #define CUSP_PT_TIMER 0
 
@@ -106,6 +107,18 @@ private:
   virtual std::pair<unsigned, unsigned> cartesianGridImpl() const {
     return graphPartitioner->cartesianGrid();
   }
+  virtual std::string partitionPolicyImpl() const {
+    return typeid(Partitioner).name();
+  }
+  virtual void savePartitionerImpl(galois::runtime::SendBuffer& buf) const {
+    graphPartitioner->serializePartitioner(buf);
+  }
+  virtual void loadPartitionerImpl(galois::runtime::RecvBuffer& buf) {
+    graphPartitioner = std::make_unique<Partitioner>(
+        base_DistGraph::id, base_DistGraph::numHosts,
+        base_DistGraph::numGlobalNodes, base_DistGraph::numGlobalEdges);
+    graphPartitioner->deserializePartitioner(buf);
+  }
 
 public:
   /**
@@ -174,7 +187,19 @@ public:
                      "] Reading local graph from file ", localGraphFileName,
                      "\n");
       base_DistGraph::read_local_graph_from_file(localGraphFileName);
+      // only the header of the input is read to check that it is the graph
+      // that was partitioned
+      galois::graphs::OfflineGraph g(filename);
+      if (g.size() != base_DistGraph::numGlobalNodes ||
+          g.sizeEdges() != base_DistGraph::numGlobalEdges ||
+          transpose != base_DistGraph::transposed) {
+        GALOIS_DIE("local graph ", localGraphFileName,
+                   " was not partitioned from ", filename,
+                   transpose ? " (transposed)" : "");
+      }
       Tgraph_construct.stop();
+      galois::gPrint("[", base_DistGraph::id,
+                     "] Graph construction complete.\n");
       return;
     }
 
@@ -1444,6 +1469,66 @@ private:
       base_DistGraph::increment_evilPhase();
     }
 
+    // restreaming policies make more passes over the same nodes now that
+    // every neighbor has an assignment; these passes are always BSP
+    uint32_t numPasses = graphPartitioner->numStreamPasses();
+    for (uint32_t pass = 1; pass < numPasses; pass++) {
+      galois::StatTimer restreamTimer("Phase0RestreamTime", GRNAME);
+      restreamTimer.start();
+      galois::GAccumulator<uint64_t> moved;
+
+      for (unsigned syncRound = 0; syncRound < stateRounds; syncRound++) {
+        uint32_t beginNode;
+        uint32_t endNode;
+        std::tie(beginNode, endNode) = galois::block_range(
+            globalOffset, base_DistGraph::gid2host[base_DistGraph::id].second,
+            syncRound, stateRounds);
+
+        std::vector<uint32_t> rangeVec;
+        auto work =
+            getSpecificThreadRange(bufGraph, rangeVec, beginNode, endNode);
+
+        galois::do_all(
+            galois::iterate(work),
+            [&](uint32_t node) {
+              uint32_t previous = localNodeToMaster[node - globalOffset];
+              uint32_t assignedHost = graphPartitioner->getMaster(
+                  node, bufGraph, localNodeToMaster, gid2offsets, nodeLoads,
+                  nodeAccum, edgeLoads, edgeAccum);
+              assert(assignedHost != (uint32_t)-1);
+              if (assignedHost != previous) {
+                moved += 1;
+              }
+              localNodeToMaster[node - globalOffset] = assignedHost;
+            },
+            galois::loopname("Phase0RestreamMasters"), galois::steal(),
+            galois::no_stats());
+
+        syncAssignment(beginNode - globalOffset, endNode - globalOffset,
+                       numLocalNodes, localNodeToMaster, syncNodes,
+                       gid2offsets);
+        syncLoad(nodeLoads, nodeAccum);
+        syncLoad(edgeLoads, edgeAccum);
+      }
+      restreamTimer.stop();
+
+      galois::DGAccumulator<uint64_t> movedSyncer;
+      movedSyncer.reset();
+      movedSyncer += moved.reduce();
+      uint64_t totalMoved = movedSyncer.reduce();
+      if (base_DistGraph::id == 0) {
+        galois::gPrint("Restream pass ", pass, " moved ", totalMoved,
+                       " nodes\n");
+        galois::runtime::reportStat_Single(
+            GRNAME, "Phase0RestreamMoved_" + std::to_string(pass),
+            totalMoved);
+      }
+      if (pass + 1 == numPasses || totalMoved == 0) {
+        base_DistGraph::increment_evilPhase();
+        break;
+      }
+    }
+
     galois::gPrint("[", base_DistGraph::id,
                    "] Local master assignment "
                    "complete.\n");
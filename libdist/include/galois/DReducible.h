@@ -21,14 +21,18 @@
  * @file DReducible.h
  *
  * Implements distributed reducible objects for easy reduction of values
- * across a distributed system.
+ * across a distributed system. Scalars are reduced with an all-reduce of the
+ * communication library; arrays, top-k lists and quantile sketches are merged
+ * over a tree of hosts through the network interface.
  */
 #ifndef GALOIS_DISTACCUMULATOR_H
 #define GALOIS_DISTACCUMULATOR_H
 
 #include <limits>
+#include <vector>
 #include "galois/Galois.h"
 #include "galois/Reduction.h"
+#include "galois/VectorReduction.h"
 #include "galois/AtomicHelpers.h"
 #include "galois/runtime/LWCI.h"
 #include "galois/runtime/DistStats.h"
@@ -459,5 +463,302 @@ public:
   }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+
+namespace internal {
+
+/**
+ * All-reduce of a serializable value over a binomial tree of hosts. Each host
+ * merges the values of its children into its own and sends the result to its
+ * parent; host 0 then sends the final value back down the same tree. A host
+ * handles O(log(hosts)) messages instead of host 0 receiving from every host.
+ * Children are merged in a fixed order, so every host gets the same result.
+ *
+ * @param value local value to reduce; overwritten with the reduced value
+ * @param merge merge(T& into, T&& from) merges from into into
+ */
+template <typename T, typename MergeFn>
+void treeAllReduce(T& value, MergeFn merge) {
+  auto& net      = galois::runtime::getSystemNetworkInterface();
+  unsigned id    = net.ID;
+  unsigned num   = net.Num;
+  uint32_t phase = galois::runtime::evilPhase;
+
+  // children are id + 2^i for every 2^i below the lowest set bit of id
+  std::vector<unsigned> children;
+  unsigned bit = 1;
+  for (; bit < num && !(id & bit); bit <<= 1) {
+    if (id + bit < num)
+      children.push_back(id + bit);
+  }
+
+  std::vector<T> received(children.size());
+  for (size_t i = 0; i < children.size(); ++i) {
+    decltype(net.recieveTagged(phase, nullptr)) p;
+    do {
+      p = net.recieveTagged(phase, nullptr);
+    } while (!p);
+    size_t c = std::find(children.begin(), children.end(), p->first) -
+               children.begin();
+    assert(c < children.size());
+    unsigned sender;
+    galois::runtime::gDeserialize(p->second, sender, received[c]);
+  }
+  for (T& r : received)
+    merge(value, std::move(r));
+
+  if (id != 0) {
+    galois::runtime::SendBuffer b;
+    galois::runtime::gSerialize(b, id + 1, value); // non-zero message
+    net.sendTagged(id - bit, phase, b);
+    net.flush();
+
+    decltype(net.recieveTagged(phase, nullptr, 1)) p;
+    do {
+      p = net.recieveTagged(phase, nullptr, 1);
+    } while (!p);
+    unsigned sender;
+    galois::runtime::gDeserialize(p->second, sender, value);
+  }
+  for (unsigned c : children) {
+    galois::runtime::SendBuffer b;
+    galois::runtime::gSerialize(b, id + 1, value);
+    net.sendTagged(c, phase, b, 1);
+  }
+  net.flush();
+
+  galois::runtime::evilPhase += 2; // one for reduce and one for broadcast
+  if (galois::runtime::evilPhase >=
+      static_cast<uint32_t>(
+          std::numeric_limits<int16_t>::max())) { // limit defined by MPI or
+                                                  // LCI
+    galois::runtime::evilPhase = 1;
+  }
+}
+
+} // namespace internal
+
+/**
+ * Distributed elementwise reducer for a fixed-size array of Ty: threads
+ * update a GVectorReducible on each host, and the arrays of the hosts are
+ * merged elementwise with MergeFunc over a tree of hosts.
+ *
+ * @tparam Ty type of the elements
+ */
+template <typename Ty, typename MergeFunc, typename IdFunc>
+class DGVectorReducible {
+  galois::GVectorReducible<Ty, MergeFunc, IdFunc> mdata;
+  std::vector<Ty> global_mdata;
+
+public:
+  //! @param n number of elements
+  explicit DGVectorReducible(size_t n = 0)
+      : mdata(n), global_mdata(n, IdFunc()()) {}
+
+  size_t size() const { return mdata.size(); }
+
+  //! Changes the number of elements and resets all of them
+  void resize(size_t n) {
+    mdata.resize(n);
+    global_mdata.assign(n, IdFunc()());
+  }
+
+  //! Merges v into element i of the thread local array
+  void update(size_t i, const Ty& v) { mdata.update(i, v); }
+
+  /**
+   * Read the array reduced over the threads of this host.
+   *
+   * @returns locally reduced array
+   */
+  const std::vector<Ty>& read_local() { return mdata.reduce(); }
+
+  /**
+   * Read the array returned by the last reduce call.
+   *
+   * @returns the array of the last reduce call
+   */
+  const std::vector<Ty>& read() { return global_mdata; }
+
+  //! Reset all elements of the local and reduced arrays
+  void reset() {
+    mdata.reset();
+    std::fill(global_mdata.begin(), global_mdata.end(), IdFunc()());
+  }
+
+  /**
+   * Reduce the arrays of all hosts, save the result, and return it.
+   *
+   * @param runID optional argument used to create a statistics timer
+   * for later reporting
+   *
+   * @returns The reduced array
+   */
+  const std::vector<Ty>& reduce(std::string runID = std::string()) {
+    std::string timer_str("ReduceDGVector_" + runID);
+
+    galois::CondStatTimer<GALOIS_COMM_STATS> reduceTimer(timer_str.c_str(),
+                                                         "DGReducible");
+    reduceTimer.start();
+
+    global_mdata = mdata.reduce();
+    internal::treeAllReduce(
+        global_mdata, [](std::vector<Ty>& into, std::vector<Ty>&& from) {
+          MergeFunc mergeFn;
+          for (size_t i = 0; i < into.size(); ++i)
+            into[i] = mergeFn(into[i], from[i]);
+        });
+
+    reduceTimer.stop();
+
+    return global_mdata;
+  }
+};
+
+//! Distributed elementwise sum of a fixed-size array
+template <typename Ty>
+using DGVectorAccumulator =
+    DGVectorReducible<Ty, std::plus<Ty>, galois::identity_value_zero<Ty>>;
+
+//! Distributed elementwise max of a fixed-size array
+template <typename Ty>
+using DGVectorReduceMax =
+    DGVectorReducible<Ty, galois::gmax<Ty>, galois::identity_value_min<Ty>>;
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Distributed top-k: the k largest values of Ty under Compare across all
+ * hosts. Each host finds its k largest values with a GTopK, and the sorted
+ * lists are merged pairwise over a tree of hosts, so no host receives more
+ * than O(k log(hosts)) values.
+ *
+ * @tparam Ty type of the values, e.g. a pair of a score and a node ID
+ */
+template <typename Ty, typename Compare = std::less<Ty>>
+class DGTopK {
+  galois::GTopK<Ty, Compare> mdata;
+  std::vector<Ty> global_mdata;
+
+public:
+  explicit DGTopK(size_t k, Compare comp = Compare()) : mdata(k, comp) {}
+
+  //! Adds v to the thread local top-k
+  void update(const Ty& v) { mdata.update(v); }
+
+  /**
+   * Read the values returned by the last reduce call.
+   *
+   * @returns the k largest values, largest first
+   */
+  const std::vector<Ty>& read() { return global_mdata; }
+
+  //! Reset the local and reduced values
+  void reset() {
+    mdata.reset();
+    global_mdata.clear();
+  }
+
+  /**
+   * Reduce the top-k of all hosts, save the result, and return it.
+   *
+   * @param runID optional argument used to create a statistics timer
+   * for later reporting
+   *
+   * @returns the k largest values across all hosts, largest first
+   */
+  const std::vector<Ty>& reduce(std::string runID = std::string()) {
+    std::string timer_str("ReduceDGTopK_" + runID);
+
+    galois::CondStatTimer<GALOIS_COMM_STATS> reduceTimer(timer_str.c_str(),
+                                                         "DGReducible");
+    reduceTimer.start();
+
+    global_mdata = mdata.reduce();
+    internal::treeAllReduce(global_mdata,
+                            [this](std::vector<Ty>& into,
+                                   std::vector<Ty>&& from) {
+                              mdata.mergeSorted(into, from);
+                            });
+
+    reduceTimer.stop();
+
+    return global_mdata;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Distributed approximate quantiles of values of Ty. Each host summarizes its
+ * values in a QuantileSketch, and the sketches are merged over a tree of
+ * hosts; the merged sketch is as accurate as one built from all values.
+ *
+ * @tparam Ty type of the values
+ */
+template <typename Ty>
+class DGQuantiles {
+  size_t k;
+  galois::GQuantiles<Ty> mdata;
+  galois::QuantileSketch<Ty> global_mdata;
+
+public:
+  //! @param _k values per level of the sketches; error shrinks with k
+  explicit DGQuantiles(size_t _k = 256)
+      : k(_k), mdata(_k), global_mdata(_k) {}
+
+  //! Adds v to the thread local sketch
+  void update(const Ty& v) { mdata.update(v); }
+
+  /**
+   * Read the sketch returned by the last reduce call.
+   *
+   * @returns the sketch of the values of all hosts
+   */
+  const galois::QuantileSketch<Ty>& read() { return global_mdata; }
+
+  //! Approximate q-quantile of the last reduce call; see QuantileSketch
+  Ty quantile(double q) { return global_mdata.quantile(q); }
+
+  //! Reset the local and reduced sketches
+  void reset() {
+    mdata.reset();
+    global_mdata.clear();
+  }
+
+  /**
+   * Reduce the sketches of all hosts, save the result, and return it.
+   *
+   * @param runID optional argument used to create a statistics timer
+   * for later reporting
+   *
+   * @returns the sketch of the values of all hosts
+   */
+  const galois::QuantileSketch<Ty>& reduce(std::string runID = std::string()) {
+    std::string timer_str("ReduceDGQuantiles_" + runID);
+
+    galois::CondStatTimer<GALOIS_COMM_STATS> reduceTimer(timer_str.c_str(),
+                                                         "DGReducible");
+    reduceTimer.start();
+
+    std::vector<std::vector<Ty>> levels = mdata.reduce().levels();
+    size_t levelSize                    = k;
+    internal::treeAllReduce(levels, [levelSize](
+                                        std::vector<std::vector<Ty>>& into,
+                                        std::vector<std::vector<Ty>>&& from) {
+      galois::QuantileSketch<Ty> merged(levelSize);
+      merged.merge(into);
+      merged.merge(from);
+      into = merged.levels();
+    });
+    global_mdata.clear();
+    global_mdata.merge(levels);
+
+    reduceTimer.stop();
+
+    return global_mdata;
+  }
+};
+
 } // namespace galois
 #endif
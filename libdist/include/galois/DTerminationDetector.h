@@ -33,12 +33,25 @@
 #include "galois/runtime/LWCI.h"
 #include "galois/runtime/DistStats.h"
 
+#if !defined(GALOIS_USE_LCI) && !defined(GALOIS_USE_BARE_MPI)
+//! Termination is detected by counting messages on the network thread
+//! instead of taking global snapshots
+#define GALOIS_COUNTING_TERMINATION
+#endif
+
 namespace galois {
 
 /**
  * Distributed sum-reducer for getting the sum of some value across multiple
  * hosts.
  *
+ * Used as a termination detector of an asynchronous phase: reduce returns 0
+ * once no host has done work and no message is in flight. With the buffered
+ * network, this is detected by the network thread (see
+ * NetworkInterface::checkTermination) and checking it never blocks or
+ * communicates; otherwise, rounds of non-blocking all-reduce snapshots are
+ * used.
+ *
  * @tparam Ty type of value to max-reduce
  */
 template <typename Ty>
@@ -49,6 +62,7 @@ class DGTerminator {
   galois::GAccumulator<Ty> mdata;
   Ty local_mdata, global_mdata;
 
+#ifndef GALOIS_COUNTING_TERMINATION
   uint64_t prev_snapshot;
   uint64_t snapshot;
   uint64_t global_snapshot;
@@ -58,21 +72,26 @@ class DGTerminator {
 #else
   lc_colreq snapshot_request;
 #endif
+#endif
 
 public:
   //! Default constructor
   DGTerminator() {
+#ifndef GALOIS_COUNTING_TERMINATION
     reinitialize();
     initiate_snapshot();
+#endif
     reset();
   }
 
+#ifndef GALOIS_COUNTING_TERMINATION
   void reinitialize() {
     prev_snapshot   = 0;
     snapshot        = 1;
     global_snapshot = 1;
     work_done       = false;
   }
+#endif
 
   /**
    * Adds to accumulated value
@@ -137,6 +156,9 @@ public:
     return retval;
   }
 
+#ifdef GALOIS_COUNTING_TERMINATION
+  bool terminate() { return net.checkTermination(local_mdata == 0); }
+#else
   void initiate_snapshot() {
 #ifdef GALOIS_USE_LCI
     lc_ialreduce(&snapshot, &global_snapshot, sizeof(Ty),
@@ -198,6 +220,7 @@ public:
     }
     return false;
   }
+#endif
 
   /**
    * Reduce data across all hosts, saves the value, and returns the
@@ -146,6 +146,18 @@ public:
   //! @returns true if any receive is in progress or is pending to be dequeued
   virtual bool anyPendingReceives() = 0;
 
+  /**
+   * Non-blocking termination check of the current asynchronous phase. The
+   * network counts the messages each host sends and receives, and combines
+   * the counts in the background with a token passed between the hosts
+   * (Safra's algorithm). All hosts must check the same phases in order.
+   *
+   * @param idle true if this host has no local work left
+   * @returns true once all hosts have been idle with no message in flight,
+   * which ends the phase on this host
+   */
+  virtual bool checkTermination(bool idle);
+
   //! Get how many bytes were sent
   //! @returns num bytes sent
   virtual unsigned long reportSendBytes() const = 0;
@@ -21,8 +21,8 @@
  * @file NetworkIO.h
  *
  * Contains NetworkIO, a base class that is inherited by classes that want to
- * implement the communication layer of Galois. (e.g. NetworkIOMPI and
- * NetworkIOLWCI)
+ * implement the communication layer of Galois. (e.g. NetworkIOMPI,
+ * NetworkIOSharedMem and NetworkIOLWCI)
  */
 
 #ifndef GALOIS_RUNTIME_NETWORKTHREAD_H
@@ -124,6 +124,17 @@ public:
 std::tuple<std::unique_ptr<NetworkIO>, uint32_t, uint32_t>
 makeNetworkIOMPI(galois::runtime::MemUsageTracker& tracker,
                  std::atomic<size_t>& sends, std::atomic<size_t>& recvs);
+
+/**
+ * Creates/returns a network IO layer that exchanges messages with hosts on
+ * the same node through shared memory and uses MPI for all other hosts.
+ *
+ * @returns tuple with pointer to the shared memory IO layer, this host's ID,
+ * and the total number of hosts in the system
+ */
+std::tuple<std::unique_ptr<NetworkIO>, uint32_t, uint32_t>
+makeNetworkIOSharedMem(galois::runtime::MemUsageTracker& tracker,
+                       std::atomic<size_t>& sends, std::atomic<size_t>& recvs);
 // #ifdef GALOIS_USE_LCI
 // /**
 //  * Creates/returns a network IO layer that uses LWCI to do communication.
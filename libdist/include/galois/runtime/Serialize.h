@@ -63,6 +63,20 @@ class SerializeBuffer {
   //! the actual data stored in this buffer
   vTy bufdata;
 
+  /**
+   * Bytes serialized by reference: they belong between bufdata[at - 1] and
+   * bufdata[at] but are only copied when the buffer is flattened.
+   */
+  struct RefSegment {
+    size_t at;
+    const uint8_t* data;
+    size_t bytes;
+  };
+  //! bytes serialized by reference, in order
+  std::vector<RefSegment> refs;
+  //! total number of bytes in refs
+  size_t refBytes = 0;
+
 public:
   //! default constructor
   SerializeBuffer() = default;
@@ -81,9 +95,64 @@ public:
     bufdata.insert(bufdata.end(), c, c + bytes);
   }
 
+  /**
+   * Append bytes by reference: only their location is recorded. They are
+   * copied when the buffer is flattened or gathered by the network layer,
+   * so they must stay valid and unmodified until then.
+   *
+   * @param c start of the bytes
+   * @param bytes number of bytes
+   */
+  void insertRef(const uint8_t* c, size_t bytes) {
+    if (bytes > 0) {
+      refs.push_back(RefSegment{bufdata.size(), c, bytes});
+      refBytes += bytes;
+    }
+  }
+
+  //! Returns true if some bytes of this buffer are held by reference
+  bool hasRefs() const { return !refs.empty(); }
+
+  /**
+   * Calls f(pointer, bytes) on each contiguous piece of the buffer in order;
+   * the pieces together are the serialized bytes.
+   */
+  template <typename F>
+  void forEachSegment(F f) const {
+    size_t done = 0;
+    for (auto& r : refs) {
+      if (r.at > done) {
+        f(bufdata.data() + done, r.at - done);
+      }
+      f(r.data, r.bytes);
+      done = r.at;
+    }
+    if (bufdata.size() > done) {
+      f(bufdata.data() + done, bufdata.size() - done);
+    }
+  }
+
+  /**
+   * Copy the bytes held by reference into the buffer itself.
+   */
+  void flatten() {
+    if (refs.empty()) {
+      return;
+    }
+    vTy flat;
+    flat.reserve(size());
+    forEachSegment([&](const uint8_t* c, size_t bytes) {
+      flat.insert(flat.end(), c, c + bytes);
+    });
+    bufdata.swap(flat);
+    refs.clear();
+    refBytes = 0;
+  }
+
   //! Insert characters from a buffer into the serialize buffer at a particular
   //! offset
   void insertAt(const uint8_t* c, size_t bytes, size_t offset) {
+    assert(refs.empty());
     std::copy_n(c, bytes, bufdata.begin() + offset);
   }
 
@@ -95,12 +164,21 @@ public:
    * @returns offset to the end of the buffer before new space was reserved
    */
   size_t encomber(size_t bytes) {
+    assert(refs.empty());
     size_t retval = bufdata.size();
     bufdata.resize(retval + bytes);
     return retval;
   }
 
-  void resize(size_t bytes) { bufdata.resize(bytes); }
+  void resize(size_t bytes) {
+    if (bytes == 0) {
+      refs.clear();
+      refBytes = 0;
+    } else {
+      flatten();
+    }
+    bufdata.resize(bytes);
+  }
 
   /**
    * Reserve more space in the serialize buffer.
@@ -110,26 +188,43 @@ public:
   void reserve(size_t s) { bufdata.reserve(bufdata.size() + s); }
 
   //! Returns a pointer to the data stored in this serialize buffer
-  const uint8_t* linearData() const { return bufdata.data(); }
-  //! Returns vector of data stored in this serialize buffer
-  vTy& getVec() { return bufdata; }
+  const uint8_t* linearData() const {
+    assert(refs.empty());
+    return bufdata.data();
+  }
+  //! Returns a pointer to the data stored in this serialize buffer after
+  //! flattening it
+  const uint8_t* linearData() {
+    flatten();
+    return bufdata.data();
+  }
+  //! Returns vector of data stored in this serialize buffer (flattened)
+  vTy& getVec() {
+    flatten();
+    return bufdata;
+  }
 
   //! Returns an iterator to the beginning of the data in this serialize buffer
-  vTy::const_iterator begin() const { return bufdata.cbegin(); }
+  vTy::const_iterator begin() const {
+    assert(refs.empty());
+    return bufdata.cbegin();
+  }
   //! Returns an iterator to the end of the data in this serialize buffer
   vTy::const_iterator end() const { return bufdata.cend(); }
 
   using size_type = vTy::size_type;
 
   //! Returns the size of the serialize buffer
-  size_type size() const { return bufdata.size(); }
+  size_type size() const { return bufdata.size() + refBytes; }
 
   //! Utility print function for the serialize buffer
   //! @param o stream to print to
   void print(std::ostream& o) const {
     o << "<{" << std::hex;
-    for (auto& i : bufdata)
-      o << (unsigned int)i << " ";
+    forEachSegment([&](const uint8_t* c, size_t bytes) {
+      for (size_t i = 0; i < bytes; ++i)
+        o << (unsigned int)c[i] << " ";
+    });
     o << std::dec << "}>";
   }
 
@@ -189,6 +284,7 @@ public:
    * Initialize a deserialize buffer from a serialize buffer
    */
   explicit DeSerializeBuffer(SerializeBuffer&& buf) : offset(0) {
+    buf.flatten();
     bufdata.swap(buf.bufdata);
   }
 
@@ -654,7 +750,8 @@ inline void gSerializeObj(SerializeBuffer& buf,
  * @param [in] data serialize buffer to get data from
  */
 inline void gSerializeObj(SerializeBuffer& buf, const SerializeBuffer& data) {
-  buf.insert(data.linearData(), data.size());
+  data.forEachSegment(
+      [&](const uint8_t* c, size_t bytes) { buf.insert(c, bytes); });
 }
 
 /**
@@ -751,6 +848,40 @@ static inline void gSerializeLazy(SerializeBuffer& buf, LazyRef<Ty> r,
   buf.insertAt(pdata, sizeof(Ty), off);
 }
 
+/**
+ * Serialize a sequence by reference: the size is serialized as usual but
+ * the elements are only recorded in the buffer and copied when it is
+ * flattened or handed to the network layer, so the sequence must stay alive
+ * and unmodified until then. The serialized bytes are the same as with
+ * gSerialize. Sequences of non-memcopyable elements are serialized normally.
+ *
+ * @param buf Buffer to serialize into
+ * @param seq Sequence to serialize
+ */
+template <typename Seq>
+inline void gSerializeRef(SerializeBuffer& buf, const Seq& seq) {
+  typedef typename Seq::value_type T;
+  if constexpr (is_memory_copyable<T>::value) {
+    typename Seq::size_type size = seq.size();
+    internal::gSerializeObj(buf, size);
+    buf.insertRef((const uint8_t*)seq.data(), size * sizeof(T));
+  } else {
+    internal::gSerializeObj(buf, seq);
+  }
+}
+
+/**
+ * Serialize a dynamic bitset by reference; see gSerializeRef for sequences.
+ *
+ * @param buf Buffer to serialize into
+ * @param data Bitset to serialize
+ */
+inline void gSerializeRef(SerializeBuffer& buf,
+                          const galois::DynamicBitSet& data) {
+  internal::gSerializeObj(buf, data.size());
+  gSerializeRef(buf, data.get_vec());
+}
+
 /**
  * Serialize an entire series of datatypes into a provided serialize buffer
  */
@@ -1027,6 +1158,60 @@ inline void gDeserializeObj(DeSerializeBuffer& buf,
 
 } // namespace internal
 
+/**
+ * Read-only view of a serialized sequence of memcopyable elements that
+ * still lives in the deserialize buffer it was received in. Only valid as
+ * long as that buffer is.
+ */
+template <typename T>
+class DeSerializeView {
+  const T* elements = nullptr;
+  size_t count      = 0;
+
+public:
+  using value_type = T;
+  using size_type  = size_t;
+
+  DeSerializeView() = default;
+  DeSerializeView(const T* e, size_t n) : elements(e), count(n) {}
+
+  const T& operator[](size_t i) const {
+    assert(i < count);
+    return elements[i];
+  }
+  const T* data() const { return elements; }
+  const T* begin() const { return elements; }
+  const T* end() const { return elements + count; }
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+};
+
+/**
+ * Deserialize a sequence of memcopyable elements as a view into the buffer
+ * instead of copying it out. Only possible if the elements happen to be
+ * suitably aligned in the buffer.
+ *
+ * @param buf [in,out] Buffer to deserialize from
+ * @param view [out] view of the elements
+ * @returns true if view was set; false if the elements are misaligned, in
+ * which case buf is left untouched and the sequence has to be deserialized
+ * normally
+ */
+template <typename T>
+bool gDeserializeView(DeSerializeBuffer& buf, DeSerializeView<T>& view) {
+  static_assert(is_memory_copyable<T>::value, "Not POD Sequence");
+  unsigned start = buf.getOffset();
+  size_t size;
+  internal::gDeserializeObj(buf, size);
+  if (!buf.atAlignment(alignof(T))) {
+    buf.setOffset(start);
+    return false;
+  }
+  view = DeSerializeView<T>((const T*)buf.r_linearData(), size);
+  buf.setOffset(buf.getOffset() + size * sizeof(T));
+  return true;
+}
+
 /**
  * Deserialize data in a buffer into a series of objects
  */
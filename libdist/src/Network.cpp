@@ -69,6 +69,11 @@ NetworkInterface::NetworkInterface() {}
 
 NetworkInterface::~NetworkInterface() {}
 
+bool NetworkInterface::checkTermination(bool) {
+  GALOIS_DIE("termination detection is not supported by this network");
+  return false;
+}
+
 void NetworkInterface::reportMemUsage() const {
   std::string str("CommunicationMemUsage");
   galois::runtime::reportStat_Tmin("dGraph", str + "Min",
@@ -29,6 +29,7 @@
 #include "galois/runtime/Network.h"
 #include "galois/runtime/NetworkIO.h"
 #include "galois/runtime/Tracer.h"
+#include "galois/substrate/EnvCheck.h"
 
 #ifdef GALOIS_USE_LCI
 #define NO_AGG
@@ -38,6 +39,7 @@
 #include <mutex>
 #include <iostream>
 #include <limits>
+#include <cstring>
 
 using namespace galois::runtime;
 using namespace galois::substrate;
@@ -245,7 +247,10 @@ class NetworkInterfaceBuffered : public NetworkInterface {
     struct msg {
       uint32_t tag;
       vTy data;
-      msg(uint32_t t, vTy& _data) : tag(t), data(std::move(_data)) {}
+      //! data already starts with its length and goes out on its own
+      bool framed;
+      msg(uint32_t t, vTy& _data, bool f)
+          : tag(t), data(std::move(_data)), framed(f) {}
     };
 
     std::deque<msg> messages;
@@ -305,12 +310,20 @@ class NetworkInterfaceBuffered : public NetworkInterface {
       if (messages.empty())
         return std::make_pair(~0, vTy());
 #ifndef NO_AGG
+      uint32_t tag = messages.front().tag;
+      if (messages.front().framed) {
+        vTy vec(std::move(messages.front().data));
+        if (urgent)
+          --urgent;
+        messages.pop_front();
+        numBytes -= vec.size() - sizeof(uint32_t);
+        return std::make_pair(tag, std::move(vec));
+      }
       // compute message size
       uint32_t len = 0;
       int num      = 0;
-      uint32_t tag = messages.front().tag;
       for (auto& m : messages) {
-        if (m.tag != tag) {
+        if (m.tag != tag || m.framed) {
           break;
         } else {
           // do not let it go over the integer limit because MPI_Isend cannot
@@ -355,22 +368,134 @@ class NetworkInterfaceBuffered : public NetworkInterface {
       return std::make_pair(tag, std::move(vec));
     }
 
-    void add(uint32_t tag, vTy& b) {
+    //! @param framed b already starts with its length and must be sent on
+    //! its own
+    void add(uint32_t tag, vTy& b, bool framed = false) {
       std::lock_guard<SimpleLock> lg(lock);
       if (messages.empty()) {
         std::lock_guard<SimpleLock> lg(timelock);
         time = std::chrono::high_resolution_clock::now();
       }
       unsigned oldNumBytes = numBytes;
-      numBytes += b.size();
+      numBytes += framed ? b.size() - sizeof(uint32_t) : b.size();
       galois::runtime::trace("BufferedAdd", oldNumBytes, numBytes, tag,
                              galois::runtime::printVec(b));
-      messages.emplace_back(tag, b);
+      messages.emplace_back(tag, b, framed);
     }
   }; // end send buffer class
 
   std::vector<sendBuffer> sendData;
 
+  //! tag of termination control messages; above all tags used by phases
+  static constexpr uint32_t TERM_CONTROL_TAG =
+      static_cast<uint32_t>(std::numeric_limits<int16_t>::max()) + 1;
+
+  struct TermControl {
+    enum Kind : uint32_t { TOKEN = 1, TERMINATE = 2 };
+    uint32_t kind;
+    uint32_t black;
+    uint64_t epoch;
+    int64_t count;
+  };
+
+  //! protects the termination state below shared with compute threads
+  SimpleLock termLock;
+  //! messages sent minus messages received by this host
+  int64_t termCount;
+  bool termBlack;
+  bool termIdle;
+  //! a message was received after the last checkTermination
+  bool termReceived;
+  //! number of phases that have ended on this host (compute side)
+  uint64_t termEpoch;
+  //! number of phases whose termination has been detected (network side)
+  std::atomic<uint64_t> termDetected;
+  bool termTagSupported;
+
+  // network thread only
+  bool tokenHeld;
+  bool probing;
+  TermControl token;
+
+  void sendTermControl(uint32_t dest, const TermControl& c) {
+    NetworkIO::message msg;
+    msg.host = dest;
+    msg.tag  = TERM_CONTROL_TAG;
+    msg.data.insert(msg.data.end(), (const uint8_t*)&c,
+                    (const uint8_t*)&c + sizeof(c));
+    ++inflightSends;
+    netio->enqueue(std::move(msg));
+  }
+
+  void recvTermControl(NetworkIO::message& m) {
+    --inflightRecvs;
+    memUsageTracker.decrementMemUsage(m.data.size());
+    TermControl c;
+    assert(m.data.size() == sizeof(c));
+    std::memcpy(&c, m.data.data(), sizeof(c));
+    if (c.kind == TermControl::TERMINATE) {
+      termDetected = c.epoch + 1;
+    } else {
+      assert(!tokenHeld);
+      tokenHeld = true;
+      token     = c;
+    }
+  }
+
+  /**
+   * Termination detection (Safra's algorithm) for asynchronous phases:
+   * starts a probe, passes the token on, or decides termination.
+   *
+   * Each host counts the messages it sends minus the ones it receives, and
+   * turns black when it receives one. Counts are never reset since messages
+   * of a phase may be sent before any host checks for its termination. The
+   * network thread of host 0 sends a token around the ring of hosts once it
+   * is idle; a host passes the token on only while idle in the same phase,
+   * adding its count and color and turning white. If the token comes back
+   * white to a white host 0 with a total count of 0, no host has work and no
+   * message is in flight, so host 0 tells the others that the phase has
+   * ended. Compute threads only update this state under termLock; they never
+   * wait on the other hosts.
+   */
+  void progressTermination() {
+    if (ID == 0 && !probing) {
+      std::lock_guard<SimpleLock> lg(termLock);
+      if (termIdle && termDetected <= termEpoch) {
+        if (Num == 1) {
+          if (termCount == 0)
+            termDetected = termEpoch + 1;
+          return;
+        }
+        termBlack = false;
+        probing   = true;
+        sendTermControl(1, TermControl{TermControl::TOKEN, 0, termEpoch, 0});
+      }
+      return;
+    }
+    if (!tokenHeld)
+      return;
+    std::lock_guard<SimpleLock> lg(termLock);
+    if (!termIdle || termEpoch != token.epoch)
+      return;
+    tokenHeld = false;
+    if (ID == 0) {
+      probing = false;
+      if (!token.black && !termBlack && token.count + termCount == 0) {
+        for (unsigned h = 1; h < Num; ++h) {
+          sendTermControl(
+              h, TermControl{TermControl::TERMINATE, 0, token.epoch, 0});
+        }
+        termDetected = token.epoch + 1;
+      }
+      // otherwise, a new probe is started on the next call
+      return;
+    }
+    token.count += termCount;
+    token.black |= termBlack;
+    termBlack = false;
+    sendTermControl((ID + 1) % Num, token);
+  }
+
   void workerThread() {
     initializeMPI();
     int rank;
@@ -387,16 +512,28 @@ class NetworkInterfaceBuffered : public NetworkInterface {
     }
 
     galois::gDebug("[", NetworkInterface::ID, "] MPI initialized");
-    std::tie(netio, ID, Num) =
-        makeNetworkIOMPI(memUsageTracker, inflightSends, inflightRecvs);
+    if (galois::substrate::EnvCheck("GALOIS_SHM_TRANSPORT")) {
+      std::tie(netio, ID, Num) = makeNetworkIOSharedMem(
+          memUsageTracker, inflightSends, inflightRecvs);
+    } else {
+      std::tie(netio, ID, Num) =
+          makeNetworkIOMPI(memUsageTracker, inflightSends, inflightRecvs);
+    }
 
     assert(ID == (unsigned)rank);
     assert(Num == (unsigned)hostSize);
 
+    int* tagUB;
+    int tagUBFound;
+    MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_TAG_UB, &tagUB, &tagUBFound);
+    termTagSupported =
+        tagUBFound && static_cast<uint32_t>(*tagUB) >= TERM_CONTROL_TAG;
+
     ready = 1;
     while (ready < 2) { /*fprintf(stderr, "[WaitOnReady-2]");*/
     };
     while (ready != 3) {
+      progressTermination();
       for (unsigned i = 0; i < sendData.size(); ++i) {
         netio->progress();
         // handle send queue i
@@ -412,7 +549,9 @@ class NetworkInterfaceBuffered : public NetworkInterface {
         }
         // handle receive
         NetworkIO::message rdata = netio->dequeue();
-        if (rdata.data.size()) {
+        if (rdata.data.size() && rdata.tag == TERM_CONTROL_TAG) {
+          recvTermControl(rdata);
+        } else if (rdata.data.size()) {
           ++statRecvDequeued;
           assert(rdata.data.size() !=
                  (unsigned int)std::count(rdata.data.begin(), rdata.data.end(),
@@ -423,6 +562,8 @@ class NetworkInterfaceBuffered : public NetworkInterface {
         }
       }
     }
+    // IO layers may hold MPI resources that must be freed before finalize
+    netio.reset();
     finalizeMPI();
   }
 
@@ -438,6 +579,14 @@ public:
     inflightRecvs       = 0;
     ready               = 0;
     anyReceivedMessages = false;
+    termCount           = 0;
+    termBlack           = false;
+    termIdle            = false;
+    termReceived        = false;
+    termEpoch           = 0;
+    termDetected        = 0;
+    tokenHeld           = false;
+    probing             = false;
     worker = std::thread(&NetworkInterfaceBuffered::workerThread, this);
     while (ready != 1) {
     };
@@ -460,9 +609,30 @@ public:
     tag += phase;
     statSendNum += 1;
     statSendBytes += buf.size();
-    galois::runtime::trace("sendTagged", dest, tag,
-                           galois::runtime::printVec(buf.getVec()));
+    {
+      std::lock_guard<SimpleLock> lg(termLock);
+      ++termCount;
+      termIdle = false;
+    }
+    galois::runtime::trace("sendTagged", dest, tag, buf);
     auto& sd = sendData[dest];
+#ifndef NO_AGG
+    if (buf.hasRefs()) {
+      // gather the pieces straight into a message of their own, length in
+      // front as in aggregated messages, instead of flattening the buffer
+      // and having assemble copy it once more
+      uint32_t len = buf.size();
+      vTy vec;
+      vec.reserve(sizeof(uint32_t) + len);
+      vec.insert(vec.end(), (uint8_t*)&len, (uint8_t*)&len + sizeof(len));
+      buf.forEachSegment([&](const uint8_t* c, size_t bytes) {
+        vec.insert(vec.end(), c, c + bytes);
+      });
+      buf.resize(0);
+      sd.add(tag, vec, true);
+      return;
+    }
+#endif
     sd.add(tag, buf.getVec());
   }
 
@@ -487,6 +657,13 @@ public:
             galois::runtime::trace("recvTagged", h, tag,
                                    galois::runtime::printVec(buf->getVec()));
             anyReceivedMessages = true;
+            {
+              std::lock_guard<SimpleLock> tlg(termLock);
+              termBlack = true;
+              --termCount;
+              termIdle     = false;
+              termReceived = true;
+            }
             return std::optional<std::pair<uint32_t, RecvBuffer>>(
                 std::make_pair(h, std::move(*buf)));
           }
@@ -518,6 +695,21 @@ public:
     return (inflightRecvs > 0);
   }
 
+  virtual bool checkTermination(bool idle) {
+    GALOIS_ASSERT(termTagSupported,
+                  "MPI tag upper bound too small for termination detection");
+    std::lock_guard<SimpleLock> lg(termLock);
+    if (termDetected > termEpoch) {
+      // idle again only once checked in the next phase
+      ++termEpoch;
+      termIdle = false;
+      return true;
+    }
+    termIdle     = idle && !termReceived;
+    termReceived = false;
+    return false;
+  }
+
   virtual unsigned long reportSendBytes() const { return statSendBytes; }
   virtual unsigned long reportSendMsgs() const { return statSendNum; }
   virtual unsigned long reportRecvBytes() const { return statRecvBytes; }
@@ -0,0 +1,421 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+/**
+ * @file NetworkIOSharedMem.cpp
+ *
+ * Contains an implementation of network IO that exchanges messages between
+ * hosts on the same node through shared memory and uses MPI for the rest.
+ *
+ * Every host owns an inbox in an MPI shared memory window holding one
+ * single-producer/single-consumer ring per co-located sender. Small messages
+ * are copied into the ring (in fragments if needed). Large messages are not
+ * copied by the sender at all: only a descriptor of the send buffer is put in
+ * the ring and the receiver pulls the data straight out of the sender's
+ * address space with process_vm_readv; the sender keeps the buffer alive
+ * until the receiver acknowledges the read. If cross-process reads are not
+ * permitted on the node, large messages are fragmented through the ring too.
+ */
+
+#include <sys/prctl.h>
+#include <sys/uio.h>
+
+#include <atomic>
+#include <vector>
+
+#include "galois/runtime/NetworkIO.h"
+#include "galois/runtime/Tracer.h"
+#include "galois/substrate/EnvCheck.h"
+#include "galois/gIO.h"
+
+namespace {
+
+//! records in a ring are aligned to this many bytes
+constexpr size_t recordAlign = 64;
+//! messages of at least this many bytes are read directly from the sender
+constexpr size_t directThreshold = 64 * 1024;
+//! default size of a ring in KiB; GALOIS_SHM_RING_KB overrides it
+constexpr int defaultRingKB = 1024;
+//! value read by peers to check that cross-process reads work
+uint64_t directReadProbe = 0;
+
+inline size_t alignRecord(size_t bytes) {
+  return (bytes + recordAlign - 1) & ~(recordAlign - 1);
+}
+
+/**
+ * Header at the start of every ring. head is written only by the sender,
+ * tail and acked only by the receiver; each lives on its own cache line.
+ */
+struct RingHeader {
+  alignas(64) std::atomic<uint64_t> head;
+  alignas(64) std::atomic<uint64_t> tail;
+  alignas(64) std::atomic<uint64_t> acked; //!< direct reads completed
+};
+
+enum RecordKind : uint32_t { EAGER, DIRECT, WRAP };
+
+/**
+ * Header of a record in a ring. EAGER records carry length bytes of a
+ * message of total bytes right after the header; DIRECT records describe a
+ * send buffer of total bytes at address in the sender; WRAP records pad the
+ * rest of the ring so that the next record starts at offset 0.
+ */
+struct RecordHeader {
+  uint32_t kind;
+  uint32_t tag;
+  uint64_t length;
+  uint64_t total;
+  uint64_t address;
+};
+
+static_assert(sizeof(RecordHeader) <= recordAlign,
+              "record header must fit in one alignment unit");
+
+} // namespace
+
+/**
+ * Shared memory implementation of network IO. Messages to hosts on other
+ * nodes are handed to an MPI network IO layer. ASSUMES THAT MPI IS INITIALIZED
+ * UPON CREATION OF THIS OBJECT.
+ */
+class NetworkIOSharedMem : public galois::runtime::NetworkIO {
+private:
+  //! Message waiting for room in a ring
+  struct pendingSend {
+    uint32_t tag;
+    vTy data;
+    size_t sent; //!< bytes of data already in the ring
+    pendingSend(uint32_t t, vTy&& d) : tag(t), data(std::move(d)), sent(0) {}
+  };
+
+  //! Per co-located peer state
+  struct peerTy {
+    uint32_t host;            //!< global host id
+    pid_t pid;                //!< process id, for direct reads
+    RingHeader* outRing;      //!< ring in the peer's inbox that we write
+    uint8_t* outData;         //!< data area of outRing
+    RingHeader* inRing;       //!< ring in our inbox that the peer writes
+    uint8_t* inData;          //!< data area of inRing
+    std::deque<pendingSend> pending;
+    //! sent direct buffers, waiting for the peer to read them
+    std::deque<vTy> awaitingAck;
+    uint64_t directRetired;   //!< acknowledged direct records
+    //! message being reassembled from EAGER records of inRing
+    vTy partial;
+    size_t partialGot;
+  };
+
+  std::unique_ptr<galois::runtime::NetworkIO> remote;
+  //! local peer index of every host; ~0 if the host is on another node
+  std::vector<uint32_t> localIndex;
+  std::vector<peerTy> peers;
+  std::deque<message> done;
+
+  MPI_Comm nodeComm;
+  MPI_Win window;
+  size_t ringBytes;
+  size_t fragmentBytes;
+  bool directReads;
+
+  size_t ringStride() const { return sizeof(RingHeader) + ringBytes; }
+
+  /**
+   * Write one record into a peer's ring.
+   *
+   * @returns false if there is not enough room in the ring right now
+   */
+  bool pushRecord(peerTy& p, const RecordHeader& hdr, const uint8_t* payload) {
+    RingHeader& ring = *p.outRing;
+    uint64_t head    = ring.head.load(std::memory_order_relaxed);
+    uint64_t tail    = ring.tail.load(std::memory_order_acquire);
+    size_t bytes     = alignRecord(sizeof(RecordHeader) + hdr.length);
+    size_t pos       = head % ringBytes;
+    size_t pad       = (pos + bytes > ringBytes) ? ringBytes - pos : 0;
+
+    if (head + pad + bytes - tail > ringBytes) {
+      return false;
+    }
+    if (pad) {
+      RecordHeader wrap{WRAP, 0, 0, 0, 0};
+      std::memcpy(p.outData + pos, &wrap, sizeof(wrap));
+      head += pad;
+      pos = 0;
+    }
+    std::memcpy(p.outData + pos, &hdr, sizeof(hdr));
+    if (hdr.length) {
+      std::memcpy(p.outData + pos + sizeof(hdr), payload, hdr.length);
+    }
+    ring.head.store(head + bytes, std::memory_order_release);
+    return true;
+  }
+
+  //! Move as much of the pending messages to a peer into its ring as fits
+  void pumpSends(peerTy& p) {
+    // retire direct sends the peer has read
+    uint64_t acked = p.outRing->acked.load(std::memory_order_acquire);
+    while (p.directRetired < acked) {
+      memUsageTracker.decrementMemUsage(p.awaitingAck.front().size());
+      p.awaitingAck.pop_front();
+      ++p.directRetired;
+      --inflightSends;
+    }
+
+    while (!p.pending.empty()) {
+      pendingSend& s = p.pending.front();
+      size_t total   = s.data.size();
+
+      if (directReads && total >= directThreshold) {
+        RecordHeader hdr{DIRECT, s.tag, 0, total,
+                         reinterpret_cast<uint64_t>(s.data.data())};
+        if (!pushRecord(p, hdr, s.data.data())) {
+          return;
+        }
+        p.awaitingAck.emplace_back(std::move(s.data));
+        p.pending.pop_front();
+        continue;
+      }
+
+      while (s.sent < total) {
+        size_t len = std::min(fragmentBytes, total - s.sent);
+        RecordHeader hdr{EAGER, s.tag, len, total, 0};
+        if (!pushRecord(p, hdr, s.data.data() + s.sent)) {
+          return;
+        }
+        s.sent += len;
+      }
+      memUsageTracker.decrementMemUsage(total);
+      p.pending.pop_front();
+      --inflightSends;
+    }
+  }
+
+  void deliver(peerTy& p, uint32_t tag, vTy&& data) {
+    ++inflightRecvs;
+    memUsageTracker.incrementMemUsage(data.size());
+    galois::runtime::trace("SHM RECV", p.host, tag, data.size());
+    done.emplace_back(p.host, tag, std::move(data));
+  }
+
+  //! Consume every record currently in the ring a peer writes to us
+  void drainRing(peerTy& p) {
+    RingHeader& ring = *p.inRing;
+    uint64_t tail    = ring.tail.load(std::memory_order_relaxed);
+    uint64_t head    = ring.head.load(std::memory_order_acquire);
+
+    while (tail != head) {
+      size_t pos = tail % ringBytes;
+      RecordHeader hdr;
+      std::memcpy(&hdr, p.inData + pos, sizeof(hdr));
+
+      if (hdr.kind == WRAP) {
+        tail += ringBytes - pos;
+      } else if (hdr.kind == EAGER) {
+        if (p.partialGot == 0) {
+          p.partial.resize(hdr.total);
+        }
+        std::memcpy(p.partial.data() + p.partialGot,
+                    p.inData + pos + sizeof(hdr), hdr.length);
+        p.partialGot += hdr.length;
+        if (p.partialGot == hdr.total) {
+          deliver(p, hdr.tag, std::move(p.partial));
+          p.partial    = vTy();
+          p.partialGot = 0;
+        }
+        tail += alignRecord(sizeof(hdr) + hdr.length);
+      } else {
+        assert(hdr.kind == DIRECT);
+        vTy data(hdr.total);
+        struct iovec local{data.data(), hdr.total};
+        struct iovec peer{reinterpret_cast<void*>(hdr.address), hdr.total};
+        ssize_t got = process_vm_readv(p.pid, &local, 1, &peer, 1, 0);
+        if (got != static_cast<ssize_t>(hdr.total)) {
+          GALOIS_SYS_DIE("shared memory transport: direct read from host ",
+                         p.host, " failed");
+        }
+        ring.acked.fetch_add(1, std::memory_order_release);
+        deliver(p, hdr.tag, std::move(data));
+        tail += alignRecord(sizeof(hdr));
+      }
+      // free the space right away so the sender can keep going
+      ring.tail.store(tail, std::memory_order_release);
+    }
+  }
+
+  /**
+   * Check whether this host can read the memory of every co-located host.
+   * All hosts of the node agree on the result.
+   */
+  bool probeDirectReads(const std::vector<uint64_t>& probeAddrs) {
+    int ok = 1;
+    for (peerTy& p : peers) {
+      uint64_t value = 0;
+      struct iovec local{&value, sizeof(value)};
+      struct iovec peer{reinterpret_cast<void*>(probeAddrs[&p - &peers[0]]),
+                        sizeof(value)};
+      ssize_t got = process_vm_readv(p.pid, &local, 1, &peer, 1, 0);
+      if (got != sizeof(value) || value != ~static_cast<uint64_t>(p.host)) {
+        ok = 0;
+      }
+    }
+    int all = 0;
+    handleError(MPI_Allreduce(&ok, &all, 1, MPI_INT, MPI_MIN, nodeComm));
+    return all;
+  }
+
+public:
+  /**
+   * Constructor. Collective over all hosts.
+   *
+   * @param tracker memory usage tracker
+   * @param sends
+   * @param recvs
+   * @param [out] ID this machine's host id
+   * @param [out] NUM total number of hosts in the system
+   */
+  NetworkIOSharedMem(galois::runtime::MemUsageTracker& tracker,
+                     std::atomic<size_t>& sends, std::atomic<size_t>& recvs,
+                     uint32_t& ID, uint32_t& NUM)
+      : NetworkIO(tracker, sends, recvs) {
+    std::tie(remote, ID, NUM) =
+        galois::runtime::makeNetworkIOMPI(tracker, sends, recvs);
+
+    int ringKB = defaultRingKB;
+    galois::substrate::EnvCheck("GALOIS_SHM_RING_KB", ringKB);
+    ringBytes     = alignRecord(std::max(ringKB, 64) * size_t{1024});
+    fragmentBytes = alignRecord(ringBytes / 4) - recordAlign;
+
+    handleError(MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, ID,
+                                    MPI_INFO_NULL, &nodeComm));
+    int nodeRank, nodeSize;
+    handleError(MPI_Comm_rank(nodeComm, &nodeRank));
+    handleError(MPI_Comm_size(nodeComm, &nodeSize));
+
+    // learn host id, pid and probe address of everyone on the node
+    directReadProbe = ~static_cast<uint64_t>(ID);
+    prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY, 0, 0, 0);
+    uint64_t mine[3] = {ID, static_cast<uint64_t>(getpid()),
+                        reinterpret_cast<uint64_t>(&directReadProbe)};
+    std::vector<uint64_t> all(3 * nodeSize);
+    handleError(MPI_Allgather(mine, 3, MPI_UINT64_T, all.data(), 3,
+                              MPI_UINT64_T, nodeComm));
+
+    // inbox: one ring per co-located host (our own slot is unused)
+    MPI_Aint inboxBytes = nodeSize * ringStride();
+    uint8_t* inbox;
+    handleError(MPI_Win_allocate_shared(inboxBytes, recordAlign, MPI_INFO_NULL,
+                                        nodeComm, &inbox, &window));
+    for (int i = 0; i < nodeSize; ++i) {
+      auto* ring = reinterpret_cast<RingHeader*>(inbox + i * ringStride());
+      new (ring) RingHeader();
+      ring->head  = 0;
+      ring->tail  = 0;
+      ring->acked = 0;
+    }
+    handleError(MPI_Barrier(nodeComm));
+
+    localIndex.assign(NUM, ~0U);
+    std::vector<uint64_t> probeAddrs;
+    for (int i = 0; i < nodeSize; ++i) {
+      if (i == nodeRank) {
+        continue;
+      }
+      MPI_Aint size;
+      int dispUnit;
+      uint8_t* peerInbox;
+      handleError(
+          MPI_Win_shared_query(window, i, &size, &dispUnit, &peerInbox));
+
+      peerTy p;
+      p.host    = all[3 * i];
+      p.pid     = all[3 * i + 1];
+      p.outRing = reinterpret_cast<RingHeader*>(peerInbox +
+                                                nodeRank * ringStride());
+      p.outData = reinterpret_cast<uint8_t*>(p.outRing + 1);
+      p.inRing  = reinterpret_cast<RingHeader*>(inbox + i * ringStride());
+      p.inData  = reinterpret_cast<uint8_t*>(p.inRing + 1);
+      p.directRetired    = 0;
+      p.partialGot       = 0;
+      localIndex[p.host] = peers.size();
+      peers.push_back(std::move(p));
+      probeAddrs.push_back(all[3 * i + 2]);
+    }
+    directReads = probeDirectReads(probeAddrs);
+
+    if (ID == 0) {
+      galois::gDebug("shared memory transport: ", nodeSize,
+                     " hosts on node 0, direct reads ",
+                     directReads ? "enabled" : "disabled");
+    }
+  }
+
+  ~NetworkIOSharedMem() {
+    MPI_Win_free(&window);
+    MPI_Comm_free(&nodeComm);
+  }
+
+  /**
+   * Adds a message to the send queue of the peer or hands it to MPI
+   */
+  virtual void enqueue(message m) {
+    uint32_t idx = localIndex[m.host];
+    if (idx == ~0U) {
+      remote->enqueue(std::move(m));
+      return;
+    }
+    memUsageTracker.incrementMemUsage(m.data.size());
+    galois::runtime::trace("SHM SEND", m.host, m.tag, m.data.size());
+    peerTy& p = peers[idx];
+    p.pending.emplace_back(m.tag, std::move(m.data));
+    pumpSends(p);
+  }
+
+  /**
+   * Attempts to get a received message, shared memory ones first.
+   */
+  virtual message dequeue() {
+    if (!done.empty()) {
+      auto msg = std::move(done.front());
+      done.pop_front();
+      return msg;
+    }
+    return remote->dequeue();
+  }
+
+  /**
+   * Push progress forward in the system.
+   */
+  virtual void progress() {
+    remote->progress();
+    for (peerTy& p : peers) {
+      pumpSends(p);
+      drainRing(p);
+    }
+  }
+}; // end NetworkIOSharedMem class
+
+std::tuple<std::unique_ptr<galois::runtime::NetworkIO>, uint32_t, uint32_t>
+galois::runtime::makeNetworkIOSharedMem(
+    galois::runtime::MemUsageTracker& tracker, std::atomic<size_t>& sends,
+    std::atomic<size_t>& recvs) {
+  uint32_t ID, NUM;
+  std::unique_ptr<galois::runtime::NetworkIO> n{
+      new NetworkIOSharedMem(tracker, sends, recvs, ID, NUM)};
+  return std::make_tuple(std::move(n), ID, NUM);
+}
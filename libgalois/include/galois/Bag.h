@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <vector>
 
 #include <boost/iterator/iterator_facade.hpp>
 
@@ -300,6 +301,343 @@ public:
   }
 };
 
+/**
+ * Unordered collection of elements with the same concurrent push interface as
+ * {@link InsertBag}. Instead of a linked list of blocks, each thread keeps a
+ * table of equal-sized blocks, so an element is addressed by its thread and
+ * its index within that thread. This makes the iterators random access: a
+ * do_all over the bag splits and steals ranges in O(1), and the size is the
+ * sum of the per-thread counts.
+ *
+ * Blocks are pages from the inserting thread's page pool. {@link clear} keeps
+ * the blocks of each thread in a per-thread cache, so a bag that is refilled
+ * every round (e.g., a frontier) reuses its thread-local memory. Cached blocks
+ * are returned to the page pool by {@link release} or on destruction.
+ */
+template <typename T>
+class IndexedInsertBag {
+
+  struct PerThread {
+    std::vector<T*> blocks;
+    std::vector<T*> cache;
+    size_t size = 0;
+  };
+
+  //! log2 of the number of elements in a block
+  unsigned shift;
+  size_t mask;
+  galois::substrate::PerThreadStorage<PerThread> heads;
+
+  static unsigned blockShift() {
+    size_t n = galois::runtime::pagePoolSize() / sizeof(T);
+    GALOIS_ASSERT(n > 0, "IndexedInsertBag element larger than a page");
+    unsigned s = 0;
+    while ((size_t{2} << s) <= n)
+      ++s;
+    return s;
+  }
+
+  T* elem(const PerThread& pt, size_t idx) const {
+    return pt.blocks[idx >> shift] + (idx & mask);
+  }
+
+  void destroy(PerThread& pt) {
+    size_t perBlock = mask + 1;
+    size_t left     = pt.size;
+    for (T* b : pt.blocks) {
+      size_t n = std::min(left, perBlock);
+      uninitialized_destroy(b, b + n);
+      left -= n;
+    }
+    pt.cache.insert(pt.cache.end(), pt.blocks.begin(), pt.blocks.end());
+    pt.blocks.clear();
+    pt.size = 0;
+  }
+
+  void release(PerThread& pt) {
+    destroy(pt);
+    for (T* b : pt.cache)
+      galois::runtime::pagePoolFree(b);
+    pt.cache.clear();
+    pt.cache.shrink_to_fit();
+    pt.blocks.shrink_to_fit();
+  }
+
+  template <typename Fn>
+  void forEachThread(Fn fn) {
+    galois::runtime::on_each_gen(
+        [&](const unsigned int tid, const unsigned int) {
+          fn(*heads.getLocal(tid));
+        },
+        std::make_tuple(galois::no_stats()));
+  }
+
+public:
+  /**
+   * Iterator over the whole bag. Position is (thread, index) and is kept
+   * normalized so that the index is always valid unless the iterator is at
+   * the end; advancing by n skips over at most all threads.
+   */
+  template <typename U>
+  class Iterator
+      : public boost::iterator_facade<Iterator<U>, U,
+                                      boost::random_access_traversal_tag> {
+    friend class boost::iterator_core_access;
+    template <typename>
+    friend class Iterator;
+
+    const IndexedInsertBag* bag;
+    unsigned thr;
+    size_t idx;
+
+    size_t sizeOf(unsigned t) const { return bag->heads.getRemote(t)->size; }
+    unsigned numThreads() const { return bag->heads.size(); }
+
+    void normalize() {
+      while (thr < numThreads() && idx == sizeOf(thr)) {
+        ++thr;
+        idx = 0;
+      }
+    }
+
+    void increment() {
+      ++idx;
+      normalize();
+    }
+
+    void decrement() {
+      while (idx == 0)
+        idx = sizeOf(--thr);
+      --idx;
+    }
+
+    void advance(std::ptrdiff_t n) {
+      if (n < 0) {
+        size_t k = -n;
+        while (k > idx) {
+          k -= idx;
+          idx = sizeOf(--thr);
+        }
+        idx -= k;
+        normalize();
+        return;
+      }
+      size_t k = n;
+      while (k && thr < numThreads()) {
+        size_t rem = sizeOf(thr) - idx;
+        if (k < rem) {
+          idx += k;
+          return;
+        }
+        k -= rem;
+        ++thr;
+        idx = 0;
+        normalize();
+      }
+    }
+
+    template <typename OtherTy>
+    std::ptrdiff_t distance_to(const Iterator<OtherTy>& o) const {
+      if (o.thr == thr)
+        return std::ptrdiff_t(o.idx) - std::ptrdiff_t(idx);
+      if (o.thr < thr)
+        return -o.distance_to(*this);
+      std::ptrdiff_t d = sizeOf(thr) - idx;
+      for (unsigned t = thr + 1; t < o.thr; ++t)
+        d += sizeOf(t);
+      return d + o.idx;
+    }
+
+    template <typename OtherTy>
+    bool equal(const Iterator<OtherTy>& o) const {
+      return bag == o.bag && thr == o.thr && idx == o.idx;
+    }
+
+    U& dereference() const {
+      return *bag->elem(*bag->heads.getRemote(thr), idx);
+    }
+
+  public:
+    Iterator() : bag(0), thr(0), idx(0) {}
+
+    template <typename OtherTy>
+    Iterator(const Iterator<OtherTy>& o)
+        : bag(o.bag), thr(o.thr), idx(o.idx) {}
+
+    Iterator(const IndexedInsertBag* b, unsigned t) : bag(b), thr(t), idx(0) {
+      normalize();
+    }
+  };
+
+  //! Random access iterator over the elements pushed by one thread
+  template <typename U>
+  class LocalIterator
+      : public boost::iterator_facade<LocalIterator<U>, U,
+                                      boost::random_access_traversal_tag> {
+    friend class boost::iterator_core_access;
+    template <typename>
+    friend class LocalIterator;
+
+    const IndexedInsertBag* bag;
+    const PerThread* pt;
+    size_t idx;
+
+    void increment() { ++idx; }
+    void decrement() { --idx; }
+    void advance(std::ptrdiff_t n) { idx += n; }
+
+    template <typename OtherTy>
+    std::ptrdiff_t distance_to(const LocalIterator<OtherTy>& o) const {
+      return std::ptrdiff_t(o.idx) - std::ptrdiff_t(idx);
+    }
+
+    template <typename OtherTy>
+    bool equal(const LocalIterator<OtherTy>& o) const {
+      return pt == o.pt && idx == o.idx;
+    }
+
+    U& dereference() const { return *bag->elem(*pt, idx); }
+
+  public:
+    LocalIterator() : bag(0), pt(0), idx(0) {}
+
+    template <typename OtherTy>
+    LocalIterator(const LocalIterator<OtherTy>& o)
+        : bag(o.bag), pt(o.pt), idx(o.idx) {}
+
+    LocalIterator(const IndexedInsertBag* b, const PerThread* p, size_t i)
+        : bag(b), pt(p), idx(i) {}
+  };
+
+  IndexedInsertBag() : shift(blockShift()), mask((size_t{1} << shift) - 1) {}
+
+  IndexedInsertBag(IndexedInsertBag&& o)
+      : shift(o.shift), mask(o.mask) {
+    std::swap(heads, o.heads);
+  }
+
+  IndexedInsertBag& operator=(IndexedInsertBag&& o) {
+    std::swap(heads, o.heads);
+    return *this;
+  }
+
+  IndexedInsertBag(const IndexedInsertBag&) = delete;
+  IndexedInsertBag& operator=(const IndexedInsertBag&) = delete;
+
+  ~IndexedInsertBag() {
+    forEachThread([this](PerThread& pt) { release(pt); });
+  }
+
+  //! Destroys all elements; blocks stay in the per-thread caches
+  void clear() {
+    forEachThread([this](PerThread& pt) { destroy(pt); });
+  }
+
+  void clear_serial() {
+    for (unsigned x = 0; x < heads.size(); ++x)
+      destroy(*heads.getRemote(x));
+  }
+
+  //! Destroys all elements and returns all blocks to the page pool
+  void release() {
+    forEachThread([this](PerThread& pt) { release(pt); });
+  }
+
+  void swap(IndexedInsertBag& o) { std::swap(heads, o.heads); }
+
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef const T& const_reference;
+  typedef T& reference;
+  typedef Iterator<T> iterator;
+  typedef Iterator<const T> const_iterator;
+  typedef LocalIterator<T> local_iterator;
+  typedef LocalIterator<const T> const_local_iterator;
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, heads.size()); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, heads.size()); }
+
+  local_iterator local_begin() {
+    return local_iterator(this, heads.getLocal(), 0);
+  }
+  local_iterator local_end() {
+    PerThread* pt = heads.getLocal();
+    return local_iterator(this, pt, pt->size);
+  }
+
+  //! Number of elements; O(number of threads)
+  size_t size() const {
+    size_t n = 0;
+    for (unsigned x = 0; x < heads.size(); ++x)
+      n += heads.getRemote(x)->size;
+    return n;
+  }
+
+  //! Number of elements pushed by this thread
+  size_t local_size() const { return heads.getLocal()->size; }
+
+  bool empty() const {
+    for (unsigned x = 0; x < heads.size(); ++x) {
+      if (heads.getRemote(x)->size)
+        return false;
+    }
+    return true;
+  }
+
+  //! Thread safe bag insertion
+  template <typename... Args>
+  reference emplace(Args&&... args) {
+    PerThread& pt = *heads.getLocal();
+    if ((pt.size >> shift) == pt.blocks.size()) {
+      if (pt.cache.empty()) {
+        pt.blocks.push_back(
+            reinterpret_cast<T*>(galois::runtime::pagePoolAlloc()));
+      } else {
+        pt.blocks.push_back(pt.cache.back());
+        pt.cache.pop_back();
+      }
+    }
+    T* rv = new (elem(pt, pt.size)) T(std::forward<Args>(args)...);
+    ++pt.size;
+    return *rv;
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return emplace(std::forward<Args>(args)...);
+  }
+
+  //! Pop the last element pushed by this thread
+  void pop() {
+    PerThread& pt = *heads.getLocal();
+    if (!pt.size) {
+      throw std::out_of_range("IndexedInsertBag::pop");
+    }
+    --pt.size;
+    T* last = elem(pt, pt.size);
+    uninitialized_destroy(last, last + 1);
+    if ((pt.size & mask) == 0) {
+      pt.cache.push_back(pt.blocks.back());
+      pt.blocks.pop_back();
+    }
+  }
+
+  //! Thread safe bag insertion
+  template <typename ItemTy>
+  reference push(ItemTy&& val) {
+    return emplace(std::forward<ItemTy>(val));
+  }
+
+  //! Thread safe bag insertion
+  template <typename ItemTy>
+  reference push_back(ItemTy&& val) {
+    return emplace(std::forward<ItemTy>(val));
+  }
+};
+
 } // namespace galois
 
 #endif
@@ -0,0 +1,555 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef GALOIS_CONCURRENTHASHMAP_H
+#define GALOIS_CONCURRENTHASHMAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "galois/config.h"
+#include "galois/gIO.h"
+#include "galois/Galois.h"
+#include "galois/LargeArray.h"
+#include "galois/substrate/CompilerSpecific.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "galois/substrate/ThreadPool.h"
+
+namespace galois {
+
+/**
+ * Concurrent unordered map for use inside parallel operators. Entries are
+ * stored with open addressing and linear probing in an array of buckets, one
+ * cache line each, allocated interleaved across NUMA nodes. Lookups do not
+ * lock; an update of an existing value locks only the slot holding it.
+ *
+ * Entries cannot be erased individually. A key is probed for in a bounded
+ * window of buckets from its home bucket. When the window is full, serial
+ * code rehashes into a larger table. Inside a parallel loop the key goes to
+ * an overflow table instead. The overflow table is four times as large and is
+ * created by whichever thread needs it first; it is itself a map and chains
+ * further when it fills. Lookups and iteration follow the chain. The next
+ * serial insertion, {@link reserve} or {@link rehash} merges the chain back
+ * into one table, so {@link reserve} before an inserting loop still pays off.
+ * Maps created inside a parallel loop are allocated on the local NUMA node
+ * instead.
+ */
+template <class _Key, class _Tp, class _Hash = std::hash<_Key>,
+          class _KeyEqual = std::equal_to<_Key>>
+class ConcurrentHashMap {
+public:
+  typedef _Key key_type;
+  typedef _Tp mapped_type;
+  typedef std::pair<_Key, _Tp> value_type;
+  typedef _Hash hasher;
+  typedef _KeyEqual key_equal;
+  typedef size_t size_type;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef value_type* pointer;
+  typedef const value_type* const_pointer;
+
+private:
+  enum SlotState : uint8_t { EMPTY = 0, INIT, FULL, LOCKED };
+
+  //! Number of slots that fit in a cache line with their state bytes
+  static constexpr size_t SLOTS = std::max<size_t>(
+      1, substrate::GALOIS_CACHE_LINE_SIZE / (sizeof(value_type) + 1));
+
+  struct alignas(substrate::GALOIS_CACHE_LINE_SIZE) Bucket {
+    std::atomic<uint8_t> state[SLOTS];
+    typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type
+        slots[SLOTS];
+
+    value_type* at(size_t i) {
+      return reinterpret_cast<value_type*>(&slots[i]);
+    }
+  };
+
+  //! Maximum fraction of slots in use before the table grows (serial only)
+  static constexpr double MAX_LOAD = 0.7;
+  static constexpr size_t MIN_BUCKETS = 16;
+  //! Smaller tables are initialized and rehashed serially
+  static constexpr size_t PARALLEL_BUCKETS = 4096;
+  //! Buckets probed for a key before moving on to the overflow table
+  static constexpr size_t MAX_PROBE = 64;
+
+  LargeArray<Bucket> _buckets;
+  unsigned _shift; // 64 - log2(number of buckets)
+  substrate::PerThreadStorage<size_t> _counts;
+  //! Entries that did not fit while the table could not grow
+  std::atomic<ConcurrentHashMap*> _overflow{nullptr};
+  _Hash _hash;
+  _KeyEqual _eq;
+
+  size_t home(const key_type& k) const {
+    // Fibonacci hashing spreads identity hashes of integers
+    uint64_t h = static_cast<uint64_t>(_hash(k)) * 0x9E3779B97F4A7C15ULL;
+    return h >> _shift;
+  }
+
+  static bool inParallel() { return substrate::getThreadPool().isRunning(); }
+
+  static void waitInit(std::atomic<uint8_t>& s, uint8_t& cur) {
+    while (cur == INIT) {
+      substrate::asmPause();
+      cur = s.load(std::memory_order_acquire);
+    }
+  }
+
+  //! Calls fn(i) for each bucket, in parallel unless already in a loop
+  template <typename Fn>
+  void forBuckets(size_t n, Fn fn) {
+    if (inParallel() || n < PARALLEL_BUCKETS) {
+      for (size_t i = 0; i < n; ++i)
+        fn(i);
+      return;
+    }
+    galois::do_all(galois::iterate(size_t{0}, n), fn, galois::steal(),
+                   galois::no_stats());
+  }
+
+  void initBuckets(size_t numBuckets) {
+    // interleaving pages in uses the thread pool
+    if (inParallel())
+      _buckets.allocateLocal(numBuckets);
+    else
+      _buckets.allocateInterleaved(numBuckets);
+    size_t log = 0;
+    while ((size_t{1} << log) < numBuckets)
+      ++log;
+    _shift    = 64 - log;
+    Bucket* b = _buckets.data();
+    forBuckets(numBuckets, [=](size_t i) {
+      for (size_t j = 0; j < SLOTS; ++j)
+        new (&b[i].state[j]) std::atomic<uint8_t>(EMPTY);
+    });
+  }
+
+  //! Calls fn(Bucket&, slot) for every occupied slot
+  template <typename Fn>
+  void forEachFull(Fn fn) {
+    Bucket* b = _buckets.data();
+    forBuckets(_buckets.size(), [=](size_t i) {
+      for (size_t j = 0; j < SLOTS; ++j)
+        if (b[i].state[j].load(std::memory_order_relaxed) != EMPTY)
+          fn(b[i], j);
+    });
+  }
+
+  void destroyAll() {
+    if (!std::is_trivially_destructible<value_type>::value)
+      forEachFull([](Bucket& b, size_t j) { b.at(j)->~value_type(); });
+    delete _overflow.exchange(nullptr);
+  }
+
+  size_t probeLimit() const {
+    return std::min<size_t>(MAX_PROBE, _buckets.size());
+  }
+
+  //! The overflow table, created by the first thread to need it
+  ConcurrentHashMap* overflow() {
+    ConcurrentHashMap* o = _overflow.load(std::memory_order_acquire);
+    if (o)
+      return o;
+    ConcurrentHashMap* fresh =
+        new ConcurrentHashMap(4 * capacity(), _hash, _eq);
+    if (_overflow.compare_exchange_strong(o, fresh, std::memory_order_acq_rel))
+      return fresh;
+    delete fresh;
+    return o;
+  }
+
+  /**
+   * Moves the entries of from into this table and marks their slots empty.
+   * Runs in parallel, so entries that miss their window go to the overflow.
+   */
+  void absorb(LargeArray<Bucket>& from) {
+    Bucket* ob = from.data();
+    forBuckets(from.size(), [&, ob](size_t i) {
+      for (size_t j = 0; j < SLOTS; ++j) {
+        if (ob[i].state[j].load(std::memory_order_relaxed) == EMPTY)
+          continue;
+        value_type* v = ob[i].at(j);
+        auto move     = [&](void* p) { new (p) value_type(std::move(*v)); };
+        std::atomic<uint8_t>* st = nullptr;
+        if (!acquire(v->first, move, false, &st).first)
+          overflow()->upsert(
+              v->first, move, [](value_type&) {}, false);
+        v->~value_type();
+        ob[i].state[j].store(EMPTY, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  /**
+   * Finds the slot of k, inserting it with ctor(void*) if absent. On return
+   * the slot is locked if lock is true. Returns null if k is not in its
+   * probe window and the window has no empty slot. Slots never become empty
+   * again, so k cannot be added to the window later by another thread either.
+   */
+  template <typename Ctor>
+  std::pair<value_type*, bool> acquire(const key_type& k, Ctor&& ctor,
+                                       bool lock,
+                                       std::atomic<uint8_t>** st) {
+    size_t mask  = _buckets.size() - 1;
+    size_t limit = probeLimit();
+    size_t bi    = home(k);
+    for (size_t probe = 0; probe < limit; ++probe, bi = (bi + 1) & mask) {
+      Bucket& b = _buckets[bi];
+      for (size_t j = 0; j < SLOTS; ++j) {
+        std::atomic<uint8_t>& s = b.state[j];
+        uint8_t cur             = s.load(std::memory_order_acquire);
+        if (cur == EMPTY &&
+            s.compare_exchange_strong(cur, INIT, std::memory_order_acq_rel)) {
+          ctor(b.at(j));
+          ++*_counts.getLocal();
+          s.store(lock ? LOCKED : FULL, std::memory_order_release);
+          *st = &s;
+          return std::make_pair(b.at(j), true);
+        }
+        // lost the race for an empty slot or found an occupied one
+        waitInit(s, cur);
+        if (!_eq(b.at(j)->first, k))
+          continue;
+        if (lock) {
+          for (;;) {
+            cur = FULL;
+            if (s.compare_exchange_weak(cur, LOCKED, std::memory_order_acquire))
+              break;
+            substrate::asmPause();
+          }
+        }
+        *st = &s;
+        return std::make_pair(b.at(j), false);
+      }
+    }
+    return std::make_pair(nullptr, false);
+  }
+
+  //! Grows from serial code once the load factor is exceeded, and merges
+  //! the overflow tables left by parallel loops
+  void maybeGrow() {
+    if (inParallel())
+      return;
+    if (_overflow.load(std::memory_order_relaxed))
+      rehash(bucketsFor(size()));
+    else if ((*_counts.getLocal() & 63) == 0 && size() > MAX_LOAD * capacity())
+      rehash(_buckets.size() * 2);
+  }
+
+  template <typename Ctor, typename Fn>
+  bool upsert(const key_type& k, Ctor&& ctor, Fn&& fn, bool lock) {
+    for (;;) {
+      std::atomic<uint8_t>* st = nullptr;
+      auto r                   = acquire(k, ctor, lock, &st);
+      if (r.first) {
+        fn(*r.first);
+        if (lock)
+          st->store(FULL, std::memory_order_release);
+        if (r.second)
+          maybeGrow();
+        return r.second;
+      }
+      if (inParallel())
+        return overflow()->upsert(k, ctor, fn, lock);
+      rehash(_buckets.size() * 2);
+    }
+  }
+
+public:
+  /**
+   * Forward iterator over the entries. Iteration must not run concurrently
+   * with insertions.
+   */
+  template <typename U>
+  class Iterator {
+    template <typename>
+    friend class Iterator;
+    Bucket* cur;
+    Bucket* last;
+    size_t slot;
+    //! table that [cur, last) belongs to; overflow tables follow it
+    ConcurrentHashMap* table;
+    //! only visit this thread's block of each table
+    bool local;
+
+    void skip() {
+      for (;;) {
+        for (; cur != last; ++cur, slot = 0)
+          for (; slot < SLOTS; ++slot)
+            if (cur->state[slot].load(std::memory_order_relaxed) != EMPTY)
+              return;
+        table = table ? table->_overflow.load(std::memory_order_acquire)
+                      : nullptr;
+        if (!table) {
+          cur = last = nullptr;
+          slot       = 0;
+          return;
+        }
+        auto r = local ? table->localBuckets() : table->allBuckets();
+        cur    = r.first;
+        last   = r.second;
+      }
+    }
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename std::remove_const<U>::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef U* pointer;
+    typedef U& reference;
+
+    Iterator()
+        : cur(nullptr), last(nullptr), slot(0), table(nullptr), local(false) {}
+    Iterator(Bucket* c, Bucket* l, ConcurrentHashMap* t, bool loc)
+        : cur(c), last(l), slot(0), table(t), local(loc) {
+      skip();
+    }
+
+    template <typename OtherTy>
+    Iterator(const Iterator<OtherTy>& o)
+        : cur(o.cur), last(o.last), slot(o.slot), table(o.table),
+          local(o.local) {}
+
+    reference operator*() const { return *cur->at(slot); }
+    pointer operator->() const { return cur->at(slot); }
+
+    Iterator& operator++() {
+      ++slot;
+      skip();
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    template <typename OtherTy>
+    bool operator==(const Iterator<OtherTy>& o) const {
+      return cur == o.cur && slot == o.slot;
+    }
+    template <typename OtherTy>
+    bool operator!=(const Iterator<OtherTy>& o) const {
+      return !(*this == o);
+    }
+  };
+
+  typedef Iterator<value_type> iterator;
+  typedef Iterator<const value_type> const_iterator;
+  typedef iterator local_iterator;
+
+  explicit ConcurrentHashMap(size_type n = 0, const _Hash& h = _Hash(),
+                             const _KeyEqual& eq = _KeyEqual())
+      : _hash(h), _eq(eq) {
+    initBuckets(bucketsFor(n));
+  }
+
+  ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+  ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+  ~ConcurrentHashMap() { destroyAll(); }
+
+  //! Number of buckets needed to hold n entries under the maximum load
+  static size_type bucketsFor(size_type n) {
+    size_type want = std::max<size_type>(MIN_BUCKETS, n / (MAX_LOAD * SLOTS));
+    size_type b    = 1;
+    while (b < want)
+      b <<= 1;
+    return b;
+  }
+
+  //! Number of entries; O(number of threads * overflow tables)
+  size_type size() const {
+    size_type n = 0;
+    for (unsigned i = 0; i < _counts.size(); ++i)
+      n += *_counts.getRemote(i);
+    if (const ConcurrentHashMap* o = _overflow.load(std::memory_order_acquire))
+      n += o->size();
+    return n;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  //! Slots of the main table, not counting overflow tables
+  size_type capacity() const { return _buckets.size() * SLOTS; }
+
+  /**
+   * Rebuilds the table with at least numBuckets buckets, moving entries in
+   * parallel and merging the overflow tables into it. Not thread safe.
+   */
+  void rehash(size_type numBuckets) {
+    numBuckets = std::max(numBuckets, bucketsFor(size()));
+    size_type b = 1;
+    while (b < numBuckets)
+      b <<= 1;
+    ConcurrentHashMap* chain = _overflow.exchange(nullptr);
+    if (b == _buckets.size() && !chain)
+      return;
+
+    LargeArray<Bucket> old;
+    std::swap(old, _buckets);
+    initBuckets(b);
+    for (unsigned i = 0; i < _counts.size(); ++i)
+      *_counts.getRemote(i) = 0;
+
+    absorb(old);
+    for (ConcurrentHashMap* o = chain; o;
+         o = o->_overflow.load(std::memory_order_relaxed))
+      absorb(o->_buckets);
+    // the chain only holds empty slots now
+    delete chain;
+  }
+
+  //! Makes room for n entries without growing. Not thread safe.
+  void reserve(size_type n) {
+    if (bucketsFor(n) > _buckets.size() ||
+        _overflow.load(std::memory_order_relaxed))
+      rehash(bucketsFor(n));
+  }
+
+  //! Removes all entries, keeping the capacity. Not thread safe.
+  void clear() {
+    Bucket* b = _buckets.data();
+    destroyAll();
+    forBuckets(_buckets.size(), [=](size_t i) {
+      for (size_t j = 0; j < SLOTS; ++j)
+        b[i].state[j].store(EMPTY, std::memory_order_relaxed);
+    });
+    for (unsigned i = 0; i < _counts.size(); ++i)
+      *_counts.getRemote(i) = 0;
+  }
+
+  /**
+   * Thread safe. Inserts a value-initialized entry for k if absent, then
+   * calls fn(mapped_type&) on its value while holding the slot. Returns true
+   * if k was inserted.
+   */
+  template <typename Fn>
+  bool insert_or_update(const key_type& k, Fn&& fn) {
+    return upsert(
+        k, [&](void* p) { new (p) value_type(k, mapped_type()); },
+        [&](value_type& v) { fn(v.second); }, true);
+  }
+
+  /**
+   * Thread safe. Inserts v if its key is absent; returns the entry and
+   * whether it was inserted. The entry may be updated concurrently by
+   * {@link insert_or_update}.
+   */
+  std::pair<iterator, bool> insert(const value_type& v) {
+    value_type* e     = nullptr;
+    size_type buckets = _buckets.size();
+    bool ins          = upsert(
+        v.first, [&](void* p) { new (p) value_type(v); },
+        [&](value_type& x) { e = &x; }, false);
+    // the entry moved if the insertion grew the table
+    if (buckets != _buckets.size())
+      return std::make_pair(find(v.first), ins);
+    return std::make_pair(locate(e), ins);
+  }
+
+  //! Thread safe lookup
+  iterator find(const key_type& k) {
+    size_t mask  = _buckets.size() - 1;
+    size_t limit = probeLimit();
+    size_t bi    = home(k);
+    for (size_t probe = 0; probe < limit; ++probe, bi = (bi + 1) & mask) {
+      Bucket& b = _buckets[bi];
+      for (size_t j = 0; j < SLOTS; ++j) {
+        uint8_t cur = b.state[j].load(std::memory_order_acquire);
+        if (cur == EMPTY)
+          return end();
+        waitInit(b.state[j], cur);
+        if (_eq(b.at(j)->first, k))
+          return makeIterator(b.at(j));
+      }
+    }
+    if (ConcurrentHashMap* o = _overflow.load(std::memory_order_acquire))
+      return o->find(k);
+    return end();
+  }
+
+  const_iterator find(const key_type& k) const {
+    return const_cast<ConcurrentHashMap*>(this)->find(k);
+  }
+
+  size_type count(const key_type& k) const { return find(k) != end() ? 1 : 0; }
+
+  iterator begin() {
+    auto r = allBuckets();
+    return iterator(r.first, r.second, this, false);
+  }
+  iterator end() { return iterator(); }
+  const_iterator begin() const {
+    return const_cast<ConcurrentHashMap*>(this)->begin();
+  }
+  const_iterator end() const {
+    return const_cast<ConcurrentHashMap*>(this)->end();
+  }
+
+  //! Entries in this thread's block of buckets, for galois::iterate(map)
+  local_iterator local_begin() {
+    auto r = localBuckets();
+    return local_iterator(r.first, r.second, this, true);
+  }
+  local_iterator local_end() { return local_iterator(); }
+
+private:
+  std::pair<Bucket*, Bucket*> allBuckets() {
+    return std::make_pair(_buckets.data(), _buckets.data() + _buckets.size());
+  }
+
+  std::pair<Bucket*, Bucket*> localBuckets() {
+    return galois::block_range(_buckets.data(),
+                               _buckets.data() + _buckets.size(),
+                               substrate::ThreadPool::getTID(),
+                               runtime::activeThreads);
+  }
+
+  //! Iterator to e, which may live in an overflow table
+  iterator locate(value_type* e) {
+    auto r = allBuckets();
+    if (reinterpret_cast<Bucket*>(e) >= r.first &&
+        reinterpret_cast<Bucket*>(e) < r.second)
+      return makeIterator(e);
+    return _overflow.load(std::memory_order_acquire)->locate(e);
+  }
+
+  iterator makeIterator(value_type* e) {
+    Bucket* b  = _buckets.data();
+    size_t off = reinterpret_cast<char*>(e) - reinterpret_cast<char*>(b);
+    Bucket* c  = b + off / sizeof(Bucket);
+    iterator it(c, b + _buckets.size(), this, false);
+    // skip() stopped at the first full slot of c; step to e
+    while (&*it != e)
+      ++it;
+    return it;
+  }
+};
+
+} // namespace galois
+
+#endif
@@ -25,6 +25,7 @@
 
 #include "galois/config.h"
 #include "galois/substrate/PerThreadStorage.h"
+#include "galois/substrate/ReductionBarrier.h"
 
 namespace galois {
 
@@ -115,6 +116,20 @@ public:
       *data_.getRemote(i) = IdFunc::operator()();
     }
   }
+
+  /**
+   * Fused reduction and barrier for rounds inside a parallel region. Every
+   * thread of the barrier calls this in place of waiting on a barrier; each
+   * gets the reduced value, and the thread local values are reset.
+   */
+  T reduceAtBarrier(substrate::ReductionBarrier<T>& barrier) {
+    T& local = *data_.getLocal();
+    T mine{std::move(local)};
+    local = IdFunc::operator()();
+    return barrier.wait(std::move(mine), [this](T& lhs, T&& rhs) {
+      merge(lhs, std::move(rhs));
+    });
+  }
 };
 
 /**
@@ -0,0 +1,464 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+/**
+ * @file SetIntersect.h
+ *
+ * Intersection of sorted sets, as used by triangle counting, k-truss and
+ * pattern mining. All kernels expect strictly increasing inputs (i.e., sorted
+ * neighbor lists without duplicates) and come in a count-only and a
+ * materializing flavor. The latter writes the common elements, in order, to
+ * an output buffer that must hold min(na, nb) elements.
+ *
+ * galois::intersectCount and galois::intersect pick a kernel per call:
+ * galloping search when one set is much larger than the other, otherwise a
+ * SIMD block-compare merge if the CPU the program runs on supports one
+ * (detected once at runtime), and a scalar merge otherwise.
+ */
+
+#ifndef GALOIS_SETINTERSECT_H
+#define GALOIS_SETINTERSECT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "galois/config.h"
+#include "galois/gIO.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GALOIS_SETINTERSECT_X86 1
+#include <immintrin.h>
+#define GALOIS_SETINTERSECT_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace galois {
+namespace setintersect {
+
+//! Merge kernels that can be selected at runtime
+enum class Kernel { SCALAR, AVX2, AVX512 };
+
+//! Size ratio above which galloping search beats a linear merge
+constexpr size_t GALLOP_RATIO = 32;
+
+//! True if the executing CPU can run kernel k
+inline bool isSupported(Kernel k) {
+#ifdef GALOIS_SETINTERSECT_X86
+  __builtin_cpu_init();
+  switch (k) {
+  case Kernel::AVX512:
+    return __builtin_cpu_supports("avx512f");
+  case Kernel::AVX2:
+    return __builtin_cpu_supports("avx2");
+  default:
+    return true;
+  }
+#else
+  return k == Kernel::SCALAR;
+#endif
+}
+
+/**
+ * Returns the merge kernel to use on the executing CPU; this does not depend
+ * on the flags the program was compiled with. The AVX-512 kernel compares
+ * 16x16 blocks, which does as many comparisons per element as AVX2 does on
+ * 8x8 blocks but skips less on sparse overlaps; it measured no faster, so it
+ * is only used when selected with setKernel.
+ */
+inline Kernel detectKernel() {
+  return isSupported(Kernel::AVX2) ? Kernel::AVX2 : Kernel::SCALAR;
+}
+
+inline Kernel& activeKernelRef() {
+  static Kernel kernel = detectKernel();
+  return kernel;
+}
+
+//! Kernel used by galois::intersectCount and galois::intersect
+inline Kernel activeKernel() { return activeKernelRef(); }
+
+/**
+ * Overrides the merge kernel, e.g. to compare kernels against each other.
+ * Selecting a kernel the CPU does not support is an error. Not thread safe;
+ * call outside of parallel loops.
+ */
+inline void setKernel(Kernel k) {
+  GALOIS_ASSERT(isSupported(k), "unsupported set intersection kernel");
+  activeKernelRef() = k;
+}
+
+//! Number of common elements of a and b via a branchy linear merge
+template <typename T>
+size_t mergeCount(const T* a, size_t na, const T* b, size_t nb) {
+  size_t i = 0, j = 0, count = 0;
+  while (i < na && j < nb) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      ++count;
+      ++i;
+      ++j;
+    }
+  }
+  return count;
+}
+
+//! Writes the common elements of a and b to out; returns how many
+template <typename T>
+size_t merge(const T* a, size_t na, const T* b, size_t nb, T* out) {
+  size_t i = 0, j = 0, k = 0;
+  while (i < na && j < nb) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      out[k++] = a[i];
+      ++i;
+      ++j;
+    }
+  }
+  return k;
+}
+
+/**
+ * Like std::lower_bound, but probes positions 1, 2, 4, ... first so that
+ * the cost is logarithmic in the distance to the result rather than in the
+ * length of the range.
+ */
+template <typename T>
+const T* gallopLowerBound(const T* first, const T* last, const T& key) {
+  size_t size = last - first;
+  if (size == 0 || !(*first < key))
+    return first;
+  size_t bound = 1;
+  while (bound < size && first[bound] < key)
+    bound *= 2;
+  return std::lower_bound(first + bound / 2 + 1,
+                          first + std::min(bound, size), key);
+}
+
+//! Count-only galloping intersection; a should be the smaller set
+template <typename T>
+size_t gallopCount(const T* a, size_t na, const T* b, size_t nb) {
+  const T* p   = b;
+  const T* end = b + nb;
+  size_t count = 0;
+  for (size_t i = 0; i < na; ++i) {
+    p = gallopLowerBound(p, end, a[i]);
+    if (p == end)
+      break;
+    if (!(a[i] < *p)) {
+      ++count;
+      ++p;
+    }
+  }
+  return count;
+}
+
+//! Materializing galloping intersection; a should be the smaller set
+template <typename T>
+size_t gallop(const T* a, size_t na, const T* b, size_t nb, T* out) {
+  const T* p   = b;
+  const T* end = b + nb;
+  size_t k     = 0;
+  for (size_t i = 0; i < na; ++i) {
+    p = gallopLowerBound(p, end, a[i]);
+    if (p == end)
+      break;
+    if (!(a[i] < *p)) {
+      out[k++] = a[i];
+      ++p;
+    }
+  }
+  return k;
+}
+
+namespace internal {
+template <bool Swapped, typename T, typename Fn>
+void forEachCommonImpl(const T* a, size_t na, const T* b, size_t nb, Fn& fn) {
+  auto call = [&](size_t i, size_t j) {
+    return Swapped ? fn(j, i) : fn(i, j);
+  };
+  if (na == 0)
+    return;
+  if (nb / na >= GALLOP_RATIO) {
+    const T* p   = b;
+    const T* end = b + nb;
+    for (size_t i = 0; i < na; ++i) {
+      p = gallopLowerBound(p, end, a[i]);
+      if (p == end)
+        return;
+      if (!(a[i] < *p)) {
+        if (!call(i, p - b))
+          return;
+        ++p;
+      }
+    }
+    return;
+  }
+  size_t i = 0, j = 0;
+  while (i < na && j < nb) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      if (!call(i, j))
+        return;
+      ++i;
+      ++j;
+    }
+  }
+}
+} // namespace internal
+
+/**
+ * Calls fn(i, j) for every pair of positions with a[i] == b[j], in increasing
+ * order, until fn returns false. For intersections that need more than the
+ * common values, e.g., the edge data at those positions; gallops through the
+ * larger set if the sizes are skewed.
+ */
+template <typename T, typename Fn>
+void forEachCommon(const T* a, size_t na, const T* b, size_t nb, Fn fn) {
+  if (na <= nb) {
+    internal::forEachCommonImpl<false>(a, na, b, nb, fn);
+  } else {
+    internal::forEachCommonImpl<true>(b, nb, a, na, fn);
+  }
+}
+
+#ifdef GALOIS_SETINTERSECT_X86
+// Block-compare merge: compare a block of a against every rotation of a
+// block of b, then advance whichever block has the smaller maximum (both if
+// equal). Each common element is found exactly once because the inputs have
+// no duplicates. Leftovers that do not fill a block go through the scalar
+// merge.
+
+GALOIS_SETINTERSECT_TARGET("avx2")
+inline uint32_t blockMaskAVX2(const uint32_t* a, const uint32_t* b) {
+  __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+  __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+  // rotations are taken from vb directly so they do not form a chain
+  __m256i eq = _mm256_cmpeq_epi32(va, vb);
+  for (int r = 1; r < 8; ++r) {
+    __m256i rot = _mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                   _mm256_set1_epi32(r));
+    rot         = _mm256_and_si256(rot, _mm256_set1_epi32(7));
+    eq          = _mm256_or_si256(
+        eq, _mm256_cmpeq_epi32(va, _mm256_permutevar8x32_epi32(vb, rot)));
+  }
+  return _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+}
+
+GALOIS_SETINTERSECT_TARGET("avx2")
+inline size_t mergeCountAVX2(const uint32_t* a, size_t na, const uint32_t* b,
+                             size_t nb) {
+  size_t i = 0, j = 0, count = 0;
+  while (i + 8 <= na && j + 8 <= nb) {
+    count += __builtin_popcount(blockMaskAVX2(a + i, b + j));
+    uint32_t amax = a[i + 7];
+    uint32_t bmax = b[j + 7];
+    i += (amax <= bmax) ? 8 : 0;
+    j += (bmax <= amax) ? 8 : 0;
+  }
+  return count + mergeCount(a + i, na - i, b + j, nb - j);
+}
+
+GALOIS_SETINTERSECT_TARGET("avx2")
+inline size_t mergeAVX2(const uint32_t* a, size_t na, const uint32_t* b,
+                        size_t nb, uint32_t* out) {
+  size_t i = 0, j = 0, k = 0;
+  while (i + 8 <= na && j + 8 <= nb) {
+    for (uint32_t m = blockMaskAVX2(a + i, b + j); m; m &= m - 1)
+      out[k++] = a[i + __builtin_ctz(m)];
+    uint32_t amax = a[i + 7];
+    uint32_t bmax = b[j + 7];
+    i += (amax <= bmax) ? 8 : 0;
+    j += (bmax <= amax) ? 8 : 0;
+  }
+  return k + merge(a + i, na - i, b + j, nb - j, out + k);
+}
+
+template <int R>
+GALOIS_SETINTERSECT_TARGET("avx512f")
+inline __mmask16 rotatedEqAVX512(__m512i va, __m512i vb) {
+  // maskz form, as the unmasked one trips -Wmaybe-uninitialized in GCC 12
+  return _mm512_cmpeq_epi32_mask(va,
+                                 _mm512_maskz_alignr_epi32(0xFFFF, vb, vb, R));
+}
+
+template <int... R>
+GALOIS_SETINTERSECT_TARGET("avx512f")
+inline __mmask16 blockMaskAVX512(__m512i va, const uint32_t* b,
+                                 std::integer_sequence<int, R...>) {
+  __m512i vb = _mm512_loadu_si512(b);
+  return (rotatedEqAVX512<R>(va, vb) | ...);
+}
+
+GALOIS_SETINTERSECT_TARGET("avx512f")
+inline __mmask16 blockMaskAVX512(__m512i va, const uint32_t* b) {
+  return blockMaskAVX512(va, b, std::make_integer_sequence<int, 16>());
+}
+
+GALOIS_SETINTERSECT_TARGET("avx512f")
+inline size_t mergeCountAVX512(const uint32_t* a, size_t na,
+                               const uint32_t* b, size_t nb) {
+  size_t i = 0, j = 0, count = 0;
+  while (i + 16 <= na && j + 16 <= nb) {
+    __m512i va = _mm512_loadu_si512(a + i);
+    count += __builtin_popcount(blockMaskAVX512(va, b + j));
+    uint32_t amax = a[i + 15];
+    uint32_t bmax = b[j + 15];
+    i += (amax <= bmax) ? 16 : 0;
+    j += (bmax <= amax) ? 16 : 0;
+  }
+  return count + mergeCount(a + i, na - i, b + j, nb - j);
+}
+
+GALOIS_SETINTERSECT_TARGET("avx512f")
+inline size_t mergeAVX512(const uint32_t* a, size_t na, const uint32_t* b,
+                          size_t nb, uint32_t* out) {
+  size_t i = 0, j = 0, k = 0;
+  while (i + 16 <= na && j + 16 <= nb) {
+    __m512i va   = _mm512_loadu_si512(a + i);
+    __mmask16 eq = blockMaskAVX512(va, b + j);
+    _mm512_mask_compressstoreu_epi32(out + k, eq, va);
+    k += __builtin_popcount(eq);
+    uint32_t amax = a[i + 15];
+    uint32_t bmax = b[j + 15];
+    i += (amax <= bmax) ? 16 : 0;
+    j += (bmax <= amax) ? 16 : 0;
+  }
+  return k + merge(a + i, na - i, b + j, nb - j, out + k);
+}
+#endif
+
+/**
+ * Dense membership set for intersecting many lists against one large (hub)
+ * neighbor list: mark the hub list once, then each intersection is a scan
+ * with one bit test per element. Not thread safe; keep one per thread.
+ */
+class Bitmap {
+  std::vector<uint64_t> words;
+
+public:
+  explicit Bitmap(size_t universe = 0) : words((universe + 63) / 64) {}
+
+  //! Values must be less than universe
+  void resize(size_t universe) { words.assign((universe + 63) / 64, 0); }
+
+  bool test(uint32_t x) const { return (words[x / 64] >> (x % 64)) & 1; }
+
+  void mark(const uint32_t* a, size_t na) {
+    for (size_t i = 0; i < na; ++i)
+      words[a[i] / 64] |= uint64_t{1} << (a[i] % 64);
+  }
+
+  //! Undoes mark(a, na) by zeroing the words it set bits in, so any other
+  //! bits in those words are cleared too; O(na) instead of O(universe)
+  void unmark(const uint32_t* a, size_t na) {
+    for (size_t i = 0; i < na; ++i)
+      words[a[i] / 64] = 0;
+  }
+
+  size_t count(const uint32_t* b, size_t nb) const {
+    size_t count = 0;
+    for (size_t i = 0; i < nb; ++i)
+      count += test(b[i]);
+    return count;
+  }
+
+  size_t intersect(const uint32_t* b, size_t nb, uint32_t* out) const {
+    size_t k = 0;
+    for (size_t i = 0; i < nb; ++i)
+      if (test(b[i]))
+        out[k++] = b[i];
+    return k;
+  }
+};
+
+} // namespace setintersect
+
+/**
+ * Number of elements common to the sorted, duplicate-free ranges a and b.
+ */
+template <typename T>
+size_t intersectCount(const T* a, size_t na, const T* b, size_t nb) {
+  if (na > nb) {
+    std::swap(a, b);
+    std::swap(na, nb);
+  }
+  if (na == 0)
+    return 0;
+  if (nb / na >= setintersect::GALLOP_RATIO)
+    return setintersect::gallopCount(a, na, b, nb);
+#ifdef GALOIS_SETINTERSECT_X86
+  if constexpr (std::is_same<T, uint32_t>::value) {
+    switch (setintersect::activeKernel()) {
+    case setintersect::Kernel::AVX512:
+      return setintersect::mergeCountAVX512(a, na, b, nb);
+    case setintersect::Kernel::AVX2:
+      return setintersect::mergeCountAVX2(a, na, b, nb);
+    default:
+      break;
+    }
+  }
+#endif
+  return setintersect::mergeCount(a, na, b, nb);
+}
+
+/**
+ * Writes the elements common to the sorted, duplicate-free ranges a and b to
+ * out in increasing order and returns their number. out must have room for
+ * min(na, nb) elements.
+ */
+template <typename T>
+size_t intersect(const T* a, size_t na, const T* b, size_t nb, T* out) {
+  if (na > nb) {
+    std::swap(a, b);
+    std::swap(na, nb);
+  }
+  if (na == 0)
+    return 0;
+  if (nb / na >= setintersect::GALLOP_RATIO)
+    return setintersect::gallop(a, na, b, nb, out);
+#ifdef GALOIS_SETINTERSECT_X86
+  if constexpr (std::is_same<T, uint32_t>::value) {
+    switch (setintersect::activeKernel()) {
+    case setintersect::Kernel::AVX512:
+      return setintersect::mergeAVX512(a, na, b, nb, out);
+    case setintersect::Kernel::AVX2:
+      return setintersect::mergeAVX2(a, na, b, nb, out);
+    default:
+      break;
+    }
+  }
+#endif
+  return setintersect::merge(a, na, b, nb, out);
+}
+
+} // namespace galois
+
+#endif
@@ -20,6 +20,8 @@
 #ifndef GALOIS_THREADS_H
 #define GALOIS_THREADS_H
 
+#include <functional>
+
 #include "galois/config.h"
 
 namespace galois {
@@ -37,5 +39,20 @@ unsigned int setActiveThreads(unsigned int num) noexcept;
  */
 unsigned int getActiveThreads() noexcept;
 
+/**
+ * Splits the active threads into numGroups equal-sized execution groups (e.g.,
+ * one per socket) and calls fn(group) concurrently, once for each group, on
+ * the first thread of that group. Parallel loops started from fn only run on
+ * the threads of its group, with their own barrier and termination detection,
+ * so several independent loops can make progress at the same time. Inside fn,
+ * getActiveThreads() is the group size and thread ids are relative to the
+ * group.
+ *
+ * Must be called outside of parallel execution. fn must not change the number
+ * of active threads. Returns the number of threads per group.
+ */
+unsigned int runInGroups(unsigned int numGroups,
+                         const std::function<void(unsigned int)>& fn);
+
 } // namespace galois
 #endif
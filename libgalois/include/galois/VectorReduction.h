@@ -0,0 +1,497 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef GALOIS_VECTORREDUCTION_H
+#define GALOIS_VECTORREDUCTION_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "galois/config.h"
+#include "galois/Loops.h"
+#include "galois/Reduction.h"
+#include "galois/substrate/CompilerSpecific.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+namespace galois {
+
+namespace internal {
+
+/**
+ * Per thread values that are reset lazily: reset() only advances an epoch,
+ * and each thread clears its own value the first time it uses it afterwards.
+ * Threads that do not update between resets never touch their values.
+ */
+template <typename T>
+class LazyPerThread {
+  struct Slot {
+    unsigned epoch = 0;
+    T value;
+  };
+
+  substrate::PerThreadStorage<Slot> slots_;
+  unsigned epoch_ = 1;
+
+public:
+  //! Local value; clearFn(T&) clears it if it is stale
+  template <typename ClearFn>
+  T& getLocal(ClearFn&& clearFn) {
+    Slot& s = *slots_.getLocal();
+    if (s.epoch != epoch_) {
+      clearFn(s.value);
+      s.epoch = epoch_;
+    }
+    return s.value;
+  }
+
+  //! Not thread safe
+  void reset() { ++epoch_; }
+
+  //! Values updated since the last reset
+  std::vector<T*> live() {
+    std::vector<T*> ret;
+    for (unsigned i = 0; i < slots_.size(); ++i) {
+      Slot& s = *slots_.getRemote(i);
+      if (s.epoch == epoch_)
+        ret.push_back(&s.value);
+    }
+    return ret;
+  }
+};
+
+} // namespace internal
+
+/**
+ * Reducible for a fixed-size array of T where elements are merged
+ * elementwise with MergeFunc, as in Reducible. Each thread updates its own
+ * copy of the array, padded so that no two copies share a cache line.
+ *
+ * reduce() merges the copies in parallel: each iteration of a do_all merges a
+ * block of about 16 cache lines across all copies, so threads do not contend
+ * on the output. The result becomes the value of the reducible, and the
+ * copies are reset lazily.
+ */
+template <typename T, typename MergeFunc, typename IdFunc>
+class GVectorReducible : public MergeFunc, public IdFunc {
+  //! Elements of padding on each side of a copy
+  static constexpr size_t PAD =
+      substrate::GALOIS_CACHE_LINE_SIZE / sizeof(T) + 1;
+  //! Elements merged per do_all iteration in reduce()
+  static constexpr size_t BLOCK = 16 * PAD;
+
+  struct Copy {
+    std::vector<T> storage;
+    T* data = nullptr;
+  };
+
+  internal::LazyPerThread<Copy> copies_;
+  std::vector<T> value_;
+
+  T* local() {
+    size_t n = value_.size();
+    T id     = IdFunc::operator()();
+    return copies_
+        .getLocal([n, &id](Copy& c) {
+          if (c.storage.size() < n + 2 * PAD) {
+            c.storage.assign(n + 2 * PAD, id);
+            c.data = c.storage.data() + PAD;
+          } else {
+            std::fill(c.data, c.data + n, id);
+          }
+        })
+        .data;
+  }
+
+public:
+  using value_type = T;
+
+  explicit GVectorReducible(size_t n = 0)
+      : value_(n, IdFunc::operator()()) {}
+
+  size_t size() const { return value_.size(); }
+
+  //! Changes the number of elements and resets all of them. Not thread safe.
+  void resize(size_t n) {
+    value_.assign(n, IdFunc::operator()());
+    copies_.reset();
+  }
+
+  //! Merges v into element i of the thread local copy
+  void update(size_t i, const T& v) {
+    T& x = local()[i];
+    x    = MergeFunc::operator()(x, v);
+  }
+
+  //! Returns a reference to element i of the thread local copy
+  T& getLocal(size_t i) { return local()[i]; }
+
+  /**
+   * Returns the elementwise merge of all updates since the last reset. Only
+   * valid outside the parallel region.
+   */
+  const std::vector<T>& reduce() {
+    std::vector<Copy*> live = copies_.live();
+    if (live.empty())
+      return value_;
+    size_t n = value_.size();
+    galois::do_all(
+        galois::iterate(size_t{0}, (n + BLOCK - 1) / BLOCK),
+        [&](size_t b) {
+          size_t beg = b * BLOCK;
+          size_t end = std::min(beg + BLOCK, n);
+          for (Copy* c : live)
+            for (size_t i = beg; i < end; ++i)
+              value_[i] = MergeFunc::operator()(value_[i], c->data[i]);
+        },
+        galois::no_stats());
+    copies_.reset();
+    return value_;
+  }
+
+  //! Resets all elements to the identity; thread local copies are cleared
+  //! lazily
+  void reset() {
+    std::fill(value_.begin(), value_.end(), IdFunc::operator()());
+    copies_.reset();
+  }
+};
+
+//! Accumulator for a fixed-size array of T where accumulation is elementwise
+//! plus
+template <typename T>
+class GVectorAccumulator
+    : public GVectorReducible<T, std::plus<T>, identity_value_zero<T>> {
+  using base_type = GVectorReducible<T, std::plus<T>, identity_value_zero<T>>;
+
+public:
+  explicit GVectorAccumulator(size_t n = 0) : base_type(n) {}
+};
+
+//! Elementwise max-reducer for a fixed-size array of T
+template <typename T>
+class GVectorReduceMax
+    : public GVectorReducible<T, gmax<T>, identity_value_min<T>> {
+  using base_type = GVectorReducible<T, gmax<T>, identity_value_min<T>>;
+
+public:
+  explicit GVectorReduceMax(size_t n = 0) : base_type(n) {}
+};
+
+/**
+ * Accumulator for a sparse histogram: counts of type C for keys of type K.
+ * Each thread counts into its own hash map. reduce() merges the maps in
+ * parallel in pairs, log(threads) rounds deep, and the merged counts become
+ * the value of the histogram. Thread local maps are reset lazily and keep
+ * their buckets for reuse.
+ */
+template <typename K, typename C = uint64_t, typename Hash = std::hash<K>>
+class GHistogram {
+  typedef std::unordered_map<K, C, Hash> LocalMap;
+
+  internal::LazyPerThread<LocalMap> maps_;
+  std::map<K, C> value_;
+
+  LocalMap& local() {
+    return maps_.getLocal([](LocalMap& m) { m.clear(); });
+  }
+
+public:
+  typedef K key_type;
+  typedef C mapped_type;
+
+  //! Adds c to the count of k in the thread local map
+  void update(const K& k, const C& c = C(1)) { local()[k] += c; }
+
+  /**
+   * Returns the counts of all keys updated since the last reset, ordered by
+   * key. Only valid outside the parallel region.
+   */
+  const std::map<K, C>& reduce() {
+    std::vector<LocalMap*> live = maps_.live();
+    for (size_t stride = 1; stride < live.size(); stride *= 2) {
+      galois::do_all(
+          galois::iterate(size_t{0}, (live.size() + 2 * stride - 1) /
+                                         (2 * stride)),
+          [&](size_t p) {
+            size_t dst = 2 * stride * p;
+            size_t src = dst + stride;
+            if (src >= live.size())
+              return;
+            LocalMap& to = *live[dst];
+            for (auto& kv : *live[src])
+              to[kv.first] += kv.second;
+          },
+          galois::no_stats());
+    }
+    if (!live.empty()) {
+      for (auto& kv : *live[0])
+        value_[kv.first] += kv.second;
+    }
+    maps_.reset();
+    return value_;
+  }
+
+  //! Clears all counts; thread local maps are cleared lazily
+  void reset() {
+    value_.clear();
+    maps_.reset();
+  }
+};
+
+/**
+ * Reducible for the k largest values of T under Compare. Each thread keeps
+ * the k largest values it has seen in a heap of its own. reduce() merges the
+ * heaps into the value of the reducible, the k largest values largest first,
+ * and the heaps are reset lazily.
+ */
+template <typename T, typename Compare = std::less<T>>
+class GTopK {
+  //! Heap order with the smallest kept value in front
+  struct Greater {
+    Compare comp;
+    bool operator()(const T& a, const T& b) const { return comp(b, a); }
+  };
+
+  size_t k_;
+  Compare comp_;
+  internal::LazyPerThread<std::vector<T>> heaps_;
+  std::vector<T> value_;
+
+public:
+  typedef T value_type;
+
+  explicit GTopK(size_t k, Compare comp = Compare()) : k_(k), comp_(comp) {}
+
+  size_t k() const { return k_; }
+
+  //! Adds v to the thread local heap if it is among the k largest
+  void update(const T& v) {
+    std::vector<T>& h =
+        heaps_.getLocal([](std::vector<T>& heap) { heap.clear(); });
+    if (h.size() < k_) {
+      h.push_back(v);
+      std::push_heap(h.begin(), h.end(), Greater{comp_});
+    } else if (k_ && comp_(h.front(), v)) {
+      std::pop_heap(h.begin(), h.end(), Greater{comp_});
+      h.back() = v;
+      std::push_heap(h.begin(), h.end(), Greater{comp_});
+    }
+  }
+
+  /**
+   * Merges two lists sorted largest first into the first, keeping the k
+   * largest values.
+   */
+  void mergeSorted(std::vector<T>& into, const std::vector<T>& from) const {
+    std::vector<T> merged;
+    merged.reserve(std::min(k_, into.size() + from.size()));
+    auto a = into.begin();
+    auto b = from.begin();
+    while (merged.size() < k_ && (a != into.end() || b != from.end())) {
+      if (b == from.end() || (a != into.end() && !comp_(*a, *b)))
+        merged.push_back(std::move(*a++));
+      else
+        merged.push_back(*b++);
+    }
+    into = std::move(merged);
+  }
+
+  /**
+   * Returns the k largest values updated since the last reset, largest
+   * first. Only valid outside the parallel region.
+   */
+  const std::vector<T>& reduce() {
+    for (std::vector<T>* h : heaps_.live()) {
+      std::sort(h->begin(), h->end(), Greater{comp_});
+      mergeSorted(value_, *h);
+    }
+    heaps_.reset();
+    return value_;
+  }
+
+  //! Clears the values; thread local heaps are cleared lazily
+  void reset() {
+    value_.clear();
+    heaps_.reset();
+  }
+};
+
+/**
+ * Mergeable summary of a multiset of T for approximate quantiles.
+ *
+ * Values are kept in levels of at most k values, where a value at level h
+ * stands for 2^h values. When a level overflows, it is sorted and every
+ * other value moves up a level (alternating between the odd and even ones).
+ * Merging appends levels and compacts them the same way. The rank of a
+ * quantile is off by about n * log2(n / k) / k at most, in memory of about
+ * k * log2(n / k) values.
+ */
+template <typename T>
+class QuantileSketch {
+  std::vector<std::vector<T>> levels_;
+  size_t k_;
+  bool odd_ = false;
+
+  void compact() {
+    for (size_t h = 0; h < levels_.size(); ++h) {
+      if (levels_[h].size() <= k_)
+        continue;
+      if (h + 1 == levels_.size())
+        levels_.emplace_back();
+      std::vector<T>& level = levels_[h];
+      std::sort(level.begin(), level.end());
+      // an odd value out stays at this level so no weight is lost
+      size_t end = level.size() & ~size_t(1);
+      for (size_t i = odd_ ? 1 : 0; i < end; i += 2)
+        levels_[h + 1].push_back(level[i]);
+      odd_ = !odd_;
+      if (end < level.size())
+        level[0] = level[end];
+      level.resize(level.size() - end);
+    }
+  }
+
+public:
+  typedef T value_type;
+
+  explicit QuantileSketch(size_t k = 256) : levels_(1), k_(k) {
+    assert(k > 0);
+  }
+
+  //! Levels of values; a value at level h stands for 2^h values
+  const std::vector<std::vector<T>>& levels() const { return levels_; }
+
+  void insert(const T& v) {
+    levels_[0].push_back(v);
+    if (levels_[0].size() > k_)
+      compact();
+  }
+
+  //! Merges the levels of another sketch into this one
+  void merge(const std::vector<std::vector<T>>& levels) {
+    if (levels_.size() < levels.size())
+      levels_.resize(levels.size());
+    for (size_t h = 0; h < levels.size(); ++h)
+      levels_[h].insert(levels_[h].end(), levels[h].begin(), levels[h].end());
+    compact();
+  }
+
+  void merge(const QuantileSketch& other) { merge(other.levels_); }
+
+  //! Number of values inserted, including merged sketches
+  uint64_t count() const {
+    uint64_t n = 0;
+    for (size_t h = 0; h < levels_.size(); ++h)
+      n += uint64_t(levels_[h].size()) << h;
+    return n;
+  }
+
+  bool empty() const { return count() == 0; }
+
+  /**
+   * Approximate q-quantile: the smallest value with at least q * count()
+   * values less than or equal to it. Must not be empty.
+   *
+   * @param q in [0, 1]
+   */
+  T quantile(double q) const {
+    return quantiles(std::vector<double>{q})[0];
+  }
+
+  //! Approximate quantiles for each of qs in one pass
+  std::vector<T> quantiles(const std::vector<double>& qs) const {
+    assert(!empty());
+    std::vector<std::pair<T, uint64_t>> weighted;
+    for (size_t h = 0; h < levels_.size(); ++h)
+      for (const T& v : levels_[h])
+        weighted.emplace_back(v, uint64_t(1) << h);
+    std::sort(weighted.begin(), weighted.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    uint64_t total = count();
+    std::vector<T> ret;
+    ret.reserve(qs.size());
+    for (double q : qs) {
+      double target = q * total;
+      uint64_t seen = 0;
+      size_t i      = 0;
+      while (i + 1 < weighted.size() &&
+             double(seen + weighted[i].second) < target) {
+        seen += weighted[i].second;
+        ++i;
+      }
+      ret.push_back(weighted[i].first);
+    }
+    return ret;
+  }
+
+  void clear() {
+    levels_.assign(1, std::vector<T>());
+    odd_ = false;
+  }
+};
+
+/**
+ * Reducible for approximate quantiles of values of T. Each thread inserts
+ * into a QuantileSketch of its own; reduce() merges them into the value of
+ * the reducible, and the thread local sketches are reset lazily.
+ */
+template <typename T>
+class GQuantiles {
+  size_t k_;
+  internal::LazyPerThread<QuantileSketch<T>> sketches_;
+  QuantileSketch<T> value_;
+
+public:
+  typedef T value_type;
+
+  //! @param k values per level of the sketches; error shrinks with k
+  explicit GQuantiles(size_t k = 256) : k_(k), value_(k) {}
+
+  void update(const T& v) {
+    sketches_
+        .getLocal([this](QuantileSketch<T>& s) { s = QuantileSketch<T>(k_); })
+        .insert(v);
+  }
+
+  /**
+   * Returns the sketch of all values updated since the last reset. Only
+   * valid outside the parallel region.
+   */
+  QuantileSketch<T>& reduce() {
+    for (QuantileSketch<T>* s : sketches_.live())
+      value_.merge(*s);
+    sketches_.reset();
+    return value_;
+  }
+
+  //! Clears the values; thread local sketches are cleared lazily
+  void reset() {
+    value_.clear();
+    sketches_.reset();
+  }
+};
+
+} // namespace galois
+
+#endif // GALOIS_VECTORREDUCTION_H
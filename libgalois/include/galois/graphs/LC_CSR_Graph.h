@@ -549,6 +549,54 @@ public:
     }
   }
 
+  /**
+   * Uses existing arrays (e.g. a memory mapped file) for the edge index,
+   * edge destination, and edge data arrays instead of allocating them. Node
+   * data is still allocated; call constructNodes afterwards as usual. The
+   * graph does not free the arrays, so they must outlive it.
+   *
+   * @param nNodes number of nodes
+   * @param nEdges number of edges
+   * @param edgeInd edge index array with nNodes entries
+   * @param dsts edge destination array with nEdges entries
+   * @param edgeDataArray edge data array with nEdges entries; ignored if
+   * edge data is void
+   */
+  void allocateFromExisting(uint32_t nNodes, uint64_t nEdges,
+                            uint64_t* edgeInd, uint32_t* dsts,
+                            void* edgeDataArray) {
+    numNodes = nNodes;
+    numEdges = nEdges;
+
+    if (UseNumaAlloc) {
+      nodeData.allocateBlocked(numNodes);
+      this->outOfLineAllocateBlocked(numNodes);
+    } else {
+      nodeData.allocateInterleaved(numNodes);
+      this->outOfLineAllocateInterleaved(numNodes);
+    }
+
+    EdgeIndData existingInd(edgeInd, numNodes);
+    EdgeDst existingDst(dsts, numEdges);
+    EdgeData existingData(edgeDataArray, numEdges);
+    swap(edgeIndData, existingInd);
+    swap(edgeDst, existingDst);
+    swap(edgeData, existingData);
+  }
+
+  //! Edge index array: entry n is the end of node n's edges
+  const uint64_t* edgeIndexArray() const { return edgeIndData.data(); }
+  //! Edge destination array
+  const uint32_t* edgeDstArray() const { return edgeDst.data(); }
+  //! Edge data array; nullptr if edge data is void
+  const void* edgeDataArray() const {
+    if constexpr (std::is_void<EdgeTy>::value) {
+      return nullptr;
+    } else {
+      return edgeData.data();
+    }
+  }
+
   void destroyAndAllocateFrom(uint32_t nNodes, uint64_t nEdges) {
     numNodes = nNodes;
     numEdges = nEdges;
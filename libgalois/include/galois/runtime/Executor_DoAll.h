@@ -266,8 +266,9 @@ private:
     const unsigned my_pack  = substrate::ThreadPool::getSocket();
     const unsigned per_pack = tp.getMaxThreads() / tp.getMaxSockets();
 
-    const unsigned pack_beg = my_pack * per_pack;
-    const unsigned pack_end = (my_pack + 1) * per_pack;
+    const unsigned pack_beg =
+        substrate::ThreadPool::getGroupTID(my_pack * per_pack);
+    const unsigned pack_end = pack_beg + per_pack;
 
     for (unsigned i = 1; i < pack_end; ++i) {
 
@@ -59,13 +59,18 @@ class AbortHandler {
   substrate::PerThreadStorage<AbortedList> queues;
   bool useBasicPolicy;
 
+  //! Leader of a socket as a thread id of the current execution group
+  unsigned leaderForSocket(unsigned socket) {
+    return substrate::ThreadPool::getGroupTID(
+        substrate::getThreadPool().getLeaderForSocket(socket));
+  }
+
   /**
    * Policy: serialize via tree over sockets.
    */
   void basicPolicy(const Item& item) {
-    auto& tp        = substrate::getThreadPool();
-    unsigned socket = tp.getSocket();
-    queues.getRemote(tp.getLeaderForSocket(socket / 2))->push(item);
+    unsigned socket = substrate::ThreadPool::getSocket();
+    queues.getRemote(leaderForSocket(socket / 2))->push(item);
   }
 
   /**
@@ -80,14 +85,13 @@ class AbortHandler {
     }
 
     unsigned tid    = substrate::ThreadPool::getTID();
-    auto& tp        = substrate::getThreadPool();
     unsigned socket = substrate::ThreadPool::getSocket();
     unsigned leader = substrate::ThreadPool::getLeader();
     if (tid != leader) {
       unsigned next = leader + (tid - leader) / 2;
       queues.getRemote(next)->push(item);
     } else {
-      queues.getRemote(tp.getLeaderForSocket(socket / 2))->push(item);
+      queues.getRemote(leaderForSocket(socket / 2))->push(item);
     }
   }
 
@@ -103,14 +107,13 @@ class AbortHandler {
     }
 
     unsigned tid    = substrate::ThreadPool::getTID();
-    auto& tp        = substrate::getThreadPool();
     unsigned socket = substrate::ThreadPool::getSocket();
-    unsigned leader = tp.getLeaderForSocket(socket);
+    unsigned leader = leaderForSocket(socket);
     if (retries < 5 && tid != leader) {
       unsigned next = leader + (tid - leader) / 2;
       queues.getRemote(next)->push(item);
     } else {
-      queues.getRemote(tp.getLeaderForSocket(socket / 2))->push(item);
+      queues.getRemote(leaderForSocket(socket / 2))->push(item);
     }
   }
 
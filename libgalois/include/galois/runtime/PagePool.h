@@ -73,7 +73,7 @@ class PageAllocState {
   void* allocFromOS() {
     void* ptr = galois::substrate::allocPages(1, true);
     assert(ptr);
-    auto tid = galois::substrate::ThreadPool::getTID();
+    auto tid = galois::substrate::ThreadPool::getPoolTID();
     counts[tid] += 1;
     std::lock_guard<galois::substrate::SimpleLock> lg(mapLock);
     ownerMap[ptr] = tid;
@@ -94,7 +94,7 @@ public:
   }
 
   void* pageAlloc() {
-    auto tid    = galois::substrate::ThreadPool::getTID();
+    auto tid    = galois::substrate::ThreadPool::getPoolTID();
     HeadPtr& hp = pool[tid].data;
     if (hp.getValue()) {
       hp.lock();
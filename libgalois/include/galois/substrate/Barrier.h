@@ -22,6 +22,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "galois/config.h"
 #include "galois/gIO.h"
@@ -71,16 +72,68 @@ std::unique_ptr<Barrier> createDisseminationBarrier(unsigned);
  */
 std::unique_ptr<Barrier> createSimpleBarrier(unsigned int);
 
+//! Barrier implementations that getBarrier() can choose from
+enum class BarrierKind {
+  Topo,
+  MCS,
+  Dissemination,
+  Counting,
+  Pthread,
+  Simple,
+  NumKinds
+};
+
+/**
+ * Create a barrier of the given kind. Returns null if the kind is not
+ * supported on this platform.
+ */
+std::unique_ptr<Barrier> createBarrier(BarrierKind kind, unsigned);
+
+/**
+ * Times waits on each kind of barrier (except the simple barrier) with
+ * numThreads threads of the pool and returns the fastest. Must not be called
+ * from inside a parallel region.
+ */
+BarrierKind tuneBarrier(unsigned numThreads);
+
 namespace internal {
 
+/**
+ * Reads GALOIS_BARRIER; returns false if it is unset or "auto".
+ */
+bool getFixedBarrierKind(BarrierKind& kind);
+
+/**
+ * Selects the barrier returned by getBarrier() for each number of threads.
+ * By default, the kind is chosen with tuneBarrier() the first time a number of
+ * threads is used. Setting the environment variable GALOIS_BARRIER to topo,
+ * mcs, dissemination, counting, pthread or simple fixes the kind instead.
+ */
 template <typename _UNUSED = void>
 struct BarrierInstance {
   unsigned m_num_threads;
-  std::unique_ptr<Barrier> m_barrier;
+  Barrier* m_barrier;
+  //! Barriers are kept once created so references stay valid
+  std::unique_ptr<Barrier> m_barriers[(int)BarrierKind::NumKinds];
+  //! Chosen kind per number of threads; NumKinds if not tuned yet
+  std::vector<BarrierKind> m_choice;
+  bool m_autoTune;
+  BarrierKind m_fixed;
+
+  BarrierInstance(void)
+      : m_num_threads(0), m_barrier(nullptr), m_fixed(BarrierKind::Topo) {
+    m_autoTune = !getFixedBarrierKind(m_fixed);
+    m_choice.resize(getThreadPool().getMaxThreads() + 1, BarrierKind::NumKinds);
+  }
 
-  BarrierInstance(void) {
-    m_num_threads = getThreadPool().getMaxThreads();
-    m_barrier     = createTopoBarrier(m_num_threads);
+  Barrier& select(BarrierKind kind, unsigned numT) {
+    auto& b = m_barriers[(int)kind];
+    if (!b)
+      b = createBarrier(kind, numT);
+    if (!b)
+      return select(BarrierKind::Topo, numT);
+    b->reinit(numT);
+    return *b;
   }
 
   Barrier& get(unsigned numT) {
@@ -91,8 +144,17 @@ struct BarrierInstance {
     numT = std::max(numT, 1u);
 
     if (numT != m_num_threads) {
-      m_num_threads = numT;
-      m_barrier->reinit(numT);
+      m_num_threads    = numT;
+      BarrierKind kind = m_fixed;
+      if (m_autoTune) {
+        kind = m_choice[numT];
+        // timing needs the thread pool; fall back to Topo inside a loop
+        if (kind == BarrierKind::NumKinds && !getThreadPool().isRunning())
+          kind = m_choice[numT] = tuneBarrier(numT);
+        if (kind == BarrierKind::NumKinds)
+          kind = BarrierKind::Topo;
+      }
+      m_barrier = &select(kind, numT);
     }
 
     return *m_barrier;
@@ -101,6 +163,12 @@ struct BarrierInstance {
 
 void setBarrierInstance(BarrierInstance<>* bi);
 
+/**
+ * Creates the barriers returned by getBarrier() inside execution groups 1 to
+ * numGroups. Call with numGroups = 0 to release them.
+ */
+void setGroupBarriers(unsigned numGroups, unsigned groupSize);
+
 } // end namespace internal
 
 } // end namespace substrate
@@ -137,22 +137,22 @@ public:
 
   //! Like getLocal() but optimized for when you already know the thread id
   T* getLocal(unsigned int thread) {
-    void* ditem = b->getLocal(offset, thread);
+    void* ditem = b->getLocal(offset, ThreadPool::getPoolTID(thread));
     return reinterpret_cast<T*>(ditem);
   }
 
   const T* getLocal(unsigned int thread) const {
-    void* ditem = b->getLocal(offset, thread);
+    void* ditem = b->getLocal(offset, ThreadPool::getPoolTID(thread));
     return reinterpret_cast<T*>(ditem);
   }
 
   T* getRemote(unsigned int thread) {
-    void* ditem = b->getRemote(thread, offset);
+    void* ditem = b->getRemote(ThreadPool::getPoolTID(thread), offset);
     return reinterpret_cast<T*>(ditem);
   }
 
   const T* getRemote(unsigned int thread) const {
-    void* ditem = b->getRemote(thread, offset);
+    void* ditem = b->getRemote(ThreadPool::getPoolTID(thread), offset);
     return reinterpret_cast<T*>(ditem);
   }
 
@@ -211,22 +211,22 @@ public:
 
   //! Like getLocal() but optimized for when you already know the thread id
   T* getLocal(unsigned int thread) {
-    void* ditem = b.getLocal(offset, thread);
+    void* ditem = b.getLocal(offset, ThreadPool::getPoolTID(thread));
     return reinterpret_cast<T*>(ditem);
   }
 
   const T* getLocal(unsigned int thread) const {
-    void* ditem = b.getLocal(offset, thread);
+    void* ditem = b.getLocal(offset, ThreadPool::getPoolTID(thread));
     return reinterpret_cast<T*>(ditem);
   }
 
   T* getRemote(unsigned int thread) {
-    void* ditem = b.getRemote(thread, offset);
+    void* ditem = b.getRemote(ThreadPool::getPoolTID(thread), offset);
     return reinterpret_cast<T*>(ditem);
   }
 
   const T* getRemote(unsigned int thread) const {
-    void* ditem = b.getRemote(thread, offset);
+    void* ditem = b.getRemote(ThreadPool::getPoolTID(thread), offset);
     return reinterpret_cast<T*>(ditem);
   }
 
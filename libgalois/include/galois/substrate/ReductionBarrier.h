@@ -0,0 +1,110 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef GALOIS_SUBSTRATE_REDUCTIONBARRIER_H
+#define GALOIS_SUBSTRATE_REDUCTIONBARRIER_H
+
+#include <atomic>
+#include <utility>
+
+#include "galois/config.h"
+#include "galois/substrate/CompilerSpecific.h"
+#include "galois/substrate/PerThreadStorage.h"
+#include "galois/substrate/ThreadPool.h"
+
+namespace galois {
+namespace substrate {
+
+/**
+ * Barrier that also reduces one value per thread. Threads arrive up a 4-ary
+ * tree over thread ids, merging the values of their children on the way, and
+ * the root sends the result back down the same tree as the release signal.
+ * A reduction followed by a barrier thus costs one tree pass instead of a
+ * barrier plus a serial pass over all threads.
+ *
+ * Consecutive thread ids share a socket, so most tree edges are local.
+ */
+template <typename T>
+class ReductionBarrier {
+  static constexpr unsigned ARITY = 4;
+
+  struct Node {
+    T value;
+    std::atomic<unsigned> arrived{0};
+    std::atomic<unsigned> released{0};
+  };
+
+  PerThreadStorage<Node> nodes;
+  PerThreadStorage<unsigned> sense;
+  unsigned numThreads;
+
+public:
+  explicit ReductionBarrier(unsigned numT) { reinit(numT); }
+
+  //! Not safe if any thread is in wait
+  void reinit(unsigned numT) {
+    numThreads = numT;
+    for (unsigned i = 0; i < nodes.size(); ++i) {
+      nodes.getRemote(i)->arrived  = 0;
+      nodes.getRemote(i)->released = 0;
+      *sense.getRemote(i)          = 0;
+    }
+  }
+
+  /**
+   * Waits for all threads and returns the merge of the values they passed
+   * in. merge(T& lhs, T&& rhs) folds rhs into lhs; values are merged in an
+   * unspecified order.
+   */
+  template <typename MergeFn>
+  T wait(T local, MergeFn&& merge) {
+    unsigned id = ThreadPool::getTID();
+    unsigned s  = ++*sense.getLocal();
+    Node& me    = *nodes.getLocal();
+    me.value    = std::move(local);
+
+    unsigned first = ARITY * id + 1;
+    unsigned last  = std::min(first + ARITY, numThreads);
+    for (unsigned c = first; c < last; ++c) {
+      Node& child = *nodes.getRemote(c);
+      while (child.arrived.load(std::memory_order_acquire) != s)
+        asmPause();
+      merge(me.value, std::move(child.value));
+    }
+
+    if (id != 0) {
+      me.arrived.store(s, std::memory_order_release);
+      while (me.released.load(std::memory_order_acquire) != s)
+        asmPause();
+    }
+
+    // me.value now holds the result
+    for (unsigned c = first; c < last; ++c) {
+      Node& child = *nodes.getRemote(c);
+      child.value = me.value;
+      child.released.store(s, std::memory_order_release);
+    }
+    return me.value;
+  }
+};
+
+} // end namespace substrate
+} // end namespace galois
+
+#endif
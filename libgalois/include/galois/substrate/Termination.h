@@ -255,6 +255,12 @@ public:
 };
 
 void setTermDetect(TerminationDetection* term);
+
+/**
+ * Creates the detectors returned by getSystemTermination() inside execution
+ * groups 1 to numGroups. Call with numGroups = 0 to release them.
+ */
+void setGroupTermDetect(unsigned numGroups);
 } // end namespace internal
 
 } // namespace substrate
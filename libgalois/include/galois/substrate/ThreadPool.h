@@ -20,6 +20,7 @@
 #ifndef GALOIS_SUBSTRATE_THREADPOOL_H
 #define GALOIS_SUBSTRATE_THREADPOOL_H
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <condition_variable>
@@ -62,6 +63,17 @@ protected:
     std::function<void(void)> fn;
   }; //! type to switch to dedicated mode
 
+  //! A contiguous range of threads that runs parallel sections independently
+  //! of the rest of the pool. Group 0 is the whole pool; runGroups() creates
+  //! groups 1..n.
+  struct group_ty {
+    unsigned id;
+    unsigned base; //!< pool-wide id of the first thread in the group
+    unsigned size; //!< number of threads in the group
+    bool running;
+    std::function<void(void)> work;
+  };
+
   //! Per-thread mailboxes for notification
   struct per_signal {
     std::condition_variable cv;
@@ -70,6 +82,9 @@ protected:
     std::atomic<int> done;
     std::atomic<int> fastRelease;
     ThreadTopoInfo topo;
+    group_ty* group{nullptr}; // group of the current parallel section
+    unsigned groupBase{0};    // cached group->base
+    unsigned poolSize{~0U};   // number of threads in the pool
 
     void wakeup(bool fastmode) {
       if (fastmode) {
@@ -104,8 +119,7 @@ protected:
   std::vector<std::thread> threads;
   unsigned reserved;
   unsigned masterFastmode;
-  bool running;
-  std::function<void(void)> work;
+  group_ty root;
 
   //! destroy all threads
   void destroyCommon();
@@ -154,7 +168,7 @@ public:
     // paying for an indirection in work allows small-object optimization in
     // std::function to kick in and avoid a heap allocation
     ExecuteTuple lwork(std::forward<Args>(args)...);
-    work = std::ref(lwork);
+    my_box.group->work = std::ref(lwork);
     // work =
     // std::function<void(void)>(ExecuteTuple(std::forward<Args>(args)...));
     assert(num <= getMaxThreads());
@@ -164,12 +178,20 @@ public:
   //! run function in a dedicated thread until the threadpool exits
   void runDedicated(std::function<void(void)>& f);
 
+  //! split the first numGroups * groupSize threads into execution groups and
+  //! call fn(group) concurrently on the first thread of each group; parallel
+  //! sections started from fn only use the threads of that group
+  void runGroups(unsigned numGroups, unsigned groupSize,
+                 const std::function<void(unsigned)>& fn);
+
   // experimental: busy wait for work
   void burnPower(unsigned num);
   // experimental: leave busy wait
   void beKind();
 
-  bool isRunning() const { return running; }
+  bool isRunning() const {
+    return my_box.group ? my_box.group->running : root.running;
+  }
 
   //! return the number of non-reserved threads in the pool
   unsigned getMaxUsableThreads() const { return mi.maxThreads - reserved; }
@@ -180,35 +202,70 @@ public:
   unsigned getMaxSockets() const { return mi.maxSockets; }
   unsigned getMaxNumaNodes() const { return mi.maxNumaNodes; }
 
+  //! returns the pool-wide id of the leader of socket pid
   unsigned getLeaderForSocket(unsigned pid) const {
     for (unsigned i = 0; i < getMaxThreads(); ++i)
-      if (getSocket(i) == pid && isLeader(i))
+      if (signals[i]->topo.socket == pid &&
+          signals[i]->topo.socketLeader == i)
         return i;
     abort();
   }
 
-  bool isLeader(unsigned tid) const {
-    return signals[tid]->topo.socketLeader == tid;
-  }
-  unsigned getSocket(unsigned tid) const { return signals[tid]->topo.socket; }
+  // Thread ids below are relative to the execution group of the caller. Outside
+  // of runGroups() they are the pool-wide ids.
+
+  bool isLeader(unsigned tid) const { return getLeader(tid) == tid; }
+  unsigned getSocket(unsigned tid) const { return topoOf(tid).socket; }
   unsigned getLeader(unsigned tid) const {
-    return signals[tid]->topo.socketLeader;
+    return toGroupLeader(topoOf(tid).socketLeader);
   }
   unsigned getCumulativeMaxSocket(unsigned tid) const {
-    return signals[tid]->topo.cumulativeMaxSocket;
-  }
-  unsigned getNumaNode(unsigned tid) const {
-    return signals[tid]->topo.numaNode;
+    return topoOf(tid).cumulativeMaxSocket;
   }
+  unsigned getNumaNode(unsigned tid) const { return topoOf(tid).numaNode; }
 
-  static unsigned getTID() { return my_box.topo.tid; }
-  static bool isLeader() { return my_box.topo.tid == my_box.topo.socketLeader; }
-  static unsigned getLeader() { return my_box.topo.socketLeader; }
+  static unsigned getTID() { return my_box.topo.tid - my_box.groupBase; }
+  static bool isLeader() { return getTID() == getLeader(); }
+  static unsigned getLeader() {
+    return toGroupLeader(my_box.topo.socketLeader);
+  }
   static unsigned getSocket() { return my_box.topo.socket; }
   static unsigned getCumulativeMaxSocket() {
     return my_box.topo.cumulativeMaxSocket;
   }
   static unsigned getNumaNode() { return my_box.topo.numaNode; }
+
+  //! id of the execution group of the caller; 0 outside of runGroups()
+  static unsigned getGroupID() { return my_box.group ? my_box.group->id : 0; }
+
+  //! pool-wide id of the calling thread
+  static unsigned getPoolTID() { return my_box.topo.tid; }
+
+  //! map a group-relative thread id to a pool-wide one; ids past the end of
+  //! the group wrap around the pool so that loops over all threads still visit
+  //! every thread exactly once
+  static unsigned getPoolTID(unsigned tid) {
+    unsigned t = tid + my_box.groupBase;
+    return t < my_box.poolSize ? t : t - my_box.poolSize;
+  }
+
+  //! map a pool-wide thread id to a group-relative one; threads outside of the
+  //! group of the caller map to the group leader
+  static unsigned getGroupTID(unsigned poolTID) {
+    unsigned t = poolTID - my_box.groupBase;
+    return t < my_box.group->size ? t : 0;
+  }
+
+private:
+  const ThreadTopoInfo& topoOf(unsigned tid) const {
+    return signals[getPoolTID(tid)]->topo;
+  }
+
+  //! the first thread of a socket may lie before the start of the group, in
+  //! which case the group leader stands in for it
+  static unsigned toGroupLeader(unsigned socketLeader) {
+    return std::max(socketLeader, my_box.groupBase) - my_box.groupBase;
+  }
 };
 
 /**
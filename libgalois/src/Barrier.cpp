@@ -18,6 +18,12 @@
  */
 
 #include "galois/substrate/Barrier.h"
+#include "galois/substrate/EnvCheck.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
 
 // anchor vtable
 galois::substrate::Barrier::~Barrier() {}
@@ -29,13 +35,126 @@ galois::substrate::Barrier::~Barrier() {}
 
 static galois::substrate::internal::BarrierInstance<>* BI = nullptr;
 
+// one barrier per execution group (see ThreadPool::runGroups)
+static std::vector<std::unique_ptr<galois::substrate::Barrier>> GROUP_BARRIERS;
+
 void galois::substrate::internal::setBarrierInstance(
     internal::BarrierInstance<>* bi) {
   GALOIS_ASSERT(!(bi && BI), "Double initialization of BarrierInstance");
   BI = bi;
 }
 
+void galois::substrate::internal::setGroupBarriers(unsigned numGroups,
+                                                   unsigned groupSize) {
+  GROUP_BARRIERS.clear();
+  // MCS barriers only depend on (group-relative) thread ids, not on how the
+  // group lines up with sockets
+  for (unsigned i = 0; i < numGroups; ++i) {
+    GROUP_BARRIERS.emplace_back(createMCSBarrier(groupSize));
+  }
+}
+
 galois::substrate::Barrier& galois::substrate::getBarrier(unsigned numT) {
+  if (unsigned group = ThreadPool::getGroupID()) {
+    GALOIS_ASSERT(group <= GROUP_BARRIERS.size(),
+                  "Execution group barrier not initialized");
+    return *GROUP_BARRIERS[group - 1];
+  }
   GALOIS_ASSERT(BI, "BarrierInstance not initialized");
   return BI->get(numT);
 }
+
+static const char* const BARRIER_NAMES[] = {
+    "topo", "mcs", "dissemination", "counting", "pthread", "simple"};
+
+std::unique_ptr<galois::substrate::Barrier>
+galois::substrate::createBarrier(BarrierKind kind, unsigned numT) {
+  switch (kind) {
+  case BarrierKind::Topo:
+    return createTopoBarrier(numT);
+  case BarrierKind::MCS:
+    return createMCSBarrier(numT);
+  case BarrierKind::Dissemination:
+    return createDisseminationBarrier(numT);
+  case BarrierKind::Counting:
+    return createCountingBarrier(numT);
+  case BarrierKind::Pthread:
+    return createPthreadBarrier(numT);
+  case BarrierKind::Simple:
+    return createSimpleBarrier(numT);
+  default:
+    GALOIS_DIE("unknown barrier kind");
+  }
+}
+
+bool galois::substrate::internal::getFixedBarrierKind(BarrierKind& kind) {
+  std::string name;
+  if (!EnvCheck("GALOIS_BARRIER", name) || name == "auto")
+    return false;
+  for (int i = 0; i < (int)BarrierKind::NumKinds; ++i) {
+    if (name == BARRIER_NAMES[i]) {
+      kind = static_cast<BarrierKind>(i);
+      return true;
+    }
+  }
+  GALOIS_DIE("unknown GALOIS_BARRIER ", name);
+}
+
+/**
+ * Average time of a wait on b with numT threads. Stops early once the time
+ * budget is spent, which matters when threads are oversubscribed.
+ */
+static double timeBarrier(galois::substrate::Barrier& b, unsigned numT) {
+  using Clock               = std::chrono::steady_clock;
+  constexpr unsigned WARMUP = 2;
+  constexpr unsigned ROUNDS = 1024;
+  constexpr std::chrono::microseconds BUDGET(2000);
+
+  std::atomic<unsigned> last(~0U);
+  Clock::time_point start, end;
+  unsigned rounds = 0;
+
+  galois::substrate::getThreadPool().run(numT, [&]() {
+    bool master = galois::substrate::ThreadPool::getTID() == 0;
+    for (unsigned r = 0;; ++r) {
+      // set before entering the barrier so every thread sees it on exit of
+      // the same round
+      if (master) {
+        if (r == WARMUP)
+          start = Clock::now();
+        if (r > WARMUP &&
+            (r == WARMUP + ROUNDS || Clock::now() - start >= BUDGET)) {
+          end    = Clock::now();
+          rounds = r - WARMUP;
+          last   = r;
+        }
+      }
+      b.wait();
+      if (last == r)
+        break;
+    }
+  });
+
+  return std::chrono::duration<double>(end - start).count() / rounds;
+}
+
+galois::substrate::BarrierKind
+galois::substrate::tuneBarrier(unsigned numT) {
+  BarrierKind best = BarrierKind::Topo;
+  double bestTime  = 0;
+  // the simple barrier is only meant for changing the number of threads
+  for (int i = 0; i < (int)BarrierKind::Simple; ++i) {
+    BarrierKind kind = static_cast<BarrierKind>(i);
+    auto b           = createBarrier(kind, numT);
+    if (!b)
+      continue;
+    double t = timeBarrier(*b, numT);
+    galois::gDebug("barrier ", BARRIER_NAMES[i], " with ", numT,
+                   " threads: ", t * 1e9, " ns");
+    if (i == 0 || t < bestTime) {
+      best     = kind;
+      bestTime = t;
+    }
+  }
+  return best;
+}
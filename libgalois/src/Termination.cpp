@@ -20,19 +20,40 @@
 #include "galois/gIO.h"
 #include "galois/substrate/Termination.h"
 
+#include <memory>
+#include <vector>
+
 // vtable anchoring
 galois::substrate::TerminationDetection::~TerminationDetection(void) {}
 
 static galois::substrate::TerminationDetection* TERM = nullptr;
 
+// one detector per execution group (see ThreadPool::runGroups)
+static std::vector<
+    std::unique_ptr<galois::substrate::internal::LocalTerminationDetection<>>>
+    GROUP_TERM;
+
 void galois::substrate::internal::setTermDetect(
     galois::substrate::TerminationDetection* t) {
   GALOIS_ASSERT(!(TERM && t), "Double initialization of TerminationDetection");
   TERM = t;
 }
 
+void galois::substrate::internal::setGroupTermDetect(unsigned numGroups) {
+  GROUP_TERM.clear();
+  for (unsigned i = 0; i < numGroups; ++i) {
+    GROUP_TERM.emplace_back(std::make_unique<LocalTerminationDetection<>>());
+  }
+}
+
 galois::substrate::TerminationDetection&
 galois::substrate::getSystemTermination(unsigned activeThreads) {
-  TERM->init(activeThreads);
-  return *TERM;
+  TerminationDetection* term = TERM;
+  if (unsigned group = ThreadPool::getGroupID()) {
+    GALOIS_ASSERT(group <= GROUP_TERM.size(),
+                  "Execution group termination detection not initialized");
+    term = GROUP_TERM[group - 1].get();
+  }
+  term->init(activeThreads);
+  return *term;
 }
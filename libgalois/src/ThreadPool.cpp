@@ -39,7 +39,7 @@ thread_local ThreadPool::per_signal ThreadPool::my_box;
 
 ThreadPool::ThreadPool()
     : mi(getHWTopo().machineTopoInfo), reserved(0), masterFastmode(false),
-      running(false) {
+      root{0, 0, mi.maxThreads, false, nullptr} {
   signals.resize(mi.maxThreads);
   initThread(0);
 
@@ -116,8 +116,10 @@ static T* getNth(std::atomic<T*>& headptr, unsigned off) {
 }
 
 void ThreadPool::initThread(unsigned tid) {
-  signals[tid] = &my_box;
-  my_box.topo  = getHWTopo().threadTopoInfo[tid];
+  signals[tid]    = &my_box;
+  my_box.topo     = getHWTopo().threadTopoInfo[tid];
+  my_box.group    = &root;
+  my_box.poolSize = mi.maxThreads;
   // Initialize
   substrate::initPTS(mi.maxThreads);
 
@@ -137,7 +139,7 @@ void ThreadPool::threadLoop(unsigned tid) {
     me.wait(fastmode);
     cascade(fastmode);
     try {
-      work();
+      me.group->work();
     } catch (const shutdown_ty&) {
       return;
     } catch (const fastmode_ty& fm) {
@@ -187,15 +189,19 @@ void ThreadPool::cascade(bool fastmode) {
 
   auto midpoint = me.wbegin + (1 + me.wend - me.wbegin) / 2;
 
-  auto child1    = signals[me.wbegin];
-  child1->wbegin = me.wbegin + 1;
-  child1->wend   = midpoint;
+  auto child1       = signals[me.wbegin];
+  child1->wbegin    = me.wbegin + 1;
+  child1->wend      = midpoint;
+  child1->group     = me.group;
+  child1->groupBase = me.groupBase;
   child1->wakeup(fastmode);
 
   if (midpoint < me.wend) {
-    auto child2    = signals[midpoint];
-    child2->wbegin = midpoint + 1;
-    child2->wend   = me.wend;
+    auto child2       = signals[midpoint];
+    child2->wbegin    = midpoint + 1;
+    child2->wend      = me.wend;
+    child2->group     = me.group;
+    child2->groupBase = me.groupBase;
     child2->wakeup(fastmode);
   }
 }
@@ -203,20 +209,24 @@ void ThreadPool::cascade(bool fastmode) {
 void ThreadPool::runInternal(unsigned num) {
   // sanitize num
   // seq write to starting should make work safe
-  GALOIS_ASSERT(!running, "Recursive thread pool execution not supported");
-  running = true;
-  num     = std::min(std::max(1U, num), getMaxUsableThreads());
-  // my_box is tid 0
-  auto& me  = my_box;
-  me.wbegin = 1;
-  me.wend   = num;
-
-  assert(!masterFastmode || masterFastmode == num);
+  // my_box is the first thread of its group (tid 0 for the whole pool)
+  auto& me     = my_box;
+  group_ty& gr = *me.group;
+  GALOIS_ASSERT(!gr.running, "Recursive thread pool execution not supported");
+  gr.running = true;
+  num        = std::min(std::max(1U, num),
+                        gr.id ? gr.size : getMaxUsableThreads());
+  me.wbegin  = gr.base + 1;
+  me.wend    = gr.base + num;
+
+  // fastmode only applies to the whole pool
+  bool fastmode = gr.id ? false : masterFastmode;
+  assert(!fastmode || masterFastmode == num);
   // launch threads
-  cascade(masterFastmode);
+  cascade(fastmode);
   // Do master thread work
   try {
-    work();
+    gr.work();
   } catch (const shutdown_ty&) {
     return;
   } catch (const fastmode_ty& fm) {
@@ -224,29 +234,94 @@ void ThreadPool::runInternal(unsigned num) {
   // wait for children
   decascade();
   // Clean up
-  work    = nullptr;
-  running = false;
+  gr.work    = nullptr;
+  gr.running = false;
 }
 
 void ThreadPool::runDedicated(std::function<void(void)>& f) {
   // TODO(ddn): update galois::runtime::activeThreads to reflect the dedicated
   // thread but we don't want to depend on galois::runtime symbols and too many
   // clients access galois::runtime::activeThreads directly.
-  GALOIS_ASSERT(!running,
+  GALOIS_ASSERT(!root.running,
                 "Can't start dedicated thread during parallel section");
   ++reserved;
 
   GALOIS_ASSERT(reserved < mi.maxThreads, "Too many dedicated threads");
-  work          = [&f]() { throw dedicated_ty{f}; };
-  auto child    = signals[mi.maxThreads - reserved];
-  child->wbegin = 0;
-  child->wend   = 0;
-  child->done   = 0;
+  root.work        = [&f]() { throw dedicated_ty{f}; };
+  auto child       = signals[mi.maxThreads - reserved];
+  child->wbegin    = 0;
+  child->wend      = 0;
+  child->group     = &root;
+  child->groupBase = 0;
+  child->done      = 0;
   child->wakeup(masterFastmode);
   while (!child->done) {
     asmPause();
   }
-  work = nullptr;
+  root.work = nullptr;
+}
+
+void ThreadPool::runGroups(unsigned numGroups, unsigned groupSize,
+                           const std::function<void(unsigned)>& fn) {
+  auto& me = my_box;
+  GALOIS_ASSERT(me.group == &root && !root.running,
+                "Execution groups must be started by the master thread outside "
+                "of a parallel section");
+  GALOIS_ASSERT(!masterFastmode, "Execution groups do not support fastmode");
+  GALOIS_ASSERT(numGroups && groupSize &&
+                    numGroups * groupSize <= getMaxUsableThreads(),
+                "Not enough threads for execution groups");
+
+  // groups[g] runs the parallel sections of fn(g); launchers[g] is the
+  // one-thread section that makes the first thread of groups[g] call fn(g)
+  std::vector<group_ty> groups;
+  std::vector<group_ty> launchers;
+  groups.reserve(numGroups);
+  launchers.reserve(numGroups);
+  for (unsigned g = 0; g < numGroups; ++g) {
+    groups.push_back(group_ty{g + 1, g * groupSize, groupSize, false, nullptr});
+    launchers.push_back(group_ty{g + 1, g * groupSize, 1, false, nullptr});
+  }
+
+  // done flags of leaders are also set by the parallel sections they start,
+  // so count the groups still running separately
+  std::atomic<unsigned> pending(numGroups - 1);
+
+  root.running = true;
+  for (unsigned g = 1; g < numGroups; ++g) {
+    group_ty* gr      = &groups[g];
+    launchers[g].work = [gr, g, &fn, &pending]() {
+      my_box.group = gr;
+      fn(g);
+      // nothing left to wait for once fn returns; done is set again once this
+      // thread is back in its main loop
+      my_box.wbegin = my_box.wend = 0;
+      my_box.done   = 0;
+      --pending;
+    };
+    auto leader       = signals[gr->base];
+    leader->wbegin    = 0;
+    leader->wend      = 0;
+    leader->group     = &launchers[g];
+    leader->groupBase = gr->base;
+    leader->wakeup(false);
+  }
+
+  // the master thread leads group 0
+  me.group = &groups[0];
+  fn(0);
+  me.group = &root;
+
+  while (pending) {
+    asmPause();
+  }
+  for (unsigned g = 1; g < numGroups; ++g) {
+    auto& done = signals[groups[g].base]->done;
+    while (!done) {
+      asmPause();
+    }
+  }
+  root.running = false;
 }
 
 static galois::substrate::ThreadPool* TPOOL = nullptr;
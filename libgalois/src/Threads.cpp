@@ -17,6 +17,8 @@
  * Documentation, or loss or inaccuracy of data of any kind.
  */
 
+#include "galois/substrate/Barrier.h"
+#include "galois/substrate/Termination.h"
 #include "galois/substrate/ThreadPool.h"
 #include "galois/Threads.h"
 
@@ -37,3 +39,24 @@ unsigned int galois::setActiveThreads(unsigned int num) noexcept {
 unsigned int galois::getActiveThreads() noexcept {
   return galois::runtime::activeThreads;
 }
+
+unsigned int
+galois::runInGroups(unsigned int numGroups,
+                    const std::function<void(unsigned int)>& fn) {
+  unsigned int numThreads = galois::runtime::activeThreads;
+  numGroups               = std::min(std::max(numGroups, 1U), numThreads);
+  unsigned int groupSize  = numThreads / numGroups;
+
+  substrate::internal::setGroupBarriers(numGroups, groupSize);
+  substrate::internal::setGroupTermDetect(numGroups);
+  // all groups have the same size so the loops in each group can keep
+  // reading the global number of active threads
+  galois::runtime::activeThreads = groupSize;
+
+  substrate::getThreadPool().runGroups(numGroups, groupSize, fn);
+
+  galois::runtime::activeThreads = numThreads;
+  substrate::internal::setGroupTermDetect(0);
+  substrate::internal::setGroupBarriers(0, 0);
+  return groupSize;
+}
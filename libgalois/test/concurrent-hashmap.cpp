@@ -0,0 +1,128 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/ConcurrentHashMap.h"
+#include "galois/Reduction.h"
+
+#include <string>
+#include <vector>
+
+typedef galois::ConcurrentHashMap<long, long> Map;
+
+// Every key in [0, numKeys) is updated `repeat` times from different threads
+void testCounts(long numKeys, long repeat) {
+  Map m;
+  m.reserve(numKeys);
+  size_t capacity = m.capacity();
+  galois::GAccumulator<long> inserted;
+  galois::do_all(
+      galois::iterate(0L, numKeys * repeat),
+      [&](long i) {
+        if (m.insert_or_update(i % numKeys, [](long& v) { v += 1; }))
+          inserted += 1;
+      },
+      galois::steal());
+  GALOIS_ASSERT(m.capacity() == capacity);
+  GALOIS_ASSERT(inserted.reduce() == numKeys);
+  GALOIS_ASSERT(m.size() == (size_t)numKeys);
+
+  galois::GAccumulator<long> sum;
+  galois::GAccumulator<long> visited;
+  galois::do_all(galois::iterate(m), [&](const Map::value_type& kv) {
+    GALOIS_ASSERT(kv.second == repeat);
+    sum += kv.first;
+    visited += 1;
+  });
+  GALOIS_ASSERT(visited.reduce() == numKeys);
+  GALOIS_ASSERT(sum.reduce() == numKeys * (numKeys - 1) / 2);
+
+  galois::do_all(galois::iterate(0L, 2 * numKeys), [&](long k) {
+    GALOIS_ASSERT(m.count(k) == (k < numKeys ? 1u : 0u));
+  });
+}
+
+// Serial inserts grow the table without losing entries
+void testGrowth() {
+  galois::ConcurrentHashMap<std::string, int> m;
+  size_t capacity = m.capacity();
+  for (int i = 0; i < 100000; ++i)
+    GALOIS_ASSERT(m.insert(std::make_pair(std::to_string(i), i)).second);
+  GALOIS_ASSERT(m.capacity() > capacity);
+  GALOIS_ASSERT(!m.insert(std::make_pair(std::string("7"), 0)).second);
+  for (int i = 0; i < 100000; ++i) {
+    auto ii = m.find(std::to_string(i));
+    GALOIS_ASSERT(ii != m.end() && ii->second == i);
+  }
+  GALOIS_ASSERT(m.find("x") == m.end());
+  GALOIS_ASSERT(std::distance(m.begin(), m.end()) == 100000);
+
+  m.clear();
+  GALOIS_ASSERT(m.empty() && m.begin() == m.end());
+  m.insert_or_update("a", [](int& v) { v = 1; });
+  GALOIS_ASSERT(m.find("a")->second == 1);
+}
+
+// Parallel inserts without reserve() spill into overflow tables
+void testParallelGrowth(long numKeys) {
+  Map m;
+  galois::GAccumulator<long> inserted;
+  galois::do_all(
+      galois::iterate(0L, 2 * numKeys),
+      [&](long i) {
+        if (m.insert_or_update(i % numKeys, [](long& v) { v += 1; }))
+          inserted += 1;
+        auto r = m.insert(std::make_pair(numKeys + i, i));
+        GALOIS_ASSERT(r.first->first == numKeys + i);
+      },
+      galois::steal());
+  GALOIS_ASSERT(inserted.reduce() == numKeys);
+  GALOIS_ASSERT(m.size() == (size_t)(3 * numKeys));
+
+  galois::GAccumulator<long> visited;
+  galois::do_all(galois::iterate(m), [&](const Map::value_type& kv) {
+    GALOIS_ASSERT(kv.second == (kv.first < numKeys ? 2 : kv.first - numKeys));
+    visited += 1;
+  });
+  GALOIS_ASSERT(visited.reduce() == 3 * numKeys);
+  GALOIS_ASSERT(std::distance(m.begin(), m.end()) == 3 * numKeys);
+  galois::do_all(galois::iterate(0L, 4 * numKeys), [&](long k) {
+    GALOIS_ASSERT(m.count(k) == (k < 3 * numKeys ? 1u : 0u));
+  });
+
+  // a serial insertion merges the overflow tables back into the main table
+  size_t capacity = m.capacity();
+  GALOIS_ASSERT(m.insert(std::make_pair(-1L, 0L)).second);
+  GALOIS_ASSERT(m.capacity() > capacity);
+  GALOIS_ASSERT(m.size() == (size_t)(3 * numKeys + 1));
+  for (long k = -1; k < 3 * numKeys; ++k)
+    GALOIS_ASSERT(m.find(k) != m.end());
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(galois::substrate::getThreadPool().getMaxThreads());
+
+  testCounts(1000, 64);
+  testCounts(1 << 18, 4);
+  testGrowth();
+  testParallelGrowth(1 << 16);
+
+  return 0;
+}
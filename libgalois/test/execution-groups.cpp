@@ -0,0 +1,90 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+
+#include <vector>
+
+// Each group runs its own do_all, on_each and for_each; results must match a
+// run that uses the whole pool.
+void runQueries(unsigned numGroups) {
+  constexpr int num = 10000;
+  std::vector<long> sums(numGroups, 0);
+  std::vector<long> pushes(numGroups, 0);
+  std::vector<unsigned> threads(numGroups, 0);
+
+  unsigned groupSize = galois::runInGroups(numGroups, [&](unsigned group) {
+    galois::GAccumulator<long> sum;
+    galois::do_all(galois::iterate(0, num), [&](int i) { sum += i; },
+                   galois::steal());
+    sums[group] = sum.reduce();
+
+    galois::GAccumulator<unsigned> numThreads;
+    galois::on_each([&](unsigned tid, unsigned total) {
+      GALOIS_ASSERT(tid < total);
+      numThreads += 1;
+    });
+    threads[group] = numThreads.reduce();
+
+    galois::InsertBag<int> bag;
+    galois::GAccumulator<long> pushed;
+    galois::for_each(
+        galois::iterate({num}),
+        [&](int i, auto& ctx) {
+          pushed += 1;
+          bag.push(i);
+          if (i > 1) {
+            ctx.push(i / 2);
+            ctx.push(i - i / 2);
+          }
+        },
+        galois::disable_conflict_detection());
+    pushes[group] = pushed.reduce();
+    GALOIS_ASSERT(std::distance(bag.begin(), bag.end()) == pushes[group]);
+  });
+
+  GALOIS_ASSERT(galois::getActiveThreads() >= groupSize * numGroups);
+  for (unsigned g = 0; g < numGroups; ++g) {
+    GALOIS_ASSERT(sums[g] == (long)num * (num - 1) / 2);
+    GALOIS_ASSERT(threads[g] == groupSize);
+    GALOIS_ASSERT(pushes[g] == 2 * num - 1);
+  }
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  auto& tp            = galois::substrate::getThreadPool();
+  unsigned numThreads = galois::setActiveThreads(tp.getMaxThreads());
+
+  runQueries(1);
+  runQueries(numThreads);
+  runQueries(tp.getMaxSockets());
+  if (numThreads >= 4) {
+    runQueries(2);
+  }
+
+  // the whole pool is usable again afterwards
+  galois::GAccumulator<unsigned> numUsed;
+  galois::on_each([&](unsigned, unsigned) { numUsed += 1; });
+  GALOIS_ASSERT(numUsed.reduce() == numThreads);
+
+  return 0;
+}
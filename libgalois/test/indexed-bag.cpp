@@ -0,0 +1,99 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/Reduction.h"
+
+#include <algorithm>
+#include <vector>
+
+// Large enough that every thread fills more than one page-sized block
+constexpr long num = 1 << 21;
+
+void fill(galois::IndexedInsertBag<long>& bag) {
+  galois::do_all(galois::iterate(0L, num), [&](long i) { bag.push(i); });
+  GALOIS_ASSERT(bag.size() == (size_t)num);
+  GALOIS_ASSERT(std::distance(bag.begin(), bag.end()) == num);
+}
+
+void checkContents(galois::IndexedInsertBag<long>& bag) {
+  galois::GAccumulator<long> sum;
+  galois::GAccumulator<long> count;
+  galois::do_all(
+      galois::iterate(bag),
+      [&](long v) {
+        sum += v;
+        count += 1;
+      },
+      galois::steal(), galois::chunk_size<64>());
+  GALOIS_ASSERT(count.reduce() == num);
+  GALOIS_ASSERT(sum.reduce() == num * (num - 1) / 2);
+
+  std::vector<long> seen(bag.begin(), bag.end());
+  std::sort(seen.begin(), seen.end());
+  for (long i = 0; i < num; ++i)
+    GALOIS_ASSERT(seen[i] == i);
+}
+
+void checkRandomAccess(galois::IndexedInsertBag<long>& bag) {
+  auto first = bag.begin();
+  auto last  = bag.end();
+  long i = 0;
+  for (auto ii = first; ii != last; ++ii, ++i) {
+    if (i % 4099 == 0) {
+      GALOIS_ASSERT(*(first + i) == *ii);
+      GALOIS_ASSERT(last - ii == num - i);
+      GALOIS_ASSERT((last - (num - i)) == ii);
+    }
+  }
+  GALOIS_ASSERT(*(last - 1) == *std::prev(last));
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(galois::substrate::getThreadPool().getMaxThreads());
+
+  galois::IndexedInsertBag<long> bag;
+  GALOIS_ASSERT(bag.empty() && bag.begin() == bag.end());
+
+  fill(bag);
+  checkContents(bag);
+  checkRandomAccess(bag);
+
+  // refilling after clear reuses the cached blocks
+  bag.clear();
+  GALOIS_ASSERT(bag.empty() && bag.size() == 0);
+  fill(bag);
+  checkContents(bag);
+
+  galois::on_each([&](unsigned, unsigned) {
+    size_t n = bag.local_size();
+    GALOIS_ASSERT(std::distance(bag.local_begin(), bag.local_end()) == (long)n);
+    for (; n; --n)
+      bag.pop();
+  });
+  GALOIS_ASSERT(bag.empty());
+
+  bag.release();
+  fill(bag);
+  checkContents(bag);
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/Reduction.h"
+#include "galois/substrate/Barrier.h"
+
+#include <algorithm>
+
+constexpr unsigned rounds = 16;
+
+// Each thread adds its id plus the round number; every thread must see the
+// same total in every round.
+void testReduceAtBarrier(unsigned numThreads) {
+  numThreads = galois::setActiveThreads(numThreads);
+  galois::substrate::ReductionBarrier<long> barrier(numThreads);
+  galois::GAccumulator<long> acc;
+  galois::GAccumulator<long> mismatches;
+
+  galois::on_each([&](unsigned tid, unsigned total) {
+    GALOIS_ASSERT(total == numThreads);
+    for (unsigned r = 0; r < rounds; ++r) {
+      acc += tid + r;
+      long expect = (long)total * (total - 1) / 2 + (long)total * r;
+      if (acc.reduceAtBarrier(barrier) != expect)
+        mismatches += 1;
+    }
+  });
+  GALOIS_ASSERT(mismatches.reduce() == 0);
+  GALOIS_ASSERT(acc.reduce() == 0);
+
+  galois::GReduceMax<unsigned> maxTid;
+  galois::substrate::ReductionBarrier<unsigned> maxBarrier(numThreads);
+  galois::on_each([&](unsigned tid, unsigned total) {
+    maxTid.update(tid);
+    GALOIS_ASSERT(maxTid.reduceAtBarrier(maxBarrier) == total - 1);
+  });
+}
+
+// The tuned barrier must work for the loops that use it
+void testTunedBarrier(unsigned numThreads) {
+  numThreads = galois::setActiveThreads(numThreads);
+  auto kind = galois::substrate::tuneBarrier(numThreads);
+  GALOIS_ASSERT(kind < galois::substrate::BarrierKind::Simple);
+
+  auto& barrier = galois::runtime::getBarrier(numThreads);
+  galois::GAccumulator<unsigned> passed;
+  galois::on_each([&](unsigned, unsigned) {
+    for (unsigned r = 0; r < rounds; ++r)
+      barrier.wait();
+    passed += 1;
+  });
+  GALOIS_ASSERT(passed.reduce() == numThreads);
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  unsigned maxThreads = galois::substrate::getThreadPool().getMaxThreads();
+
+  for (unsigned n : {1u, 2u, std::max(maxThreads / 2, 1u), maxThreads}) {
+    testReduceAtBarrier(n);
+    testTunedBarrier(n);
+  }
+
+  return 0;
+}
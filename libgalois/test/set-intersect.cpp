@@ -0,0 +1,140 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/SetIntersect.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+using Set = std::vector<uint32_t>;
+
+Set randomSet(std::mt19937& gen, size_t size, uint32_t universe) {
+  std::uniform_int_distribution<uint32_t> dist(0, universe - 1);
+  Set s;
+  for (size_t i = 0; i < size; ++i)
+    s.push_back(dist(gen));
+  std::sort(s.begin(), s.end());
+  s.erase(std::unique(s.begin(), s.end()), s.end());
+  return s;
+}
+
+Set expected(const Set& a, const Set& b) {
+  Set r;
+  std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                        std::back_inserter(r));
+  return r;
+}
+
+template <typename CountFn, typename MaterializeFn>
+void check(const Set& a, const Set& b, CountFn count, MaterializeFn mat) {
+  Set want = expected(a, b);
+  Set out(std::min(a.size(), b.size()));
+  size_t c = count(a.data(), a.size(), b.data(), b.size());
+  GALOIS_ASSERT(c == want.size());
+  size_t n = mat(a.data(), a.size(), b.data(), b.size(), out.data());
+  out.resize(n);
+  GALOIS_ASSERT(out == want);
+}
+
+template <typename CountFn, typename MaterializeFn>
+void testKernel(CountFn count, MaterializeFn mat) {
+  std::mt19937 gen(0);
+  check(Set{}, Set{1, 2, 3}, count, mat);
+  check(Set{1, 2, 3}, Set{1, 2, 3}, count, mat);
+  for (size_t na : {1, 7, 8, 15, 16, 17, 100, 1000}) {
+    for (size_t nb : {1, 8, 16, 33, 100, 1000, 5000}) {
+      for (uint32_t universe : {64u, 2000u, 100000u}) {
+        Set a = randomSet(gen, na, universe);
+        Set b = randomSet(gen, nb, universe);
+        check(a, b, count, mat);
+        check(b, a, count, mat);
+      }
+    }
+  }
+}
+
+void testForEachCommon() {
+  std::mt19937 gen(2);
+  for (size_t nb : {10, 100, 10000}) {
+    Set x = randomSet(gen, 100, 20000);
+    Set y = randomSet(gen, nb, 20000);
+    for (int swap = 0; swap < 2; ++swap) {
+      Set got;
+      galois::setintersect::forEachCommon(
+          x.data(), x.size(), y.data(), y.size(), [&](size_t i, size_t j) {
+            GALOIS_ASSERT(x[i] == y[j]);
+            got.push_back(x[i]);
+            return true;
+          });
+      GALOIS_ASSERT(got == expected(x, y));
+
+      size_t calls = 0;
+      galois::setintersect::forEachCommon(
+          x.data(), x.size(), y.data(), y.size(),
+          [&](size_t, size_t) { return ++calls < 2; });
+      GALOIS_ASSERT(calls == std::min<size_t>(2, got.size()));
+      std::swap(x, y);
+    }
+  }
+}
+
+void testBitmap() {
+  std::mt19937 gen(1);
+  galois::setintersect::Bitmap bitmap(100000);
+  for (int round = 0; round < 10; ++round) {
+    Set hub = randomSet(gen, 5000, 100000);
+    bitmap.mark(hub.data(), hub.size());
+    for (int i = 0; i < 10; ++i) {
+      Set other = randomSet(gen, 300, 100000);
+      Set want  = expected(hub, other);
+      Set out(other.size());
+      size_t c = bitmap.count(other.data(), other.size());
+      GALOIS_ASSERT(c == want.size());
+      out.resize(bitmap.intersect(other.data(), other.size(), out.data()));
+      GALOIS_ASSERT(out == want);
+    }
+    bitmap.unmark(hub.data(), hub.size());
+    for (uint32_t x : hub)
+      GALOIS_ASSERT(!bitmap.test(x));
+  }
+}
+
+int main() {
+  namespace si = galois::setintersect;
+
+  testKernel(si::mergeCount<uint32_t>, si::merge<uint32_t>);
+  testKernel(si::gallopCount<uint32_t>, si::gallop<uint32_t>);
+  testKernel(galois::intersectCount<uint32_t>, galois::intersect<uint32_t>);
+#ifdef GALOIS_SETINTERSECT_X86
+  if (si::isSupported(si::Kernel::AVX2))
+    testKernel(si::mergeCountAVX2, si::mergeAVX2);
+  if (si::isSupported(si::Kernel::AVX512)) {
+    testKernel(si::mergeCountAVX512, si::mergeAVX512);
+    si::setKernel(si::Kernel::AVX512);
+    testKernel(galois::intersectCount<uint32_t>, galois::intersect<uint32_t>);
+  }
+#endif
+  testForEachCommon();
+  testBitmap();
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/VectorReduction.h"
+
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+constexpr size_t numBins = 1000;
+constexpr long num       = 100000;
+
+void testVector() {
+  galois::GVectorAccumulator<long> acc(numBins);
+  auto fill = [&] {
+    galois::do_all(galois::iterate(0L, num),
+                   [&](long i) { acc.update(i % numBins, 1); });
+  };
+
+  fill();
+  const std::vector<long>& v = acc.reduce();
+  GALOIS_ASSERT(v.size() == numBins);
+  for (size_t i = 0; i < numBins; ++i)
+    GALOIS_ASSERT(v[i] == num / (long)numBins);
+
+  // reduced values persist and further updates add to them
+  fill();
+  for (size_t i = 0; i < numBins; ++i)
+    GALOIS_ASSERT(acc.reduce()[i] == 2 * num / (long)numBins);
+
+  acc.reset();
+  for (size_t i = 0; i < numBins; ++i)
+    GALOIS_ASSERT(acc.reduce()[i] == 0);
+
+  acc.resize(2 * numBins);
+  galois::on_each(
+      [&](unsigned tid, unsigned) { acc.update(numBins + 1, tid); });
+  unsigned n = galois::getActiveThreads();
+  GALOIS_ASSERT(acc.reduce()[numBins + 1] == (long)n * (n - 1) / 2);
+}
+
+void testVectorMax() {
+  galois::GVectorReduceMax<long> acc(numBins);
+  galois::do_all(galois::iterate(0L, num),
+                 [&](long i) { acc.update(i % numBins, i); });
+  const std::vector<long>& v = acc.reduce();
+  for (size_t i = 0; i < numBins; ++i)
+    GALOIS_ASSERT(v[i] == num - (long)numBins + (long)i);
+
+  acc.reset();
+  GALOIS_ASSERT(acc.reduce()[0] == std::numeric_limits<long>::min());
+  acc.update(0, -3);
+  GALOIS_ASSERT(acc.reduce()[0] == -3);
+}
+
+void testHistogram() {
+  galois::GHistogram<long> hist;
+  auto fill = [&] {
+    galois::do_all(galois::iterate(0L, num),
+                   [&](long i) { hist.update(i % numBins); });
+  };
+
+  fill();
+  const std::map<long, uint64_t>& h = hist.reduce();
+  GALOIS_ASSERT(h.size() == numBins);
+  for (auto& kv : h)
+    GALOIS_ASSERT(kv.second == num / numBins);
+
+  fill();
+  hist.update(-1, 5);
+  GALOIS_ASSERT(hist.reduce().size() == numBins + 1);
+  GALOIS_ASSERT(hist.reduce().at(-1) == 5);
+  GALOIS_ASSERT(hist.reduce().at(7) == 2 * num / numBins);
+
+  hist.reset();
+  GALOIS_ASSERT(hist.reduce().empty());
+}
+
+void testTopK() {
+  galois::GTopK<long> top(10);
+  galois::do_all(galois::iterate(0L, num),
+                 [&](long i) { top.update((i * 7919) % num); });
+  const std::vector<long>& v = top.reduce();
+  GALOIS_ASSERT(v.size() == 10);
+  for (size_t i = 0; i < v.size(); ++i)
+    GALOIS_ASSERT(v[i] == num - 1 - (long)i);
+
+  // later updates merge into the reduced values
+  top.update(num + 5);
+  GALOIS_ASSERT(top.reduce().front() == num + 5);
+  GALOIS_ASSERT(top.reduce().back() == num - 9);
+
+  std::vector<long> other{num + 7, 3};
+  std::vector<long> merged = top.reduce();
+  top.mergeSorted(merged, other);
+  GALOIS_ASSERT(merged.size() == 10 && merged[0] == num + 7);
+
+  top.reset();
+  GALOIS_ASSERT(top.reduce().empty());
+}
+
+void testQuantiles() {
+  galois::GQuantiles<long> quant(128);
+  galois::do_all(galois::iterate(0L, num), [&](long i) { quant.update(i); });
+  galois::QuantileSketch<long>& s = quant.reduce();
+  GALOIS_ASSERT(s.count() == (uint64_t)num);
+  // rank error of about log2(n / k) / k, well within 5%
+  for (double q : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+    long got = s.quantile(q);
+    GALOIS_ASSERT(std::abs(got - (long)(q * num)) < num / 20, q, " ", got);
+  }
+
+  // merged sketches count all values
+  galois::QuantileSketch<long> other(128);
+  for (long i = 0; i < num; ++i)
+    other.insert(num + i);
+  s.merge(other);
+  GALOIS_ASSERT(s.count() == 2 * (uint64_t)num);
+  GALOIS_ASSERT(std::abs(s.quantile(0.5) - num) < num / 10);
+
+  quant.reset();
+  GALOIS_ASSERT(quant.reduce().empty());
+}
+
+int main() {
+  galois::SharedMemSys sys;
+  galois::setActiveThreads(galois::substrate::getThreadPool().getMaxThreads());
+
+  testVector();
+  testVectorMax();
+  testHistogram();
+  testTopK();
+  testQuantiles();
+
+  return 0;
+}
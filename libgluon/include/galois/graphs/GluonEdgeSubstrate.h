@@ -35,6 +35,7 @@
 #include "galois/runtime/DistStats.h"
 #include "galois/runtime/SyncStructures.h"
 #include "galois/runtime/DataCommMode.h"
+#include "galois/runtime/DataCompression.h"
 #include "galois/DynamicBitset.h"
 
 #ifdef GALOIS_ENABLE_GPU
@@ -99,6 +100,14 @@ private:
   // Used for efficient comms
   galois::DynamicBitSet syncBitset;
   galois::PODResizeableArray<unsigned int> syncOffsets;
+  //! Scratch space for compressedOffsetsData encodings
+  galois::PODResizeableArray<uint8_t> syncCompressed;
+  //! True if every host can decode compressedOffsetsData; GPU hosts cannot
+#ifdef GALOIS_ENABLE_GPU
+  bool compressedOffsetsAllowed = false;
+#else
+  bool compressedOffsetsAllowed = true;
+#endif
 
   void reset_bitset(void (*bitset_reset_range)(size_t, size_t)) {
     if (userGraph.sizeEdges() > 0) {
@@ -387,6 +396,17 @@ public:
     }
   }
 
+  /**
+   * Allows or forbids sending compressedOffsetsData. GPU hosts cannot decode
+   * it, so it is off by default in GPU builds; enable it only if every host
+   * runs on a CPU. Every host must use the same value.
+   *
+   * @param allowed true if no host is a GPU host
+   */
+  void set_compressed_offsets(bool allowed) {
+    compressedOffsetsAllowed = allowed;
+  }
+
   ////////////////////////////////////////////////////////////////////////////////
   // Data extraction from bitsets
   ////////////////////////////////////////////////////////////////////////////////
@@ -546,8 +566,8 @@ private:
                                      bit_set_count);
     }
 
-    data_mode =
-        get_data_mode<typename FnTy::ValTy>(bit_set_count, indices.size());
+    data_mode = get_data_mode<typename FnTy::ValTy>(
+        bit_set_count, indices.size(), compressedOffsetsAllowed);
   }
 
   ////////////////////////////////////////////////////////////////////////////////
@@ -674,6 +694,9 @@ private:
                                     get_run_identifier(loopName));
     galois::CondStatTimer<GALOIS_COMM_STATS> Tserialize(
         serialize_timer_str.c_str(), RNAME);
+    std::string mode_str(syncTypeStr + "Mode" + dataCommModeName(data_mode) +
+                         "_" + get_run_identifier(loopName));
+    galois::runtime::reportStatCond_Tsum<GALOIS_COMM_STATS>(RNAME, mode_str, 1);
     if (data_mode == noData) {
       if (!async) {
         Tserialize.start();
@@ -693,6 +716,26 @@ private:
       Tserialize.start();
       gSerialize(b, data_mode, bit_set_count, offsets, val_vec);
       Tserialize.stop();
+    } else if (data_mode == compressedOffsetsData) {
+      val_vec.resize(bit_set_count);
+      Tserialize.start();
+      galois::runtime::encodeOffsets(offsets, bit_set_count, syncCompressed);
+      gSerialize(b, data_mode, bit_set_count, syncCompressed);
+      size_t offsetBytes = syncCompressed.size();
+      // values go out XOR-delta encoded only if that is actually smaller
+      uint8_t valuesCompressed = galois::runtime::encodeXorValues(
+          val_vec, bit_set_count, syncCompressed);
+      if (valuesCompressed) {
+        gSerialize(b, valuesCompressed, syncCompressed);
+      } else {
+        gSerialize(b, valuesCompressed, val_vec);
+      }
+      Tserialize.stop();
+      reportCompressedSize<typename VecType::value_type>(
+          loopName, syncTypeStr, bit_set_count, offsetBytes,
+          valuesCompressed ? syncCompressed.size()
+                           : bit_set_count *
+                                 sizeof(typename VecType::value_type));
     } else if (data_mode == bitsetData) {
       val_vec.resize(bit_set_count);
       Tserialize.start();
@@ -743,6 +786,7 @@ private:
         serialize_timer_str.c_str(), RNAME);
     Tdeserialize.start();
 
+    bool valuesDecoded = false;
     // get other metadata associated with message if mode isn't OnlyData
     if (data_mode != onlyData) {
       galois::runtime::gDeserialize(buf, bit_set_count);
@@ -752,6 +796,18 @@ private:
         convertGIDToLID<syncType>(loopName, offsets);
       } else if (data_mode == offsetsData) {
         galois::runtime::gDeserialize(buf, offsets);
+      } else if (data_mode == compressedOffsetsData) {
+        galois::runtime::gDeserialize(buf, syncCompressed);
+        galois::runtime::decodeOffsets(syncCompressed, bit_set_count, offsets);
+
+        uint8_t valuesCompressed;
+        galois::runtime::gDeserialize(buf, valuesCompressed);
+        if (valuesCompressed) {
+          galois::runtime::gDeserialize(buf, syncCompressed);
+          galois::runtime::decodeXorValues(syncCompressed, bit_set_count,
+                                           val_vec);
+          valuesDecoded = true;
+        }
       } else if (data_mode == bitsetData) {
         bit_set_comm.resize(num);
         galois::runtime::gDeserialize(buf, bit_set_comm);
@@ -763,7 +819,9 @@ private:
     }
 
     // get data itself
-    galois::runtime::gDeserialize(buf, val_vec);
+    if (!valuesDecoded) {
+      galois::runtime::gDeserialize(buf, val_vec);
+    }
 
     Tdeserialize.stop();
   }
@@ -831,6 +889,34 @@ private:
     }
   }
 
+  /**
+   * Reports the bytes saved by compressedOffsetsData over plain offsetsData.
+   *
+   * @tparam ValTy type of the values being sent
+   *
+   * @param loopName loop name used for the statistic
+   * @param syncTypeStr "Reduce" or "Broadcast"
+   * @param bitSetCount number of elements sent
+   * @param offsetBytes bytes used by the encoded offsets
+   * @param valueBytes bytes used by the (possibly encoded) values
+   */
+  template <typename ValTy>
+  void reportCompressedSize(std::string loopName, std::string syncTypeStr,
+                            size_t bitSetCount, size_t offsetBytes,
+                            size_t valueBytes) {
+    size_t plain_size =
+        bitSetCount * (sizeof(unsigned int) + sizeof(ValTy)) + sizeof(size_t);
+    size_t compressed_size = offsetBytes + valueBytes + sizeof(uint8_t);
+
+    if (plain_size > compressed_size) {
+      std::string statSavedBytes_str(syncTypeStr + "CompressedSavedBytes_" +
+                                     get_run_identifier(loopName));
+
+      galois::runtime::reportStatCond_Tsum<GALOIS_COMM_STATS>(
+          RNAME, statSavedBytes_str, (plain_size - compressed_size));
+    }
+  }
+
   ////////////////////////////////////////////////////////////////////////////////
   // Extract data from edges (for reduce and broadcast)
   ////////////////////////////////////////////////////////////////////////////////
@@ -1506,7 +1592,8 @@ private:
         b.reserve(sizeof(DataCommMode) + sizeof(bit_set_count) +
                   sizeof(size_t) + (num * sizeof(unsigned int)) +
                   sizeof(size_t) + (num * sizeof(typename SyncFnTy::ValTy)));
-      } else if (substrateDataMode == offsetsData) {
+      } else if (substrateDataMode == offsetsData ||
+                 substrateDataMode == compressedOffsetsData) {
         b.reserve(sizeof(DataCommMode) + sizeof(bit_set_count) +
                   sizeof(size_t) + (num * sizeof(unsigned int)) +
                   sizeof(size_t) + (num * sizeof(typename SyncFnTy::ValTy)));
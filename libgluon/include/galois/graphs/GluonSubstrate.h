@@ -28,12 +28,17 @@
 
 #include <unordered_map>
 #include <fstream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 
 #include "galois/runtime/GlobalObj.h"
 #include "galois/runtime/DistStats.h"
 #include "galois/runtime/SyncStructures.h"
 #include "galois/runtime/DataCommMode.h"
+#include "galois/runtime/DataCompression.h"
 #include "galois/DynamicBitset.h"
+#include "galois/DReducible.h"
 
 #ifdef GALOIS_ENABLE_GPU
 #include "galois/cuda/HostDecls.h"
@@ -129,6 +134,43 @@ private:
   // Used for efficient comms
   galois::DynamicBitSet syncBitset;
   galois::PODResizeableArray<unsigned int> syncOffsets;
+  //! Scratch space for compressedOffsetsData encodings
+  galois::PODResizeableArray<uint8_t> syncCompressed;
+  //! True if every host can decode compressedOffsetsData; GPU hosts cannot
+#ifdef GALOIS_ENABLE_GPU
+  bool compressedOffsetsAllowed = false;
+#else
+  bool compressedOffsetsAllowed = true;
+#endif
+
+  //! Number of shared nodes per message in pipelined sync; 0 disables it
+  size_t syncChunkSize;
+  //! True between syncStart and syncWait
+  bool syncInFlight;
+
+  //! Directory checkpoints are kept in; empty disables checkpointing
+  std::string checkpointDir;
+  //! Expected seconds between failures; sets the checkpoint interval
+  double checkpointMTBF;
+  //! True until a requested restart has been applied
+  bool checkpointRestart;
+  //! Rounds between checkpoints; 0 until the first checkpoint call
+  uint32_t checkpointInterval;
+  //! Rounds completed since the last checkpoint
+  uint32_t checkpointRoundsSince;
+  //! When the last checkpoint (or the first checkpoint call) finished
+  std::chrono::steady_clock::time_point checkpointLastTime;
+  //! Keys of the newest and the previous checkpoint on disk (0 if none)
+  uint64_t checkpointKeys[2];
+
+  //! Contiguous slice of a shared node list; one chunk of a pipelined sync
+  struct IndexSlice {
+    const size_t* first;
+    size_t count;
+
+    size_t size() const { return count; }
+    size_t operator[](size_t i) const { return first[i]; }
+  };
 
   /**
    * Reset a provided bitset given the type of synchronization performed
@@ -430,7 +472,10 @@ public:
         cartesianGrid(_cartesianGrid), partitionAgnostic(_partitionAgnostic),
         substrateDataMode(_enforcedDataMode), numHosts(numHosts), num_run(0),
         num_round(0), currentBVFlag(nullptr),
-        mirrorNodes(userGraph.getMirrorNodes()) {
+        mirrorNodes(userGraph.getMirrorNodes()), syncChunkSize(0),
+        syncInFlight(false), checkpointMTBF(0), checkpointRestart(false),
+        checkpointInterval(0), checkpointRoundsSince(0),
+        checkpointKeys{0, 0} {
     if (cartesianGrid.first != 0 && cartesianGrid.second != 0) {
       GALOIS_ASSERT(cartesianGrid.first * cartesianGrid.second == numHosts,
                     "Cartesian split doesn't equal number of hosts");
@@ -581,9 +626,9 @@ private:
    * @param data_mode OUTPUT: the way that this data should be communicated
    * based on how much data needs to be sent out
    */
-  template <typename FnTy, SyncType syncType>
+  template <typename FnTy, SyncType syncType, typename IndicesTy>
   void getBitsetAndOffsets(const std::string& loopName,
-                           const std::vector<size_t>& indices,
+                           const IndicesTy& indices,
                            const galois::DynamicBitSet& bitset_compute,
                            galois::DynamicBitSet& bitset_comm,
                            galois::PODResizeableArray<unsigned int>& offsets,
@@ -617,8 +662,8 @@ private:
                                      bit_set_count);
     }
 
-    data_mode =
-        get_data_mode<typename FnTy::ValTy>(bit_set_count, indices.size());
+    data_mode = get_data_mode<typename FnTy::ValTy>(
+        bit_set_count, indices.size(), compressedOffsetsAllowed);
   }
 
   template <typename SyncFnTy>
@@ -627,7 +672,8 @@ private:
       return sizeof(DataCommMode) + sizeof(size_t) + sizeof(size_t) +
              (numShared * sizeof(unsigned int)) + sizeof(size_t) +
              (numShared * sizeof(typename SyncFnTy::ValTy));
-    } else if (substrateDataMode == offsetsData) {
+    } else if (substrateDataMode == offsetsData ||
+               substrateDataMode == compressedOffsetsData) {
       return sizeof(DataCommMode) + sizeof(size_t) + sizeof(size_t) +
              (numShared * sizeof(unsigned int)) + sizeof(size_t) +
              (numShared * sizeof(typename SyncFnTy::ValTy));
@@ -662,9 +708,8 @@ private:
    * use; after function completion, holds global ids of nodes we are interested
    * in
    */
-  template <SyncType syncType>
-  void convertLIDToGID(const std::string& loopName,
-                       const std::vector<size_t>& indices,
+  template <SyncType syncType, typename IndicesTy>
+  void convertLIDToGID(const std::string& loopName, const IndicesTy& indices,
                        galois::PODResizeableArray<unsigned int>& offsets) {
     std::string syncTypeStr = (syncType == syncReduce) ? "Reduce" : "Broadcast";
     std::string doall_str(syncTypeStr + "_LID2GID_" +
@@ -763,6 +808,8 @@ private:
   /**
    * Given data to serialize in val_vec, serialize it into the send buffer
    * depending on the mode of data communication selected for the data.
+   * val_vec, offsets and bit_set_comm are serialized by reference (see
+   * gSerializeRef), so they must not change until b has been sent.
    *
    * @tparam syncType either reduce or broadcast
    * @tparam VecType type of val_vec, which stores the data to send
@@ -777,9 +824,9 @@ private:
    * @param b the buffer in which to serialize the message we are sending
    * to
    */
-  template <bool async, SyncType syncType, typename VecType>
+  template <bool async, SyncType syncType, typename VecType, typename IndicesTy>
   void serializeMessage(std::string loopName, DataCommMode data_mode,
-                        size_t bit_set_count, std::vector<size_t>& indices,
+                        size_t bit_set_count, const IndicesTy& indices,
                         galois::PODResizeableArray<unsigned int>& offsets,
                         galois::DynamicBitSet& bit_set_comm, VecType& val_vec,
                         galois::runtime::SendBuffer& b) {
@@ -788,6 +835,9 @@ private:
                                     get_run_identifier(loopName));
     galois::CondStatTimer<GALOIS_COMM_STATS> Tserialize(
         serialize_timer_str.c_str(), RNAME);
+    std::string mode_str(syncTypeStr + "Mode" + dataCommModeName(data_mode) +
+                         "_" + get_run_identifier(loopName));
+    galois::runtime::reportStatCond_Tsum<GALOIS_COMM_STATS>(RNAME, mode_str, 1);
     if (data_mode == noData) {
       if (!async) {
         Tserialize.start();
@@ -799,26 +849,90 @@ private:
       convertLIDToGID<syncType>(loopName, indices, offsets);
       val_vec.resize(bit_set_count);
       Tserialize.start();
-      gSerialize(b, data_mode, bit_set_count, offsets, val_vec);
+      gSerialize(b, data_mode, bit_set_count);
+      galois::runtime::gSerializeRef(b, offsets);
+      galois::runtime::gSerializeRef(b, val_vec);
       Tserialize.stop();
     } else if (data_mode == offsetsData) {
       offsets.resize(bit_set_count);
       val_vec.resize(bit_set_count);
       Tserialize.start();
-      gSerialize(b, data_mode, bit_set_count, offsets, val_vec);
+      gSerialize(b, data_mode, bit_set_count);
+      galois::runtime::gSerializeRef(b, offsets);
+      galois::runtime::gSerializeRef(b, val_vec);
       Tserialize.stop();
+    } else if (data_mode == compressedOffsetsData) {
+      val_vec.resize(bit_set_count);
+      Tserialize.start();
+      galois::runtime::encodeOffsets(offsets, bit_set_count, syncCompressed);
+      gSerialize(b, data_mode, bit_set_count, syncCompressed);
+      size_t offsetBytes = syncCompressed.size();
+      // values go out XOR-delta encoded only if that is actually smaller
+      uint8_t valuesCompressed = galois::runtime::encodeXorValues(
+          val_vec, bit_set_count, syncCompressed);
+      gSerialize(b, valuesCompressed);
+      if (valuesCompressed) {
+        galois::runtime::gSerializeRef(b, syncCompressed);
+      } else {
+        galois::runtime::gSerializeRef(b, val_vec);
+      }
+      Tserialize.stop();
+      reportCompressedSize<typename VecType::value_type>(
+          loopName, syncTypeStr, bit_set_count, offsetBytes,
+          valuesCompressed ? syncCompressed.size()
+                           : bit_set_count *
+                                 sizeof(typename VecType::value_type));
     } else if (data_mode == bitsetData) {
       val_vec.resize(bit_set_count);
       Tserialize.start();
-      gSerialize(b, data_mode, bit_set_count, bit_set_comm, val_vec);
+      gSerialize(b, data_mode, bit_set_count);
+      galois::runtime::gSerializeRef(b, bit_set_comm);
+      galois::runtime::gSerializeRef(b, val_vec);
       Tserialize.stop();
     } else { // onlyData
       Tserialize.start();
-      gSerialize(b, data_mode, val_vec);
+      gSerialize(b, data_mode);
+      galois::runtime::gSerializeRef(b, val_vec);
       Tserialize.stop();
     }
   }
 
+  /**
+   * Applies the values of an onlyData message straight out of the receive
+   * buffer instead of deserializing them into a value vector first. Only
+   * possible for memcopyable values that are suitably aligned in the buffer.
+   *
+   * @tparam IndicesVecTy type of indices
+   * @tparam SyncFnTy synchronization structure with info needed to synchronize
+   * @tparam syncType either reduce or broadcast
+   *
+   * @param loopName used to name timers for statistics
+   * @param indices local ids of the nodes the values belong to
+   * @param buf buffer positioned at the values of the message
+   * @param bit_set_compute bitset indicating which nodes have changed
+   * @returns true if the values were applied; if false, buf is untouched and
+   * the values have to be deserialized as usual
+   */
+  template <typename IndicesVecTy, typename SyncFnTy, SyncType syncType,
+            bool async>
+  bool setSubsetInPlace(const std::string& loopName,
+                        const IndicesVecTy& indices,
+                        galois::runtime::RecvBuffer& buf,
+                        galois::DynamicBitSet& bit_set_compute) {
+    using ValTy = typename SyncFnTy::ValTy;
+    if constexpr (galois::runtime::is_memory_copyable<ValTy>::value) {
+      galois::runtime::DeSerializeView<ValTy> vals;
+      if (galois::runtime::gDeserializeView(buf, vals)) {
+        assert(vals.size() == indices.size());
+        setSubset<IndicesVecTy, SyncFnTy, syncType, decltype(vals), async,
+                  true, true>(loopName, indices, vals.size(), syncOffsets, vals,
+                              bit_set_compute);
+        return true;
+      }
+    }
+    return false;
+  }
+
   /**
    * Given the data mode, deserialize the rest of a message in a Receive Buffer.
    *
@@ -857,6 +971,7 @@ private:
         serialize_timer_str.c_str(), RNAME);
     Tdeserialize.start();
 
+    bool valuesDecoded = false;
     // get other metadata associated with message if mode isn't OnlyData
     if (data_mode != onlyData) {
       galois::runtime::gDeserialize(buf, bit_set_count);
@@ -866,6 +981,18 @@ private:
         convertGIDToLID<syncType>(loopName, offsets);
       } else if (data_mode == offsetsData) {
         galois::runtime::gDeserialize(buf, offsets);
+      } else if (data_mode == compressedOffsetsData) {
+        galois::runtime::gDeserialize(buf, syncCompressed);
+        galois::runtime::decodeOffsets(syncCompressed, bit_set_count, offsets);
+
+        uint8_t valuesCompressed;
+        galois::runtime::gDeserialize(buf, valuesCompressed);
+        if (valuesCompressed) {
+          galois::runtime::gDeserialize(buf, syncCompressed);
+          galois::runtime::decodeXorValues(syncCompressed, bit_set_count,
+                                           val_vec);
+          valuesDecoded = true;
+        }
       } else if (data_mode == bitsetData) {
         bit_set_comm.resize(num);
         galois::runtime::gDeserialize(buf, bit_set_comm);
@@ -877,7 +1004,9 @@ private:
     }
 
     // get data itself
-    galois::runtime::gDeserialize(buf, val_vec);
+    if (!valuesDecoded) {
+      galois::runtime::gDeserialize(buf, val_vec);
+    }
 
     Tdeserialize.stop();
   }
@@ -1061,6 +1190,34 @@ private:
     }
   }
 
+  /**
+   * Reports the bytes saved by compressedOffsetsData over plain offsetsData.
+   *
+   * @tparam ValTy type of the values being sent
+   *
+   * @param loopName loop name used for the statistic
+   * @param syncTypeStr "Reduce" or "Broadcast"
+   * @param bitSetCount number of elements sent
+   * @param offsetBytes bytes used by the encoded offsets
+   * @param valueBytes bytes used by the (possibly encoded) values
+   */
+  template <typename ValTy>
+  void reportCompressedSize(std::string loopName, std::string syncTypeStr,
+                            size_t bitSetCount, size_t offsetBytes,
+                            size_t valueBytes) {
+    size_t plain_size =
+        bitSetCount * (sizeof(unsigned int) + sizeof(ValTy)) + sizeof(size_t);
+    size_t compressed_size = offsetBytes + valueBytes + sizeof(uint8_t);
+
+    if (plain_size > compressed_size) {
+      std::string statSavedBytes_str(syncTypeStr + "CompressedSavedBytes_" +
+                                     get_run_identifier(loopName));
+
+      galois::runtime::reportStatCond_Tsum<GALOIS_COMM_STATS>(
+          RNAME, statSavedBytes_str, (plain_size - compressed_size));
+    }
+  }
+
   ////////////////////////////////////////////////////////////////////////////////
   // Extract data from nodes (for reduce and broadcast)
   ////////////////////////////////////////////////////////////////////////////////
@@ -1126,6 +1283,7 @@ private:
    * particular elements, just grab contiguous chunk)
    * @tparam parallelize Determines if parallelizing the extraction is done or
    * not
+   * @tparam IndicesTy type of indices (a shared node list or a slice of one)
    *
    * @param loopName name of loop used to name timer
    * @param indices Local ids of nodes that we are interested in
@@ -1136,9 +1294,10 @@ private:
    * @param start Offset into val_vec to start saving data to
    */
   template <typename FnTy, SyncType syncType, typename VecTy,
-            bool identity_offsets = false, bool parallelize = true>
-  void extractSubset(const std::string& loopName,
-                     const std::vector<size_t>& indices, size_t size,
+            bool identity_offsets = false, bool parallelize = true,
+            typename IndicesTy = std::vector<size_t>>
+  void extractSubset(const std::string& loopName, const IndicesTy& indices,
+                     size_t size,
                      const galois::PODResizeableArray<unsigned int>& offsets,
                      VecTy& val_vec, size_t start = 0) {
     if (parallelize) {
@@ -2246,6 +2405,11 @@ private:
         Tsetbatch.stop();
 
         // cpu always enters this block
+        if (!batch_succeeded && data_mode == onlyData &&
+            setSubsetInPlace<std::vector<size_t>, SyncFnTy, syncType, async>(
+                loopName, sharedNodes[from_id], buf, BitsetFnTy::get())) {
+          batch_succeeded = true;
+        }
         if (!batch_succeeded) {
           size_t bit_set_count = num;
           size_t buf_start     = 0;
@@ -2555,6 +2719,277 @@ private:
     TRecvTime.stop();
   }
 
+  ////////////////////////////////////////////////////////////////////////////////
+  // Pipelined sync
+  ////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Returns true if a reduce/broadcast should use the chunked, pipelined
+   * protocol instead of one message per host.
+   */
+  template <typename BitsetFnTy, bool async>
+  bool usePipelinedSync() const {
+    return (syncChunkSize > 0) && !async && !BitsetFnTy::is_vector_bitset();
+  }
+
+  //! Number of chunks a shared node list of size n is split into; an empty
+  //! list still exchanges a single (noData) chunk
+  size_t numSyncChunks(size_t n) const {
+    return std::max<size_t>(1, (n + syncChunkSize - 1) / syncChunkSize);
+  }
+
+  //! Chunk c of a shared node list
+  IndexSlice syncChunk(const std::vector<size_t>& nodes, size_t c) const {
+    size_t begin = std::min(c * syncChunkSize, nodes.size());
+    size_t end   = std::min(begin + syncChunkSize, nodes.size());
+    return IndexSlice{nodes.data() + begin, end - begin};
+  }
+
+  /**
+   * Extracts the data of one chunk of a shared node list and appends it to
+   * a send buffer. CPU counterpart of syncExtract restricted to a slice.
+   *
+   * @tparam syncType either reduce or broadcast
+   * @tparam SyncFnTy synchronization structure with info needed to synchronize
+   * @tparam BitsetFnTy struct that has info on how to access the bitset
+   *
+   * @param loopName loop name used for timers
+   * @param indices chunk of the shared node list to extract
+   * @param b OUTPUT: buffer the chunk is serialized into
+   */
+  template <SyncType syncType, typename SyncFnTy, typename BitsetFnTy,
+            typename VecTy>
+  void syncExtractChunk(std::string loopName, const IndexSlice& indices,
+                        galois::runtime::SendBuffer& b) {
+    galois::DynamicBitSet& bit_set_comm = syncBitset;
+    static VecTy val_vec;
+    galois::PODResizeableArray<unsigned int>& offsets = syncOffsets;
+    size_t num                                        = indices.size();
+    size_t bit_set_count                              = 0;
+    DataCommMode data_mode                            = noData;
+
+    if (num > 0) {
+      bit_set_comm.reserve(maxSharedSize);
+      offsets.reserve(maxSharedSize);
+      val_vec.reserve(maxSharedSize);
+      bit_set_comm.resize(num);
+      offsets.resize(num);
+      val_vec.resize(num);
+
+      if (BitsetFnTy::is_valid()) {
+        getBitsetAndOffsets<SyncFnTy, syncType>(
+            loopName, indices, BitsetFnTy::get(), bit_set_comm, offsets,
+            bit_set_count, data_mode);
+      } else {
+        data_mode = onlyData;
+      }
+
+      if (data_mode == onlyData) {
+        bit_set_count = num;
+        extractSubset<SyncFnTy, syncType, VecTy, true, true>(
+            loopName, indices, bit_set_count, offsets, val_vec);
+      } else if (data_mode != noData) {
+        extractSubset<SyncFnTy, syncType, VecTy, false, true>(
+            loopName, indices, bit_set_count, offsets, val_vec);
+      }
+    }
+
+    serializeMessage<false, syncType>(loopName, data_mode, bit_set_count,
+                                      indices, offsets, bit_set_comm, val_vec,
+                                      b);
+  }
+
+  /**
+   * Deserializes one chunk received from another host and applies it.
+   * Complement of syncExtractChunk.
+   *
+   * @tparam syncType either reduce or broadcast
+   * @tparam SyncFnTy synchronization structure with info needed to synchronize
+   * @tparam BitsetFnTy struct that has info on how to access the bitset
+   *
+   * @param from_id host the chunk was received from
+   * @param buf buffer holding the chunk
+   * @param loopName used to name timers for statistics
+   */
+  template <SyncType syncType, typename SyncFnTy, typename BitsetFnTy,
+            typename VecTy>
+  void syncRecvApplyChunk(uint32_t from_id, galois::runtime::RecvBuffer& buf,
+                          std::string loopName) {
+    galois::DynamicBitSet& bit_set_comm = syncBitset;
+    static VecTy val_vec;
+    galois::PODResizeableArray<unsigned int>& offsets = syncOffsets;
+
+    auto& sharedNodes = (syncType == syncReduce) ? masterNodes : mirrorNodes;
+    uint32_t chunk;
+    DataCommMode data_mode;
+    galois::runtime::gDeserialize(buf, chunk, data_mode);
+    IndexSlice indices = syncChunk(sharedNodes[from_id], chunk);
+
+    if (data_mode == noData) {
+      return;
+    }
+    if (data_mode == onlyData &&
+        setSubsetInPlace<IndexSlice, SyncFnTy, syncType, false>(
+            loopName, indices, buf, BitsetFnTy::get())) {
+      return;
+    }
+
+    size_t bit_set_count = indices.size();
+    size_t buf_start     = 0;
+    size_t retval        = 0;
+    deserializeMessage<syncType>(loopName, data_mode, indices.size(), buf,
+                                 bit_set_count, offsets, bit_set_comm,
+                                 buf_start, retval, val_vec);
+
+    galois::DynamicBitSet& bit_set_compute = BitsetFnTy::get();
+
+    if (data_mode == bitsetData) {
+      size_t bit_set_count2;
+      getOffsetsFromBitset<syncType>(loopName, bit_set_comm, offsets,
+                                     bit_set_count2);
+      assert(bit_set_count == bit_set_count2);
+    }
+
+    if (data_mode == onlyData) {
+      setSubset<IndexSlice, SyncFnTy, syncType, VecTy, false, true, true>(
+          loopName, indices, bit_set_count, offsets, val_vec, bit_set_compute);
+    } else if (data_mode == gidsData) {
+      setSubset<decltype(offsets), SyncFnTy, syncType, VecTy, false, true,
+                true>(loopName, offsets, bit_set_count, offsets, val_vec,
+                      bit_set_compute);
+    } else { // bitsetData, offsetsData or compressedOffsetsData
+      setSubset<IndexSlice, SyncFnTy, syncType, VecTy, false, false, true>(
+          loopName, indices, bit_set_count, offsets, val_vec, bit_set_compute);
+    }
+  }
+
+  /**
+   * Sends every host its shared nodes in chunks of syncChunkSize nodes. Each
+   * chunk is put on the wire as soon as it is extracted; if applyWhileSending
+   * is set, chunks that other hosts have already sent are applied in between
+   * so that extraction, transfer and application overlap.
+   *
+   * @tparam SendBitsetFnTy bitset deciding which shared nodes are sent
+   * @tparam RecvBitsetFnTy bitset updated when received chunks are applied
+   *
+   * @param loopName used to name timers for statistics
+   * @param applyWhileSending apply already received chunks between sends
+   * @returns number of received chunks that were applied
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation,
+            SyncType syncType, typename SyncFnTy, typename SendBitsetFnTy,
+            typename RecvBitsetFnTy, typename VecTy>
+  size_t syncPipelinedSend(std::string loopName, bool applyWhileSending) {
+    auto& net               = galois::runtime::getSystemNetworkInterface();
+    std::string syncTypeStr = (syncType == syncReduce) ? "Reduce" : "Broadcast";
+    galois::CondStatTimer<GALOIS_COMM_STATS> TSendTime(
+        (syncTypeStr + "Send_" + get_run_identifier(loopName)).c_str(), RNAME);
+    auto& sharedNodes = (syncType == syncReduce) ? mirrorNodes : masterNodes;
+
+    TSendTime.start();
+    size_t numMessages = 0;
+    size_t numBytes    = 0;
+    size_t numApplied  = 0;
+    for (unsigned h = 1; h < numHosts; ++h) {
+      unsigned x = (id + h) % numHosts;
+
+      if (nothingToSend(x, syncType, writeLocation, readLocation))
+        continue;
+
+      size_t numChunks = numSyncChunks(sharedNodes[x].size());
+      for (size_t c = 0; c < numChunks; ++c) {
+        galois::runtime::SendBuffer b;
+        gSerialize(b, static_cast<uint32_t>(c));
+        syncExtractChunk<syncType, SyncFnTy, SendBitsetFnTy, VecTy>(
+            loopName, syncChunk(sharedNodes[x], c), b);
+        numBytes += b.size();
+        net.sendTagged(x, galois::runtime::evilPhase, b);
+        net.flush();
+        ++numMessages;
+
+        if (applyWhileSending) {
+          decltype(net.recieveTagged(galois::runtime::evilPhase, nullptr)) p;
+          while ((p = net.recieveTagged(galois::runtime::evilPhase, nullptr))) {
+            syncRecvApplyChunk<syncType, SyncFnTy, RecvBitsetFnTy, VecTy>(
+                p->first, p->second, loopName);
+            ++numApplied;
+          }
+        }
+      }
+    }
+
+    if (SendBitsetFnTy::is_valid()) {
+      reset_bitset(syncType, &SendBitsetFnTy::reset_range);
+    }
+    TSendTime.stop();
+
+    galois::runtime::reportStat_Tsum(
+        RNAME, syncTypeStr + "NumMessages_" + get_run_identifier(loopName),
+        numMessages);
+    galois::runtime::reportStat_Tsum(
+        RNAME, syncTypeStr + "SendBytes_" + get_run_identifier(loopName),
+        numBytes);
+    return numApplied;
+  }
+
+  /**
+   * Receives and applies the chunks of a pipelined sync that have not been
+   * applied yet, then moves on to the next communication phase.
+   *
+   * @param loopName used to name timers for statistics
+   * @param numApplied chunks already applied by syncPipelinedSend
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation,
+            SyncType syncType, typename SyncFnTy, typename BitsetFnTy,
+            typename VecTy>
+  void syncPipelinedRecv(std::string loopName, size_t numApplied) {
+    auto& net               = galois::runtime::getSystemNetworkInterface();
+    std::string syncTypeStr = (syncType == syncReduce) ? "Reduce" : "Broadcast";
+    galois::CondStatTimer<GALOIS_COMM_STATS> TRecvTime(
+        (syncTypeStr + "Recv_" + get_run_identifier(loopName)).c_str(), RNAME);
+    auto& sharedNodes = (syncType == syncReduce) ? masterNodes : mirrorNodes;
+
+    TRecvTime.start();
+    size_t numExpected = 0;
+    for (unsigned x = 0; x < numHosts; ++x) {
+      if (x == id)
+        continue;
+      if (nothingToRecv(x, syncType, writeLocation, readLocation))
+        continue;
+      numExpected += numSyncChunks(sharedNodes[x].size());
+    }
+    assert(numApplied <= numExpected);
+
+    for (; numApplied < numExpected; ++numApplied) {
+      decltype(net.recieveTagged(galois::runtime::evilPhase, nullptr)) p;
+      do {
+        p = net.recieveTagged(galois::runtime::evilPhase, nullptr);
+      } while (!p);
+      syncRecvApplyChunk<syncType, SyncFnTy, BitsetFnTy, VecTy>(
+          p->first, p->second, loopName);
+    }
+    incrementEvilPhase();
+    TRecvTime.stop();
+  }
+
+  /**
+   * Pipelined replacement for syncSend followed by syncRecv.
+   *
+   * @tparam SendBitsetFnTy bitset deciding which shared nodes are sent
+   * @tparam RecvBitsetFnTy bitset updated when received chunks are applied
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation,
+            SyncType syncType, typename SyncFnTy, typename SendBitsetFnTy,
+            typename RecvBitsetFnTy, typename VecTy>
+  void syncPipelined(std::string loopName) {
+    size_t numApplied =
+        syncPipelinedSend<writeLocation, readLocation, syncType, SyncFnTy,
+                          SendBitsetFnTy, RecvBitsetFnTy, VecTy>(loopName,
+                                                                 true);
+    syncPipelinedRecv<writeLocation, readLocation, syncType, SyncFnTy,
+                      RecvBitsetFnTy, VecTy>(loopName, numApplied);
+  }
+
 ////////////////////////////////////////////////////////////////////////////////
 // MPI sync variants
 ////////////////////////////////////////////////////////////////////////////////
@@ -2734,10 +3169,15 @@ private:
     switch (bare_mpi) {
     case noBareMPI:
 #endif
-      syncSend<writeLocation, readLocation, syncReduce, ReduceFnTy, BitsetFnTy,
-               VecTy, async>(loopName);
-      syncRecv<writeLocation, readLocation, syncReduce, ReduceFnTy, BitsetFnTy,
-               VecTy, async>(loopName);
+      if (usePipelinedSync<BitsetFnTy, async>()) {
+        syncPipelined<writeLocation, readLocation, syncReduce, ReduceFnTy,
+                      BitsetFnTy, BitsetFnTy, VecTy>(loopName);
+      } else {
+        syncSend<writeLocation, readLocation, syncReduce, ReduceFnTy,
+                 BitsetFnTy, VecTy, async>(loopName);
+        syncRecv<writeLocation, readLocation, syncReduce, ReduceFnTy,
+                 BitsetFnTy, VecTy, async>(loopName);
+      }
 #ifdef GALOIS_USE_BARE_MPI
       break;
     case nonBlockingBareMPI:
@@ -2808,15 +3248,27 @@ private:
     switch (bare_mpi) {
     case noBareMPI:
 #endif
-      if (use_bitset) {
-        syncSend<writeLocation, readLocation, syncBroadcast, BroadcastFnTy,
-                 BitsetFnTy, VecTy, async>(loopName);
+      if (usePipelinedSync<BitsetFnTy, async>()) {
+        if (use_bitset) {
+          syncPipelined<writeLocation, readLocation, syncBroadcast,
+                        BroadcastFnTy, BitsetFnTy, BitsetFnTy, VecTy>(
+              loopName);
+        } else {
+          syncPipelined<writeLocation, readLocation, syncBroadcast,
+                        BroadcastFnTy, galois::InvalidBitsetFnTy, BitsetFnTy,
+                        VecTy>(loopName);
+        }
       } else {
-        syncSend<writeLocation, readLocation, syncBroadcast, BroadcastFnTy,
-                 galois::InvalidBitsetFnTy, VecTy, async>(loopName);
+        if (use_bitset) {
+          syncSend<writeLocation, readLocation, syncBroadcast, BroadcastFnTy,
+                   BitsetFnTy, VecTy, async>(loopName);
+        } else {
+          syncSend<writeLocation, readLocation, syncBroadcast, BroadcastFnTy,
+                   galois::InvalidBitsetFnTy, VecTy, async>(loopName);
+        }
+        syncRecv<writeLocation, readLocation, syncBroadcast, BroadcastFnTy,
+                 BitsetFnTy, VecTy, async>(loopName);
       }
-      syncRecv<writeLocation, readLocation, syncBroadcast, BroadcastFnTy,
-               BitsetFnTy, VecTy, async>(loopName);
 #ifdef GALOIS_USE_BARE_MPI
       break;
     case nonBlockingBareMPI:
@@ -3023,6 +3475,50 @@ private:
     broadcast<writeAny, readAny, SyncFnTy, BitsetFnTy, async>(loopName);
   }
 
+  /**
+   * Returns true if sync<writeLocation, readLocation> has a reduce phase on
+   * this partitioning (mirrors the sync_*_to_* functions below).
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation>
+  bool syncHasReduce() const {
+    if (partitionAgnostic || writeLocation == writeAny) {
+      return true;
+    } else if (writeLocation == writeSource) {
+      return (transposed || isVertexCut);
+    } else { // writeDestination
+      return (!transposed || isVertexCut);
+    }
+  }
+
+  /**
+   * Returns true if sync<writeLocation, readLocation> has a broadcast phase
+   * on this partitioning (mirrors the sync_*_to_* functions below).
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation>
+  bool syncHasBroadcast() const {
+    if (partitionAgnostic || readLocation == readAny) {
+      return true;
+    } else if (readLocation == readSource) {
+      return (transposed || isVertexCut);
+    } else { // readDestination
+      return (!transposed || isVertexCut);
+    }
+  }
+
+  /**
+   * Returns true if syncStart<writeLocation, readLocation> sends the reduce
+   * phase early; otherwise syncWait does the whole sync.
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation>
+  bool syncStartsEarly() const {
+#ifdef GALOIS_USE_BARE_MPI
+    if (bare_mpi != noBareMPI) {
+      return false;
+    }
+#endif
+    return syncHasReduce<writeLocation, readLocation>();
+  }
+
   ////////////////////////////////////////////////////////////////////////////////
   // Public iterface: sync
   ////////////////////////////////////////////////////////////////////////////////
@@ -3046,6 +3542,7 @@ public:
   inline void sync(std::string loopName) {
     std::string timer_str("Sync_" + loopName + "_" + get_run_identifier());
     galois::StatTimer Tsync(timer_str.c_str(), RNAME);
+    GALOIS_ASSERT(!syncInFlight, "sync called between syncStart and syncWait");
 
     Tsync.start();
 
@@ -3082,6 +3579,206 @@ public:
     Tsync.stop();
   }
 
+  /**
+   * Starts a sync that is completed by the matching syncWait call (same
+   * template arguments and loop name), letting the caller do local work
+   * while the data is in flight.
+   *
+   * If the sync has a reduce phase, this extracts and sends the mirrors'
+   * values right away (resetting them as a reduce does). Between the two
+   * calls the caller must not touch the field on mirrors and may only
+   * update it on masters with the sync structure's own reduction, since
+   * received values are reduced into masters in syncWait. No other sync may
+   * be issued in between.
+   *
+   * @tparam writeLocation Location data is written (src or dst)
+   * @tparam readLocation Location data is read (src or dst)
+   * @tparam SyncFnTy sync structure for the field
+   * @tparam BitsetFnTy struct that has info on how to access the bitset
+   *
+   * @param loopName used to name timers for statistics
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation,
+            typename SyncFnTy, typename BitsetFnTy = galois::InvalidBitsetFnTy>
+  void syncStart(std::string loopName) {
+    static_assert(!BitsetFnTy::is_vector_bitset(),
+                  "syncStart does not support vector bitsets");
+    GALOIS_ASSERT(!syncInFlight, "syncStart called before previous syncWait");
+    syncInFlight = true;
+
+    if (!syncStartsEarly<writeLocation, readLocation>()) {
+      return;
+    }
+
+    typedef typename SyncFnTy::ValTy T;
+    typedef
+        typename std::conditional<galois::runtime::is_memory_copyable<T>::value,
+                                  galois::PODResizeableArray<T>,
+                                  galois::gstl::Vector<T>>::type VecTy;
+
+    std::string timer_str("SyncStart_" + loopName + "_" + get_run_identifier());
+    galois::StatTimer Tsync(timer_str.c_str(), RNAME);
+
+    Tsync.start();
+    if (usePipelinedSync<BitsetFnTy, false>()) {
+      syncPipelinedSend<writeLocation, readLocation, syncReduce, SyncFnTy,
+                        BitsetFnTy, BitsetFnTy, VecTy>(loopName, false);
+    } else {
+      syncSend<writeLocation, readLocation, syncReduce, SyncFnTy, BitsetFnTy,
+               VecTy, false>(loopName);
+    }
+    Tsync.stop();
+  }
+
+  /**
+   * Completes a sync begun by syncStart: receives and applies the reduce
+   * phase, then does the broadcast phase if the sync has one. On return the
+   * field is in the same state a plain sync call would have left it.
+   *
+   * @tparam writeLocation Location data is written (src or dst)
+   * @tparam readLocation Location data is read (src or dst)
+   * @tparam SyncFnTy sync structure for the field
+   * @tparam BitsetFnTy struct that has info on how to access the bitset
+   *
+   * @param loopName used to name timers for statistics
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation,
+            typename SyncFnTy, typename BitsetFnTy = galois::InvalidBitsetFnTy>
+  void syncWait(std::string loopName) {
+    GALOIS_ASSERT(syncInFlight, "syncWait called without syncStart");
+    syncInFlight = false;
+
+    if (!syncStartsEarly<writeLocation, readLocation>()) {
+      sync<writeLocation, readLocation, SyncFnTy, BitsetFnTy>(loopName);
+      return;
+    }
+
+    typedef typename SyncFnTy::ValTy T;
+    typedef
+        typename std::conditional<galois::runtime::is_memory_copyable<T>::value,
+                                  galois::PODResizeableArray<T>,
+                                  galois::gstl::Vector<T>>::type VecTy;
+
+    std::string timer_str("SyncWait_" + loopName + "_" + get_run_identifier());
+    galois::StatTimer Tsync(timer_str.c_str(), RNAME);
+
+    Tsync.start();
+    if (usePipelinedSync<BitsetFnTy, false>()) {
+      syncPipelinedRecv<writeLocation, readLocation, syncReduce, SyncFnTy,
+                        BitsetFnTy, VecTy>(loopName, 0);
+    } else {
+      syncRecv<writeLocation, readLocation, syncReduce, SyncFnTy, BitsetFnTy,
+               VecTy, false>(loopName);
+    }
+    if (syncHasBroadcast<writeLocation, readLocation>()) {
+      broadcast<writeLocation, readLocation, SyncFnTy, BitsetFnTy, false>(
+          loopName);
+    }
+    Tsync.stop();
+  }
+
+  /**
+   * Sets the number of shared nodes sent per message by sync. With a
+   * non-zero chunk size, each host's shared node list is split into chunks
+   * that are sent as soon as they are extracted while received chunks are
+   * applied in between (pipelined sync). 0 (the default) sends one message
+   * per host. Every host must use the same value. CPU only: GPU batch
+   * extraction works on whole host lists.
+   *
+   * @param chunkSize shared nodes per message; 0 disables pipelining
+   */
+  void set_sync_chunk_size(size_t chunkSize) { syncChunkSize = chunkSize; }
+
+  /**
+   * Allows or forbids sending compressedOffsetsData. GPU hosts cannot decode
+   * it, so it is off by default in GPU builds; enable it only if every host
+   * runs on a CPU. Every host must use the same value.
+   *
+   * @param allowed true if no host is a GPU host
+   */
+  void set_compressed_offsets(bool allowed) {
+    compressedOffsetsAllowed = allowed;
+  }
+
+private:
+  /**
+   * Number of values this host sends in a sync<writeLocation, readLocation>
+   * if every shared node is updated (i.e. without bitset tracking).
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation>
+  uint64_t denseSyncValues() {
+    uint64_t values = 0;
+    for (unsigned h = 0; h < numHosts; ++h) {
+      if (h == id) {
+        continue;
+      }
+      if (syncHasReduce<writeLocation, readLocation>() &&
+          !nothingToSend(h, syncReduce, writeLocation, readLocation)) {
+        values += mirrorNodes[h].size();
+      }
+      if (syncHasBroadcast<writeLocation, readLocation>() &&
+          !nothingToSend(h, syncBroadcast, writeLocation, readLocation)) {
+        values += masterNodes[h].size();
+      }
+    }
+    return values;
+  }
+
+  /**
+   * Reports the estimated bytes this host sends for one sync with the given
+   * locations (max over hosts); host 0 also reports the total over hosts and
+   * prints both.
+   */
+  template <WriteLocation writeLocation, ReadLocation readLocation>
+  void reportSyncEstimate(const std::string& locations, size_t valueBytes) {
+    uint64_t bytes =
+        denseSyncValues<writeLocation, readLocation>() * valueBytes;
+    galois::runtime::reportStat_Tmax(RNAME, "EstimatedSyncBytes_" + locations,
+                                     bytes);
+
+    galois::DGAccumulator<uint64_t> totalBytes;
+    galois::DGReduceMax<uint64_t> maxBytes;
+    totalBytes.reset();
+    totalBytes += bytes;
+    maxBytes.update(bytes);
+    uint64_t total = totalBytes.reduce();
+    uint64_t most  = maxBytes.reduce();
+    if (id == 0) {
+      galois::runtime::reportStat_Single(
+          RNAME, "EstimatedSyncBytesTotal_" + locations, total);
+      galois::gPrint("  ", locations, ": max ", most, " bytes, total ", total,
+                     " bytes\n");
+    }
+  }
+
+public:
+  /**
+   * Estimates the bytes each sync<writeLocation, readLocation> would send on
+   * this partitioning, for all 9 location combinations, assuming every
+   * shared node is updated and ignoring offset/bitset metadata (so syncs
+   * with bitsets usually send less). Useful for comparing partitioning
+   * policies without running an application. Collective: all hosts must
+   * call this.
+   *
+   * @param valueBytes size of one synchronized field value
+   */
+  void reportSyncVolumeEstimate(size_t valueBytes) {
+    if (id == 0) {
+      galois::gPrint("Estimated bytes per sync (write_read, ", valueBytes,
+                     " byte values):\n");
+    }
+    reportSyncEstimate<writeSource, readSource>("src_src", valueBytes);
+    reportSyncEstimate<writeSource, readDestination>("src_dst", valueBytes);
+    reportSyncEstimate<writeSource, readAny>("src_any", valueBytes);
+    reportSyncEstimate<writeDestination, readSource>("dst_src", valueBytes);
+    reportSyncEstimate<writeDestination, readDestination>("dst_dst",
+                                                         valueBytes);
+    reportSyncEstimate<writeDestination, readAny>("dst_any", valueBytes);
+    reportSyncEstimate<writeAny, readSource>("any_src", valueBytes);
+    reportSyncEstimate<writeAny, readDestination>("any_dst", valueBytes);
+    reportSyncEstimate<writeAny, readAny>("any_any", valueBytes);
+  }
+
   ////////////////////////////////////////////////////////////////////////////////
   // Sync on demand code (unmaintained, may not work)
   ////////////////////////////////////////////////////////////////////////////////
@@ -3542,89 +4239,353 @@ public:
 // Checkpointing code for graph
 ////////////////////////////////////////////////////////////////////////////////
 
-// @todo Checkpointing code needs updates to make it work.
-#ifdef GALOIS_CHECKPOINT
-///*
-// * Headers for boost serialization
-// */
-//#include <boost/archive/binary_oarchive.hpp>
-//#include <boost/archive/binary_iarchive.hpp>
-//#include <boost/serialization/split_member.hpp>
-//#include <boost/serialization/binary_object.hpp>
-//#include <boost/serialization/serialization.hpp>
-//#include <boost/serialization/vector.hpp>
-//#include <boost/serialization/unordered_map.hpp>
-//
-// public:
-//  /**
-//   * Checkpoint the complete structure on the node to disk
-//   */
-//  void checkpointSaveNodeData(std::string checkpointFileName = "checkpoint") {
-//    using namespace boost::archive;
-//    galois::StatTimer TimerSaveCheckPoint(
-//        get_run_identifier("TimerSaveCheckpoint").c_str(), RNAME);
-//
-//    TimerSaveCheckPoint.start();
-//    std::string checkpointFileName_local =
-//        checkpointFileName + "_" + std::to_string(id);
-//
-//    std::ofstream outputStream(checkpointFileName_local, std::ios::binary);
-//    if (!outputStream.is_open()) {
-//      galois::gPrint("ERROR: Could not open ", checkpointFileName_local,
-//                     " to save checkpoint!!!\n");
-//    }
-//    galois::gPrint("[", id,
-//                   "] Saving local checkpoint to :", checkpointFileName_local,
-//                   "\n");
-//
-//    boost::archive::binary_oarchive ar(outputStream,
-//    boost::archive::no_header);
-//
-//    // TODO handle this with CuSP
-//    userGraph.serializeNodeData(ar);
-//
-//    std::string statSendBytes_str("CheckpointBytesTotal");
-//    constexpr static const char* const RREGION = "RECOVERY";
-//    size_t cp_size                             = outputStream.tellp();
-//    galois::runtime::reportStat_Tsum(RREGION, statSendBytes_str, cp_size);
-//
-//    outputStream.flush();
-//    outputStream.close();
-//    TimerSaveCheckPoint.stop();
-//  }
-//
-//  /**
-//   * Load checkpointed data from disk.
-//   */
-//  void checkpointApplyNodeData(std::string checkpointFileName = "checkpoint")
-//  {
-//    using namespace boost::archive;
-//    galois::StatTimer TimerApplyCheckPoint(
-//        get_run_identifier("TimerApplyCheckpoint").c_str(), RNAME);
-//
-//    TimerApplyCheckPoint.start();
-//    std::string checkpointFileName_local =
-//        checkpointFileName + "_" + std::to_string(id);
-//
-//    std::ifstream inputStream(checkpointFileName_local, std::ios::binary);
-//
-//    if (!inputStream.is_open()) {
-//      galois::gPrint("ERROR: Could not open ", checkpointFileName_local,
-//                     " to read checkpoint!!!\n");
-//    }
-//    galois::gPrint("[", id, "] reading local checkpoint from: ",
-//                   checkpointFileName_local, "\n");
-//
-//    boost::archive::binary_iarchive ar(inputStream,
-//    boost::archive::no_header);
-//
-//    // TODO handle this with CuSP
-//    userGraph.deSerializeNodeData(ar);
-//
-//    inputStream.close();
-//    TimerApplyCheckPoint.stop();
-//  }
-#endif
+private:
+  //! Version of the on-disk checkpoint format
+  constexpr static uint32_t checkpointVersion = 1;
+  //! First bytes of every checkpoint file ("GLNCKPT" plus a zero)
+  constexpr static uint64_t checkpointMagic = 0x0054504b434e4c47;
+
+  /**
+   * Checkpoints are ordered by run, then by round; key 0 means "none", which
+   * is why checkpointed rounds must be non-zero.
+   */
+  uint64_t checkpointKey(uint32_t run, uint32_t round) const {
+    return (static_cast<uint64_t>(run) << 32) | round;
+  }
+
+  //! Name of this host's checkpoint file for a key
+  std::string checkpointFileName(uint64_t key) const {
+    return checkpointDir + "/checkpoint_" + std::to_string(id) + "_" +
+           std::to_string(key >> 32) + "_" +
+           std::to_string(key & 0xffffffff);
+  }
+
+  //! Name of this host's manifest, which names its last two checkpoints
+  std::string checkpointManifestName() const {
+    return checkpointDir + "/manifest_" + std::to_string(id);
+  }
+
+  /**
+   * Order-independent hash of the local to global id map, so that a
+   * checkpoint is only ever applied to the partition that wrote it.
+   */
+  uint64_t checkpointPartitionHash() {
+    galois::GAccumulator<uint64_t> hash;
+    galois::do_all(
+        galois::iterate(size_t{0}, userGraph.size()),
+        [&](size_t lid) {
+          // splitmix64 finalizer
+          uint64_t x = (static_cast<uint64_t>(lid) << 32) ^
+                       static_cast<uint64_t>(userGraph.getGID(lid));
+          x          = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+          x          = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+          hash += x ^ (x >> 31);
+        },
+        galois::no_stats(),
+        galois::loopname(get_run_identifier("CheckpointHash").c_str()));
+    return hash.reduce();
+  }
+
+  /**
+   * Serialize the field that FnTy accesses for every local node.
+   *
+   * @tparam FnTy structure with ValTy, extract, and setVal (any sync
+   * structure works)
+   */
+  template <typename FnTy>
+  void checkpointExtract(galois::runtime::SendBuffer& b) {
+    typedef typename FnTy::ValTy T;
+    typedef
+        typename std::conditional<galois::runtime::is_memory_copyable<T>::value,
+                                  galois::PODResizeableArray<T>,
+                                  galois::gstl::Vector<T>>::type VecTy;
+    VecTy vals;
+    vals.resize(userGraph.size());
+    galois::do_all(
+        galois::iterate(size_t{0}, userGraph.size()),
+        [&](size_t lid) {
+          vals[lid] = FnTy::extract(lid, userGraph.getData(lid));
+        },
+        galois::no_stats(),
+        galois::loopname(get_run_identifier("CheckpointExtract").c_str()));
+    gSerialize(b, vals);
+  }
+
+  //! Inverse of checkpointExtract
+  template <typename FnTy>
+  void checkpointSet(galois::runtime::RecvBuffer& b) {
+    typedef typename FnTy::ValTy T;
+    typedef
+        typename std::conditional<galois::runtime::is_memory_copyable<T>::value,
+                                  galois::PODResizeableArray<T>,
+                                  galois::gstl::Vector<T>>::type VecTy;
+    VecTy vals;
+    gDeserialize(b, vals);
+    GALOIS_ASSERT(vals.size() == userGraph.size(),
+                  "checkpoint field has the wrong number of nodes");
+    galois::do_all(
+        galois::iterate(size_t{0}, userGraph.size()),
+        [&](size_t lid) {
+          FnTy::setVal(lid, userGraph.getData(lid), vals[lid]);
+        },
+        galois::no_stats(),
+        galois::loopname(get_run_identifier("CheckpointSet").c_str()));
+  }
+
+public:
+  /**
+   * Enables checkpointing of node data to a directory. Each host writes its
+   * own files and manifest, so the directory may be on a disk local to the
+   * host as long as the same host id finds it again on restart.
+   *
+   * @param dir existing directory to keep checkpoints in; empty disables
+   * checkpointing
+   * @param mtbfSeconds expected seconds between failures, which sets how
+   * often checkpoints are taken
+   * @param restart if true, checkpointApplyNodeData resumes from the last
+   * checkpoint that every host completed
+   */
+  void set_checkpoint_options(const std::string& dir, double mtbfSeconds,
+                              bool restart) {
+    checkpointDir      = dir;
+    checkpointMTBF     = mtbfSeconds;
+    checkpointRestart  = restart && !dir.empty();
+    checkpointInterval = 0;
+  }
+
+  /**
+   * Call at the end of every round (after its syncs) on all hosts. Saves the
+   * fields the FnTys access for all local nodes, plus the round, when a
+   * checkpoint is due.
+   *
+   * The interval in rounds follows Young's approximation
+   * sqrt(2 * checkpoint cost * MTBF) and is recomputed after every
+   * checkpoint from the slowest host's measured checkpoint and round times,
+   * so every host makes the same decision. A checkpoint only becomes the
+   * restart point once all hosts have written it: files are renamed into
+   * place, hosts wait on a barrier, and then each host updates its
+   * manifest. The two newest checkpoints are kept.
+   *
+   * @tparam FnTys structures with ValTy, extract, and setVal (sync
+   * structures work) for the fields that must survive a restart
+   *
+   * @param round number of completed rounds in the current run; non-zero
+   * @returns true if a checkpoint was written
+   */
+  template <typename... FnTys>
+  bool checkpointSaveNodeData(uint32_t round) {
+    // don't overwrite checkpoints of a later run that a restart still needs
+    if (checkpointDir.empty() || checkpointRestart) {
+      return false;
+    }
+    GALOIS_ASSERT(round != 0, "checkpointed rounds must be non-zero");
+
+    auto start = std::chrono::steady_clock::now();
+    if (checkpointInterval == 0) {
+      // first call only starts the clock for measuring round time
+      checkpointInterval    = 1;
+      checkpointRoundsSince = 0;
+      checkpointLastTime    = start;
+      return false;
+    }
+    if (++checkpointRoundsSince < checkpointInterval) {
+      return false;
+    }
+    double roundTime =
+        std::chrono::duration<double>(start - checkpointLastTime).count() /
+        checkpointRoundsSince;
+
+    galois::StatTimer TimerSaveCheckpoint(
+        get_run_identifier("TimerSaveCheckpoint").c_str(), RNAME);
+    TimerSaveCheckpoint.start();
+
+    uint64_t key = checkpointKey(num_run, round);
+    galois::runtime::SendBuffer b;
+    gSerialize(b, checkpointMagic, checkpointVersion, id, numHosts, key,
+               static_cast<uint64_t>(userGraph.size()),
+               checkpointPartitionHash());
+    (checkpointExtract<FnTys>(b), ...);
+
+    std::string fileName = checkpointFileName(key);
+    {
+      std::ofstream out(fileName + ".tmp", std::ios::binary);
+      out.write(reinterpret_cast<const char*>(b.linearData()), b.size());
+      out.close();
+      if (!out) {
+        GALOIS_DIE("could not write checkpoint ", fileName);
+      }
+    }
+    if (std::rename((fileName + ".tmp").c_str(), fileName.c_str()) != 0) {
+      GALOIS_DIE("could not rename checkpoint ", fileName);
+    }
+
+    // every host has the new file before any manifest names it
+    galois::runtime::getHostBarrier().wait();
+
+    std::string manifestName = checkpointManifestName();
+    {
+      std::ofstream out(manifestName + ".tmp");
+      out << "version " << checkpointVersion << "\nhosts " << numHosts
+          << "\ncurrent " << key << "\nprevious " << checkpointKeys[0]
+          << "\n";
+      out.close();
+      if (!out) {
+        GALOIS_DIE("could not write checkpoint manifest ", manifestName);
+      }
+    }
+    if (std::rename((manifestName + ".tmp").c_str(), manifestName.c_str()) !=
+        0) {
+      GALOIS_DIE("could not rename checkpoint manifest ", manifestName);
+    }
+    if (checkpointKeys[1] != 0) {
+      std::remove(checkpointFileName(checkpointKeys[1]).c_str());
+    }
+    checkpointKeys[1] = checkpointKeys[0];
+    checkpointKeys[0] = key;
+    TimerSaveCheckpoint.stop();
+
+    auto end    = std::chrono::steady_clock::now();
+    double cost = std::chrono::duration<double>(end - start).count();
+    galois::DGReduceMax<double> maxCost;
+    galois::DGReduceMax<double> maxRoundTime;
+    maxCost.update(cost);
+    maxRoundTime.update(roundTime);
+    double youngRounds = std::sqrt(2 * maxCost.reduce() * checkpointMTBF) /
+                         std::max(maxRoundTime.reduce(), 1e-9);
+    checkpointInterval = static_cast<uint32_t>(
+        std::min(std::max(std::round(youngRounds), 1.0), 1e9));
+    checkpointRoundsSince = 0;
+    checkpointLastTime    = std::chrono::steady_clock::now();
+
+    constexpr static const char* const RREGION = "RECOVERY";
+    galois::runtime::reportStat_Tsum(RREGION, "CheckpointBytesTotal",
+                                     b.size());
+    galois::runtime::reportStat_Tmax(
+        RREGION, get_run_identifier("CheckpointInterval", round),
+        checkpointInterval);
+    return true;
+  }
+
+  /**
+   * Call once per run, before its first round, on all hosts. If a restart
+   * was requested and the newest checkpoint that every host completed
+   * belongs to the current run, sets the fields the FnTys access on all
+   * local nodes (masters and mirrors) back to their checkpointed values.
+   *
+   * Checkpoints are validated against the host count, the local node count,
+   * and a hash of the partition, so the graph must be partitioned the same
+   * way as when it was written (same hosts, policy, and input).
+   *
+   * @tparam FnTys the same structures that were passed to
+   * checkpointSaveNodeData
+   *
+   * @param round OUTPUT: the round that was checkpointed; untouched if
+   * nothing was applied
+   * @returns true if a checkpoint was applied
+   */
+  template <typename... FnTys>
+  bool checkpointApplyNodeData(uint32_t& round) {
+    if (!checkpointRestart) {
+      return false;
+    }
+
+    uint64_t keys[2]    = {0, 0};
+    std::string manName = checkpointManifestName();
+    std::ifstream manifest(manName);
+    if (manifest.is_open()) {
+      std::string tag;
+      uint32_t version = 0;
+      uint32_t hosts   = 0;
+      manifest >> tag >> version >> tag >> hosts >> tag >> keys[0] >> tag >>
+          keys[1];
+      if (!manifest || version != checkpointVersion) {
+        GALOIS_DIE("unreadable checkpoint manifest ", manName);
+      }
+      if (hosts != numHosts) {
+        GALOIS_DIE("checkpoint in ", manName, " was written by ", hosts,
+                   " hosts, but running on ", numHosts);
+      }
+    }
+
+    // manifests are at most one checkpoint apart, so the oldest newest one
+    // is on every host
+    galois::DGReduceMin<uint64_t> minKey;
+    minKey.update(keys[0]);
+    uint64_t key = minKey.reduce();
+    if (key == 0 || (key >> 32) < num_run) {
+      if (id == 0) {
+        galois::gWarn("no checkpoint to restart run ", num_run, " from");
+      }
+      checkpointRestart = false;
+      return false;
+    }
+    if ((key >> 32) > num_run) {
+      // checkpoint belongs to a later run
+      return false;
+    }
+    if (key != keys[0] && key != keys[1]) {
+      GALOIS_DIE("checkpoint ", checkpointFileName(key), " is missing");
+    }
+
+    galois::StatTimer TimerApplyCheckpoint(
+        get_run_identifier("TimerApplyCheckpoint").c_str(), RNAME);
+    TimerApplyCheckpoint.start();
+
+    std::string fileName = checkpointFileName(key);
+    std::ifstream in(fileName, std::ios::binary | std::ios::ate);
+    if (!in.is_open()) {
+      GALOIS_DIE("could not open checkpoint ", fileName);
+    }
+    size_t fileSize = in.tellg();
+    galois::runtime::RecvBuffer buf;
+    buf.getVec().resize(fileSize);
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(buf.linearData()), fileSize);
+    if (!in) {
+      GALOIS_DIE("could not read checkpoint ", fileName);
+    }
+
+    uint64_t magic;
+    uint32_t version;
+    unsigned host;
+    uint32_t hosts;
+    uint64_t fileKey;
+    uint64_t numNodes;
+    uint64_t partitionHash;
+    gDeserialize(buf, magic, version, host, hosts, fileKey, numNodes,
+                 partitionHash);
+    if (magic != checkpointMagic || version != checkpointVersion ||
+        host != id || hosts != numHosts || fileKey != key) {
+      GALOIS_DIE("checkpoint ", fileName, " does not match its manifest");
+    }
+    if (numNodes != userGraph.size() ||
+        partitionHash != checkpointPartitionHash()) {
+      GALOIS_DIE("checkpoint ", fileName,
+                 " was written for a different partition");
+    }
+    (checkpointSet<FnTys>(buf), ...);
+    GALOIS_ASSERT(buf.r_size() == 0, "trailing bytes in checkpoint ",
+                  fileName);
+
+    if (key == keys[0]) {
+      checkpointKeys[0] = keys[0];
+      checkpointKeys[1] = keys[1];
+    } else {
+      // the newer checkpoint was not completed by every host
+      std::remove(checkpointFileName(keys[0]).c_str());
+      checkpointKeys[0] = keys[1];
+      checkpointKeys[1] = 0;
+    }
+    checkpointRestart = false;
+    round             = key & 0xffffffff;
+    TimerApplyCheckpoint.stop();
+
+    if (id == 0) {
+      galois::gInfo("Restarted run ", num_run, " from checkpointed round ",
+                    round);
+    }
+    return true;
+  }
 };
 
 template <typename GraphTy>
@@ -28,6 +28,10 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
 //! Enumeration of data communication modes that can be used in synchronization
 //! @todo document the enums in doxygen
 enum DataCommMode {
@@ -37,9 +41,31 @@ enum DataCommMode {
   gidsData,
   onlyData,
   dataSplitFirst, // NOT USED
-  dataSplit       // NOT USED
+  dataSplit,      // NOT USED
+  //! delta-varint offsets, optionally XOR-delta values (see DataCompression.h)
+  compressedOffsetsData
 };
 
+//! Name of a data communication mode for statistics
+inline const char* dataCommModeName(DataCommMode mode) {
+  switch (mode) {
+  case noData:
+    return "NoData";
+  case bitsetData:
+    return "Bitset";
+  case offsetsData:
+    return "Offsets";
+  case gidsData:
+    return "Gids";
+  case onlyData:
+    return "OnlyData";
+  case compressedOffsetsData:
+    return "CompressedOffsets";
+  default:
+    return "DataSplit";
+  }
+}
+
 //! If some mode is to be enforced, set this variable
 //! @todo using a global is not great, but current problem is that GPU code
 //! assumes variable and would take some reorg to fix
@@ -54,14 +80,25 @@ extern DataCommMode enforcedDataMode;
  *
  * @param num_selected number of elements to send out (subset of num_total)
  * @param num_total total number of elements that exist
+ * @param allowCompressed true if the caller can send compressedOffsetsData;
+ * if false, an enforced compressed mode falls back to offsetsData
  *
  * @returns an appropriate DataCommMode to use for synchronization
  */
 template <typename DataType>
-DataCommMode get_data_mode(size_t num_selected, size_t num_total) {
+DataCommMode get_data_mode(size_t num_selected, size_t num_total,
+                           bool allowCompressed = false) {
   DataCommMode data_mode = noData;
   if (enforcedDataMode != noData) {
     data_mode = enforcedDataMode;
+    if (data_mode == compressedOffsetsData && !allowCompressed) {
+      data_mode = offsetsData;
+    }
+    // an empty update is still sent as noData so that async termination
+    // does not see it as work (onlyData never computes num_selected)
+    if (num_selected == 0 && data_mode != onlyData) {
+      data_mode = noData;
+    }
   } else { // no enforced mode, so find an appropriate mode
     if (num_selected == 0) {
       data_mode = noData;
@@ -76,12 +113,25 @@ DataCommMode get_data_mode(size_t num_selected, size_t num_total) {
       size_t offsetsDataSize = (num_selected * sizeof(DataType)) +
                                (num_selected * sizeof(unsigned int)) +
                                sizeof(size_t) + sizeof(num_selected);
+      // compressed offsets cost roughly one varint of the average gap per
+      // element (value compression only ever shrinks this further)
+      size_t gap_bytes = 1;
+      for (size_t gap = num_total / num_selected; gap >= 0x80; gap >>= 7) {
+        ++gap_bytes;
+      }
+      size_t compressedDataSize = (num_selected * sizeof(DataType)) +
+                                  (num_selected * gap_bytes) +
+                                  (3 * sizeof(size_t)) + sizeof(uint8_t);
       // find the minimum size one
       if (bitsetDataSize < offsetsDataSize) {
         data_mode = bitsetData;
       } else {
         data_mode = offsetsData;
       }
+      if (allowCompressed &&
+          compressedDataSize < std::min(bitsetDataSize, offsetsDataSize)) {
+        data_mode = compressedOffsetsData;
+      }
     }
   }
   return data_mode;
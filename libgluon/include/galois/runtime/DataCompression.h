@@ -0,0 +1,224 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+/**
+ * @file DataCompression.h
+ *
+ * Encoders and decoders used by the compressedOffsetsData communication mode.
+ *
+ * Offsets are sorted and unique, so they are sent as LEB128 varints of the gap
+ * to the previous offset. Values of 4 or 8 byte arithmetic types can
+ * additionally be sent as varints of the XOR with the previous value, which
+ * is small when neighboring values share sign, exponent and high mantissa
+ * bits (e.g. PageRank residuals or BFS levels). Value compression is only
+ * used when it actually produces fewer bytes than the raw values.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "galois/config.h"
+#include "galois/PODResizeableArray.h"
+#include "galois/gIO.h"
+
+namespace galois {
+namespace runtime {
+
+namespace internal {
+
+inline void appendVarint(galois::PODResizeableArray<uint8_t>& out,
+                         uint64_t v) {
+  while (v >= 0x80) {
+    out.push_back(static_cast<uint8_t>(v) | 0x80);
+    v >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(v));
+}
+
+inline uint64_t readVarint(const uint8_t*& cur,
+                           const uint8_t* GALOIS_USED_ONLY_IN_DEBUG(end)) {
+  uint64_t v     = 0;
+  unsigned shift = 0;
+  while (true) {
+    assert(cur != end && shift < 64);
+    uint8_t byte = *cur++;
+    v |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80))
+      return v;
+    shift += 7;
+  }
+}
+
+template <size_t Size>
+struct BitsOf;
+template <>
+struct BitsOf<4> {
+  using type = uint32_t;
+};
+template <>
+struct BitsOf<8> {
+  using type = uint64_t;
+};
+
+} // namespace internal
+
+//! Number of bytes a varint encoding of v takes
+inline size_t varintSize(uint64_t v) {
+  size_t n = 1;
+  while (v >= 0x80) {
+    v >>= 7;
+    ++n;
+  }
+  return n;
+}
+
+/**
+ * Delta-varint encode the first count entries of a sorted offsets array.
+ *
+ * @param offsets strictly increasing offsets
+ * @param count number of offsets to encode
+ * @param out OUTPUT: encoded bytes (overwritten)
+ */
+template <typename OffsetVecTy>
+void encodeOffsets(const OffsetVecTy& offsets, size_t count,
+                   galois::PODResizeableArray<uint8_t>& out) {
+  out.clear();
+  out.reserve(count + (count >> 2));
+  uint64_t prev = 0;
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t cur = offsets[i];
+    assert(i == 0 || cur > prev);
+    // first gap is the offset itself; later gaps are at least 1
+    internal::appendVarint(out, (i == 0) ? cur : cur - prev - 1);
+    prev = cur;
+  }
+}
+
+/**
+ * Inverse of encodeOffsets.
+ *
+ * @param in encoded bytes
+ * @param count number of offsets that were encoded
+ * @param offsets OUTPUT: decoded offsets (resized to count)
+ */
+template <typename OffsetVecTy>
+void decodeOffsets(const galois::PODResizeableArray<uint8_t>& in, size_t count,
+                   OffsetVecTy& offsets) {
+  offsets.resize(count);
+  const uint8_t* cur = in.data();
+  const uint8_t* end = in.data() + in.size();
+  uint64_t prev      = 0;
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t gap = internal::readVarint(cur, end);
+    prev         = (i == 0) ? gap : prev + gap + 1;
+    offsets[i]   = prev;
+  }
+  GALOIS_ASSERT(cur == end, "trailing bytes in compressed offsets");
+}
+
+//! True if values of type T can be XOR-delta compressed
+template <typename VecTy>
+struct is_xor_compressible : std::false_type {};
+
+template <typename T>
+struct is_xor_compressible<galois::PODResizeableArray<T>>
+    : std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                       (sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+/**
+ * XOR-delta encode values. Gives up (returns false) as soon as the encoding
+ * is no smaller than the raw values, in which case the raw values should be
+ * sent instead.
+ *
+ * @param vals values to encode
+ * @param count number of values to encode
+ * @param out OUTPUT: encoded bytes (overwritten)
+ * @returns true if out holds an encoding smaller than the raw values
+ */
+template <typename VecTy,
+          typename std::enable_if<
+              is_xor_compressible<VecTy>::value>::type* = nullptr>
+bool encodeXorValues(const VecTy& vals, size_t count,
+                     galois::PODResizeableArray<uint8_t>& out) {
+  using T    = typename VecTy::value_type;
+  using Bits = typename internal::BitsOf<sizeof(T)>::type;
+
+  size_t rawSize = count * sizeof(T);
+  out.clear();
+  out.reserve(rawSize);
+  Bits prev = 0;
+  for (size_t i = 0; i < count; ++i) {
+    Bits cur;
+    std::memcpy(&cur, &vals[i], sizeof(T));
+    internal::appendVarint(out, cur ^ prev);
+    prev = cur;
+    if (out.size() >= rawSize)
+      return false;
+  }
+  return true;
+}
+
+template <typename VecTy,
+          typename std::enable_if<
+              !is_xor_compressible<VecTy>::value>::type* = nullptr>
+bool encodeXorValues(const VecTy&, size_t,
+                     galois::PODResizeableArray<uint8_t>&) {
+  return false;
+}
+
+/**
+ * Inverse of encodeXorValues.
+ *
+ * @param in encoded bytes
+ * @param count number of values that were encoded
+ * @param vals OUTPUT: decoded values (resized to count)
+ */
+template <typename VecTy,
+          typename std::enable_if<
+              is_xor_compressible<VecTy>::value>::type* = nullptr>
+void decodeXorValues(const galois::PODResizeableArray<uint8_t>& in,
+                     size_t count, VecTy& vals) {
+  using T    = typename VecTy::value_type;
+  using Bits = typename internal::BitsOf<sizeof(T)>::type;
+
+  vals.resize(count);
+  const uint8_t* cur = in.data();
+  const uint8_t* end = in.data() + in.size();
+  Bits prev          = 0;
+  for (size_t i = 0; i < count; ++i) {
+    prev ^= static_cast<Bits>(internal::readVarint(cur, end));
+    std::memcpy(&vals[i], &prev, sizeof(T));
+  }
+  GALOIS_ASSERT(cur == end, "trailing bytes in compressed values");
+}
+
+template <typename VecTy,
+          typename std::enable_if<
+              !is_xor_compressible<VecTy>::value>::type* = nullptr>
+void decodeXorValues(const galois::PODResizeableArray<uint8_t>&, size_t,
+                     VecTy&) {
+  GALOIS_DIE("received compressed values for an incompressible type");
+}
+
+} // namespace runtime
+} // namespace galois
@@ -5,6 +5,7 @@
 #include "pangolin/quick_pattern.h"
 #include "pangolin/canonical_graph.h"
 #include "pangolin/BfsMining/embedding_list.h"
+#include "galois/VectorReduction.h"
 
 template <typename ElementTy, typename EmbeddingTy, typename API,
           bool enable_dag = false, bool is_single = true,
@@ -24,15 +25,13 @@ public:
   void set_num_patterns(int np = 1) {
     npatterns = np;
     accumulators.resize(npatterns);
-    for (int i = 0; i < npatterns; i++)
-      accumulators[i].reset();
     if (!is_single)
       for (auto i = 0; i < this->num_threads; i++)
         qp_localmaps.getLocal(i)->clear();
   }
   void clean() {
     is_wedge.clear();
-    accumulators.clear();
+    accumulators.resize(0);
     qp_map.clear();
     cg_map.clear();
     for (auto i = 0; i < this->num_threads; i++)
@@ -121,7 +120,7 @@ public:
       galois::on_each([&](unsigned tid, unsigned) {
         auto& local_counters = *(counters.getLocal(tid));
         for (int i = 0; i < this->npatterns; i++)
-          this->accumulators[i] += local_counters[i];
+          this->accumulators.update(i, local_counters[i]);
       });
       return;
     }
@@ -203,7 +202,7 @@ public:
       galois::on_each([&](unsigned tid, unsigned) {
         auto& local_counters = *(counters.getLocal(tid));
         for (int i = 0; i < this->npatterns; i++)
-          this->accumulators[0] += local_counters[0];
+          this->accumulators.update(0, local_counters[0]);
       });
       return;
     }
@@ -275,7 +274,7 @@ public:
       galois::on_each([&](unsigned tid, unsigned) {
         auto& local_counters = *(counters.getLocal(tid));
         for (int i = 0; i < this->npatterns; i++)
-          this->accumulators[0] += local_counters[0];
+          this->accumulators.update(0, local_counters[0]);
       });
       return;
     }
@@ -342,7 +341,7 @@ public:
                   if (level < this->max_size - 2)
                     num_new_emb[pos - begin]++;
                   else
-                    accumulators[0] += 1;
+                    accumulators.update(0, 1);
                 }
               }
               break;
@@ -443,20 +442,20 @@ public:
   }
 
   // Utilities
-  Ulong get_total_count() { return accumulators[0].reduce(); }
+  Ulong get_total_count() { return accumulators.reduce()[0]; }
   void printout_motifs() {
     std::cout << std::endl;
+    const std::vector<Ulong>& counts = accumulators.reduce();
     if (accumulators.size() == 2) {
-      std::cout << "\ttriangles " << accumulators[0].reduce() << std::endl;
-      std::cout << "\twedges    " << accumulators[1].reduce() << std::endl;
+      std::cout << "\ttriangles " << counts[0] << std::endl;
+      std::cout << "\twedges    " << counts[1] << std::endl;
     } else if (accumulators.size() == 6) {
-      std::cout << "\t4-paths --> " << accumulators[0].reduce() << std::endl;
-      std::cout << "\t3-stars --> " << accumulators[1].reduce() << std::endl;
-      std::cout << "\t4-cycles --> " << accumulators[2].reduce() << std::endl;
-      std::cout << "\ttailed-triangles --> " << accumulators[3].reduce()
-                << std::endl;
-      std::cout << "\tdiamonds --> " << accumulators[4].reduce() << std::endl;
-      std::cout << "\t4-cliques --> " << accumulators[5].reduce() << std::endl;
+      std::cout << "\t4-paths --> " << counts[0] << std::endl;
+      std::cout << "\t3-stars --> " << counts[1] << std::endl;
+      std::cout << "\t4-cycles --> " << counts[2] << std::endl;
+      std::cout << "\ttailed-triangles --> " << counts[3] << std::endl;
+      std::cout << "\tdiamonds --> " << counts[4] << std::endl;
+      std::cout << "\t4-cliques --> " << counts[5] << std::endl;
     } else {
       if (this->max_size < 9) {
         std::cout << std::endl;
@@ -476,7 +475,7 @@ public:
         [&](const GNode& src) {
           for (auto e : this->graph.edges(src)) {
             auto dst = this->graph.getEdgeDst(e);
-            accumulators[0] += this->intersect(src, dst);
+            accumulators.update(0, this->intersect(src, dst));
           }
         },
         galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
@@ -490,7 +489,7 @@ public:
           auto src = this->emb_list.get_idx(1, id);
           auto dst = this->emb_list.get_vid(1, id);
           auto num = this->intersect_dag(src, dst);
-          accumulators[0] += num;
+          accumulators.update(0, num);
         },
         galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
         galois::loopname("TC"));
@@ -558,7 +557,7 @@ private:
 protected:
   int npatterns;
   galois::substrate::PerThreadStorage<std::vector<Ulong>> counters;
-  std::vector<UlongAccu> accumulators;
+  galois::GVectorAccumulator<Ulong> accumulators;
   EmbeddingListTy emb_list;
 
   inline unsigned find_motif_pattern_id(unsigned n, unsigned idx, VertexId dst,
@@ -3,6 +3,7 @@
 #include "pangolin/scan.h"
 #include "pangolin/util.h"
 #include "pangolin/embedding_queue.h"
+#include "galois/SetIntersect.h"
 #include "bliss/uintseqhash.hh"
 #define CHUNK_SIZE 1
 
@@ -187,44 +188,19 @@ protected:
   unsigned get_degree(PangolinGraph* g, VertexId vid) {
     return std::distance(g->edge_begin(vid), g->edge_end(vid));
   }
+  // neighbor lists are sorted, so both go through galois::intersectCount,
+  // which picks a SIMD merge or galloping search per pair
   inline unsigned intersect_merge(unsigned src, unsigned dst) {
-    unsigned count = 0;
-    for (auto e : graph.edges(dst)) {
-      GNode dst_dst = graph.getEdgeDst(e);
-      for (auto e1 : graph.edges(src)) {
-        GNode to = graph.getEdgeDst(e1);
-        if (dst_dst == to) {
-          count += 1;
-          break;
-        }
-        if (to > dst_dst)
-          break;
-      }
-    }
-    return count;
+    const uint32_t* dsts = graph.edgeDstArray();
+    auto src_begin       = *graph.edge_begin(src);
+    auto dst_begin       = *graph.edge_begin(dst);
+    return galois::intersectCount(dsts + src_begin,
+                                  *graph.edge_end(src) - src_begin,
+                                  dsts + dst_begin,
+                                  *graph.edge_end(dst) - dst_begin);
   }
   inline unsigned intersect_dag_merge(unsigned p, unsigned q) {
-    unsigned count = 0;
-    auto p_start   = graph.edge_begin(p);
-    auto p_end     = graph.edge_end(p);
-    auto q_start   = graph.edge_begin(q);
-    auto q_end     = graph.edge_end(q);
-    auto p_it      = p_start;
-    auto q_it      = q_start;
-    int a;
-    int b;
-    while (p_it < p_end && q_it < q_end) {
-      a     = graph.getEdgeDst(p_it);
-      b     = graph.getEdgeDst(q_it);
-      int d = a - b;
-      if (d <= 0)
-        p_it++;
-      if (d >= 0)
-        q_it++;
-      if (d == 0)
-        count++;
-    }
-    return count;
+    return intersect_merge(p, q);
   }
   inline unsigned intersect_search(unsigned a, unsigned b) {
     if (degrees[a] == 0 || degrees[b] == 0)
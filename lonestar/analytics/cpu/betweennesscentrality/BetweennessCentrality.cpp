@@ -20,14 +20,16 @@
 #include "Lonestar/BoilerPlate.h"
 #include "llvm/Support/CommandLine.h"
 #include "Lonestar/Utils.h"
+#include "Lonestar/MultiSourceBFS.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 
 constexpr static const char* const REGION_NAME = "BC";
 
-enum Algo { Level = 0, Async, Outer, AutoAlgo };
+enum Algo { Level = 0, Async, Outer, MultiSource, AutoAlgo };
 
-const char* const ALGO_NAMES[] = {"Level", "Async", "Outer", "Auto"};
+const char* const ALGO_NAMES[] = {"Level", "Async", "Outer", "MultiSource",
+                                  "Auto"};
 
 const uint32_t infinity = std::numeric_limits<uint32_t>::max() / 4;
 
@@ -72,10 +74,17 @@ static cll::opt<bool>
     output("output", cll::desc("Output BC (Level/Async) (default: false)"),
            cll::init(false));
 
+static cll::opt<unsigned int>
+    msbfsWidth("msbfsWidth",
+               cll::desc("MultiSource: sources per batch, 64 or 256 (default "
+                         "256 if built for AVX2, else 64)"),
+               cll::init(MSBFS_DEFAULT_WIDTH));
+
 static cll::opt<Algo> algo(
     "algo", cll::desc("Choose an algorithm (default value AutoAlgo):"),
     cll::values(clEnumVal(Level, "Level"), clEnumVal(Async, "Async"),
                 clEnumVal(Outer, "Outer"),
+                clEnumVal(MultiSource, "MultiSource"),
                 clEnumVal(AutoAlgo,
                           "Auto: choose among the algorithms automatically")),
     cll::init(AutoAlgo));
@@ -96,6 +105,7 @@ static const char* desc = "Computes betwenness centrality in an unweighted "
 #include "LevelStructs.h"
 #include "AsyncStructs.h"
 #include "OuterStructs.h"
+#include "MultiSourceStructs.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -137,6 +147,11 @@ int main(int argc, char** argv) {
     galois::gInfo("Running outer BC");
     doOuterBC();
     break;
+  case MultiSource:
+    // see MultiSourceStructs.h
+    galois::gInfo("Running multi-source BC");
+    doMultiSourceBC();
+    break;
   default:
     GALOIS_DIE("Unknown BC algorithm type");
   }
@@ -0,0 +1,242 @@
+#ifndef GALOIS_BC_MULTISOURCE
+#define GALOIS_BC_MULTISOURCE
+
+#include "galois/AtomicHelpers.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "galois/graphs/LCGraph.h"
+#include "Lonestar/MultiSourceBFS.h"
+
+#include <atomic>
+#include <fstream>
+#include <iterator>
+
+////////////////////////////////////////////////////////////////////////////////
+
+using MSGraph = galois::graphs::LC_CSR_Graph<void, void>::with_no_lockable<
+    true>::type::with_numa_alloc<true>::type;
+using MSGNode = MSGraph::GraphNode;
+
+/**
+ * Brandes BC over batches of WIDTH sources. The forward phase is a
+ * multi-source BFS that accumulates per-source shortest path counts as lanes
+ * move along edges; the backward phase walks the BFS levels bottom up and
+ * pulls dependencies from successors, all sources of a node at once.
+ *
+ * Memory is about 12 * WIDTH bytes per node (path counts and dependencies
+ * for every lane).
+ */
+template <unsigned WIDTH>
+class MultiSourceBC {
+  using BFS  = MultiSourceBFS<MSGraph, WIDTH>;
+  using Mask = typename BFS::Mask;
+
+  MSGraph& graph;
+  BFS bfs;
+  //! shortest path counts, WIDTH per node
+  galois::LargeArray<std::atomic<double>> sigma;
+  //! dependencies, WIDTH per node
+  galois::LargeArray<float> delta;
+  //! lanes that reached a node at the level below the one being processed
+  galois::LargeArray<Mask> succLanes;
+  galois::LargeArray<float> bc;
+  uint32_t maxDepth = 0;
+
+  size_t idx(MSGNode n, unsigned lane) const {
+    return size_t(n) * WIDTH + lane;
+  }
+
+public:
+  explicit MultiSourceBC(MSGraph& g) : graph(g), bfs(g) {
+    sigma.allocateInterleaved(graph.size() * WIDTH);
+    delta.allocateInterleaved(graph.size() * WIDTH);
+    succLanes.allocateInterleaved(graph.size());
+    bc.allocateInterleaved(graph.size());
+    galois::do_all(
+        galois::iterate(graph),
+        [&](MSGNode n) {
+          for (unsigned s = 0; s < WIDTH; ++s) {
+            sigma[idx(n, s)] = 0;
+            delta[idx(n, s)] = 0;
+          }
+          succLanes[n].clear();
+          bc[n] = 0;
+        },
+        galois::no_stats(), galois::loopname("InitializeGraph"));
+  }
+
+  //! Adds the BC contributions of up to WIDTH sources
+  void runBatch(const MSGNode* sources, unsigned num) {
+    for (unsigned s = 0; s < num; ++s) {
+      sigma[idx(sources[s], s)] = 1;
+    }
+
+    // forward: lanes reaching v through u add u's path counts to v's
+    bfs.run(
+        sources, num,
+        [&](MSGNode u, MSGNode v, const Mask& lanes) {
+          lanes.forEach([&](unsigned s) {
+            galois::atomicAdd(
+                sigma[idx(v, s)],
+                sigma[idx(u, s)].load(std::memory_order_relaxed));
+          });
+        },
+        [](MSGNode, uint32_t, const Mask&) {});
+    maxDepth = std::max(maxDepth, bfs.depth());
+
+    // backward: level 0 holds the sources themselves and is skipped
+    auto& levels = bfs.levels();
+    for (size_t level = levels.size() - 1; level > 0; --level) {
+      if (level + 1 < levels.size()) {
+        galois::do_all(
+            galois::iterate(levels[level + 1]),
+            [&](const typename BFS::Visit& x) { succLanes[x.node] = x.lanes; },
+            galois::no_stats(), galois::loopname("ExposeSuccessors"));
+      }
+
+      galois::do_all(
+          galois::iterate(levels[level]),
+          [&](const typename BFS::Visit& x) {
+            MSGNode n = x.node;
+            x.lanes.forEach([&](unsigned s) { delta[idx(n, s)] = 0; });
+            for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+              MSGNode dst = graph.getEdgeDst(e);
+              Mask succ   = x.lanes & succLanes[dst];
+              succ.forEach([&](unsigned s) {
+                delta[idx(n, s)] +=
+                    (1.0f + delta[idx(dst, s)]) /
+                    sigma[idx(dst, s)].load(std::memory_order_relaxed);
+              });
+            }
+            float sum = 0;
+            x.lanes.forEach([&](unsigned s) {
+              delta[idx(n, s)] *=
+                  sigma[idx(n, s)].load(std::memory_order_relaxed);
+              sum += delta[idx(n, s)];
+            });
+            bc[n] += sum;
+          },
+          galois::steal(), galois::chunk_size<64>(), galois::no_stats(),
+          galois::loopname("Brandes"));
+
+      if (level + 1 < levels.size()) {
+        galois::do_all(
+            galois::iterate(levels[level + 1]),
+            [&](const typename BFS::Visit& x) { succLanes[x.node].clear(); },
+            galois::no_stats(), galois::loopname("ClearSuccessors"));
+      }
+    }
+
+    // path counts are accumulated, so clear the ones this batch touched
+    for (auto& l : levels) {
+      galois::do_all(
+          galois::iterate(l),
+          [&](const typename BFS::Visit& x) {
+            x.lanes.forEach([&](unsigned s) { sigma[idx(x.node, s)] = 0; });
+          },
+          galois::no_stats(), galois::loopname("ResetPathCounts"));
+    }
+  }
+
+  float getBC(MSGNode n) const { return bc[n]; }
+
+  //! Largest distance from any source seen so far: a lower bound on the
+  //! diameter
+  uint32_t eccentricityBound() const { return maxDepth; }
+};
+
+/**
+ * Get some sanity numbers (max, min, sum of BC)
+ */
+template <unsigned WIDTH>
+void MultiSourceSanity(MSGraph& graph, MultiSourceBC<WIDTH>& bc) {
+  galois::GReduceMax<float> accumMax;
+  galois::GReduceMin<float> accumMin;
+  galois::GAccumulator<float> accumSum;
+
+  galois::do_all(
+      galois::iterate(graph),
+      [&](MSGNode n) {
+        accumMax.update(bc.getBC(n));
+        accumMin.update(bc.getBC(n));
+        accumSum += bc.getBC(n);
+      },
+      galois::no_stats(), galois::loopname("MultiSourceSanity"));
+
+  galois::gPrint("Max BC is ", accumMax.reduce(), "\n");
+  galois::gPrint("Min BC is ", accumMin.reduce(), "\n");
+  galois::gPrint("BC sum is ", accumSum.reduce(), "\n");
+  galois::gPrint("Max source eccentricity is ", bc.eccentricityBound(), "\n");
+}
+
+template <unsigned WIDTH>
+void runMultiSourceBC(MSGraph& graph, const std::vector<MSGNode>& sources) {
+  galois::gInfo("Running batches of ", WIDTH, " sources");
+  galois::runtime::reportStat_Single(REGION_NAME, "BatchWidth", WIDTH);
+
+  MultiSourceBC<WIDTH> bc(graph);
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  for (size_t i = 0; i < sources.size(); i += WIDTH) {
+    unsigned num = std::min(size_t{WIDTH}, sources.size() - i);
+    bc.runBatch(&sources[i], num);
+  }
+  execTime.stop();
+
+  galois::reportPageAlloc("MemAllocPost");
+
+  MultiSourceSanity(graph, bc);
+
+  if (output) {
+    char* v_out = (char*)malloc(40);
+    for (auto ii = graph.begin(); ii != graph.end(); ++ii) {
+      // outputs betweenness centrality
+      sprintf(v_out, "%u %.9f\n", (*ii), bc.getBC(*ii));
+      galois::gPrint(v_out);
+    }
+    free(v_out);
+  }
+}
+
+void doMultiSourceBC() {
+  galois::reportPageAlloc("MemAllocPre");
+
+  galois::StatTimer graphConstructTimer("TimerConstructGraph", REGION_NAME);
+  graphConstructTimer.start();
+  MSGraph graph;
+  galois::graphs::readGraph(graph, inputFile);
+  graphConstructTimer.stop();
+  galois::gInfo("Graph construction complete");
+
+  // same source selection as Level BC
+  std::vector<MSGNode> sources;
+  if (singleSourceBC) {
+    sources.push_back(startSource);
+  } else if (sourcesToUse != "") {
+    std::ifstream sourceFile(sourcesToUse);
+    sources.assign(std::istream_iterator<uint64_t>{sourceFile},
+                   std::istream_iterator<uint64_t>{});
+    if (numOfSources && numOfSources < sources.size()) {
+      sources.resize(numOfSources);
+    }
+  } else {
+    size_t end = numOfSources ? std::min<size_t>(numOfSources, graph.size())
+                              : graph.size();
+    for (size_t i = 0; i < end; ++i) {
+      sources.push_back(i);
+    }
+  }
+
+  switch (msbfsWidth) {
+  case 64:
+    runMultiSourceBC<64>(graph, sources);
+    break;
+  case 256:
+    runMultiSourceBC<256>(graph, sources);
+    break;
+  default:
+    GALOIS_DIE("-msbfsWidth must be 64 or 256");
+  }
+}
+#endif
@@ -245,8 +245,9 @@ template <bool CONCURRENT, typename T, typename P, typename R>
 void syncAlgo(Graph& graph, GNode source, const P& pushWrap,
               const R& edgeRange) {
 
-  using Cont = typename std::conditional<CONCURRENT, galois::InsertBag<T>,
-                                         galois::SerStack<T>>::type;
+  using Cont =
+      typename std::conditional<CONCURRENT, galois::IndexedInsertBag<T>,
+                                galois::SerStack<T>>::type;
   using Loop = typename std::conditional<CONCURRENT, galois::DoAll,
                                          galois::StdForEach>::type;
 
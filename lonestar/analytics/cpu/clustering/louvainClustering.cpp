@@ -27,6 +27,7 @@
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/TypeTraits.h"
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/GraphColoring.h"
 
 #include "llvm/Support/CommandLine.h"
 
@@ -72,7 +73,6 @@ struct Node {
   uint64_t prev_comm_ass;
   uint64_t curr_comm_ass;
   EdgeTy degree_wt;
-  int64_t colorId;
 };
 
 using Graph = galois::graphs::LC_CSR_Graph<Node, EdgeTy>::with_no_lockable<
@@ -235,7 +235,6 @@ double algoLouvainWithoutLockingDoAll(Graph& graph, double lower,
   galois::do_all(galois::iterate(graph), [&graph](GNode n) {
     graph.getData(n).curr_comm_ass = n;
     graph.getData(n).prev_comm_ass = n;
-    graph.getData(n).colorId       = -1;
   });
 
   galois::gPrint("Init Done\n");
@@ -366,7 +365,6 @@ double algoLouvainWithLockingDelayUpdate(Graph& graph, double lower,
   galois::do_all(galois::iterate(graph), [&graph](GNode n) {
     graph.getData(n).curr_comm_ass = n;
     graph.getData(n).prev_comm_ass = n;
-    graph.getData(n).colorId       = -1;
   });
 
   galois::gPrint("Init Done\n");
@@ -481,88 +479,6 @@ double algoLouvainWithLockingDelayUpdate(Graph& graph, double lower,
   return prev_mod;
 }
 
-uint64_t coloringDistanceOne(Graph& graph) {
-  galois::for_each(
-      galois::iterate(graph),
-      [&](GNode n, auto&) {
-        auto& n_data = graph.getData(n, flag_write_lock);
-
-        /* Grab lock on neighbours: Cautious operator */
-        for (auto ii = graph.edge_begin(n, flag_write_lock);
-             ii != graph.edge_end(n, flag_write_lock); ++ii) {
-          graph.getData(graph.getEdgeDst(ii),
-                        flag_write_lock); // TODO: Can we use read lock?
-        }
-
-        int64_t max_color = -1;
-        int64_t my_color  = 0;
-        int64_t degree = std::distance(graph.edge_begin(n), graph.edge_end(n));
-        if (degree > 0) {
-          std::vector<bool> isColorSet;
-          isColorSet.resize(degree, false);
-          for (auto ii = graph.edge_begin(n, flag_write_lock);
-               ii != graph.edge_end(n, flag_write_lock); ++ii) {
-            auto dst = graph.getEdgeDst(ii);
-            if (dst == n)
-              continue;
-
-            auto& dst_data = graph.getData(
-                dst, flag_write_lock); // TODO: Can we use read lock?
-            if (dst_data.colorId >= 0) {
-              if (dst_data.colorId >= degree)
-                isColorSet.resize(dst_data.colorId);
-
-              isColorSet[dst_data.colorId] = true;
-              if ((dst_data.colorId > max_color)) {
-                max_color = dst_data.colorId;
-              }
-            }
-          }
-
-          if (max_color >= 0) {
-            /* Assign color */
-            for (; my_color <= max_color; my_color++) {
-              if (isColorSet[my_color] == false) {
-                break;
-              }
-            }
-
-            if (my_color == max_color)
-              my_color++;
-          }
-        }
-        n_data.colorId = my_color;
-      },
-      galois::loopname("Coloring loop"));
-
-  galois::gPrint("Checking for conflicts\n");
-  /* Check for conflicts */
-  galois::GAccumulator<uint64_t> conflicts;
-  galois::do_all(
-      galois::iterate(graph),
-      [&](GNode n) {
-        auto& n_data = graph.getData(n, flag_no_lock);
-        for (auto ii = graph.edge_begin(n, flag_write_lock);
-             ii != graph.edge_end(n, flag_write_lock); ++ii) {
-          auto dst       = graph.getEdgeDst(ii);
-          auto& dst_data = graph.getData(dst, flag_no_lock);
-          if (dst_data.colorId == n_data.colorId)
-            conflicts += 1;
-        }
-      },
-      galois::loopname("Coloring conflicts"));
-  galois::gPrint("WARNING: Conflicts found : ", conflicts.reduce(), "\n");
-
-  int64_t num_colors = 0;
-  for (GNode n = 0; n < graph.size(); ++n) {
-    int64_t color = graph.getData(n, flag_no_lock).colorId;
-    if (color > num_colors)
-      num_colors = color;
-  }
-
-  return num_colors;
-}
-
 double algoLouvainWithColoring(Graph& graph, double lower, double threshold,
                                uint32_t& iter) {
 
@@ -589,14 +505,15 @@ double algoLouvainWithColoring(Graph& graph, double lower, double threshold,
   galois::do_all(galois::iterate(graph), [&graph](GNode n) {
     graph.getData(n).curr_comm_ass = n;
     graph.getData(n).prev_comm_ass = n;
-    graph.getData(n).colorId       = -1;
   });
 
   galois::gPrint("Coloring\n");
   galois::StatTimer TimerColoring("Timer_Cloring");
   TimerColoring.start();
-  int64_t num_colors = coloringDistanceOne(graph);
+  GraphColoring<Graph> colors(graph);
+  colors.jonesPlassmann(ColoringOrder::LargestDegreeFirst);
   TimerColoring.stop();
+  galois::gPrint("Number of colors: ", colors.numColors(), "\n");
 
   /* Calculate the weighted degree sum for each vertex */
   sumVertexDegreeWeight(graph, c_info);
@@ -624,47 +541,45 @@ double algoLouvainWithColoring(Graph& graph, double lower, double threshold,
   while (true) {
     num_iter++;
 
-    for (int64_t c = 0; c < num_colors; ++c) {
+    for (uint32_t c = 0; c < colors.numColors(); ++c) {
       // galois::gPrint("Color : ", c, "\n");
       galois::do_all(
-          galois::iterate(graph),
+          galois::iterate(colors.bucketBegin(c), colors.bucketEnd(c)),
           [&](GNode n) {
             auto& n_data = graph.getData(n, flag_write_lock);
-            if (n_data.colorId == c) {
-              uint64_t degree = std::distance(graph.edge_begin(n, flag_no_lock),
-                                              graph.edge_end(n, flag_no_lock));
-              uint64_t local_target = UNASSIGNED;
-              std::map<uint64_t, uint64_t>
-                  cluster_local_map; // Map each neighbor's cluster to local
-                                     // number: Community --> Index
-              std::vector<EdgeTy>
-                  counter; // Number of edges to each unique cluster
-              EdgeTy self_loop_wt = 0;
-
-              if (degree > 0) {
-                findNeighboringClusters(graph, n, cluster_local_map, counter,
-                                        self_loop_wt);
-                // Find the max gain in modularity
-                local_target = maxModularity(
-                    cluster_local_map, counter, self_loop_wt, c_info,
-                    n_data.degree_wt, n_data.curr_comm_ass,
-                    constant_for_second_term);
-              } else {
-                local_target = UNASSIGNED;
-              }
-              /* Update cluster info */
-              if (local_target != n_data.curr_comm_ass &&
-                  local_target != UNASSIGNED) {
-                galois::atomicAdd(c_update[local_target].degree_wt,
-                                  n_data.degree_wt);
-                galois::atomicAdd(c_update[local_target].size, (uint64_t)1);
-                galois::atomicSubtract(c_update[n_data.curr_comm_ass].degree_wt,
-                                       n_data.degree_wt);
-                galois::atomicSubtract(c_update[n_data.curr_comm_ass].size,
-                                       (uint64_t)1);
-                /* Set the new cluster id */
-                n_data.curr_comm_ass = local_target;
-              }
+            uint64_t degree = std::distance(graph.edge_begin(n, flag_no_lock),
+                                            graph.edge_end(n, flag_no_lock));
+            uint64_t local_target = UNASSIGNED;
+            std::map<uint64_t, uint64_t>
+                cluster_local_map; // Map each neighbor's cluster to local
+                                   // number: Community --> Index
+            std::vector<EdgeTy>
+                counter; // Number of edges to each unique cluster
+            EdgeTy self_loop_wt = 0;
+
+            if (degree > 0) {
+              findNeighboringClusters(graph, n, cluster_local_map, counter,
+                                      self_loop_wt);
+              // Find the max gain in modularity
+              local_target = maxModularity(
+                  cluster_local_map, counter, self_loop_wt, c_info,
+                  n_data.degree_wt, n_data.curr_comm_ass,
+                  constant_for_second_term);
+            } else {
+              local_target = UNASSIGNED;
+            }
+            /* Update cluster info */
+            if (local_target != n_data.curr_comm_ass &&
+                local_target != UNASSIGNED) {
+              galois::atomicAdd(c_update[local_target].degree_wt,
+                                n_data.degree_wt);
+              galois::atomicAdd(c_update[local_target].size, (uint64_t)1);
+              galois::atomicSubtract(c_update[n_data.curr_comm_ass].degree_wt,
+                                     n_data.degree_wt);
+              galois::atomicSubtract(c_update[n_data.curr_comm_ass].size,
+                                     (uint64_t)1);
+              /* Set the new cluster id */
+              n_data.curr_comm_ass = local_target;
             }
           },
           galois::loopname("louvain algo: Phase 1"));
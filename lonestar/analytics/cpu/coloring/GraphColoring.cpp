@@ -0,0 +1,138 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "galois/Galois.h"
+#include "galois/Timer.h"
+#include "galois/graphs/LCGraph.h"
+#include "llvm/Support/CommandLine.h"
+#include "Lonestar/BoilerPlate.h"
+#include "Lonestar/GraphColoring.h"
+
+#include <fstream>
+#include <iostream>
+
+namespace cll = llvm::cl;
+
+static const char* name = "Graph Coloring";
+static const char* desc =
+    "Colors the nodes of a graph so that no two neighbors share a color";
+static const char* url = "graph_coloring";
+
+enum Algo { JPLargestDegreeFirst, JPSmallestLast, Speculative };
+
+static cll::opt<std::string>
+    inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
+static cll::opt<Algo> algo(
+    "algo", cll::desc("Choose an algorithm:"),
+    cll::values(clEnumVal(JPLargestDegreeFirst,
+                          "Jones-Plassmann, largest degree first (default)"),
+                clEnumVal(JPSmallestLast,
+                          "Jones-Plassmann, (approximate) smallest last"),
+                clEnumVal(Speculative,
+                          "Speculative coloring with conflict repair")),
+    cll::init(JPLargestDegreeFirst));
+static cll::opt<std::string>
+    outName("o", cll::desc("Output file for the color of every node"));
+
+using Graph = galois::graphs::LC_CSR_Graph<void, void>::with_no_lockable<
+    true>::type::with_numa_alloc<true>::type;
+using GNode = Graph::GraphNode;
+
+int main(int argc, char** argv) {
+  galois::SharedMemSys G;
+  LonestarStart(argc, argv, name, desc, url, &inputFile);
+
+  galois::StatTimer totalTime("TimerTotal");
+  totalTime.start();
+
+  if (!symmetricGraph) {
+    GALOIS_DIE("This application requires a symmetric graph input;"
+               " please use the -symmetricGraph flag "
+               " to indicate the input is a symmetric graph.");
+  }
+
+  Graph graph;
+  std::cout << "Reading from file: " << inputFile << "\n";
+  galois::graphs::readGraph(graph, inputFile);
+  std::cout << "Read " << graph.size() << " nodes, " << graph.sizeEdges()
+            << " edges\n";
+
+  GraphColoring<Graph> coloring(graph);
+
+  galois::preAlloc(galois::getActiveThreads() +
+                   2 * sizeof(GNode) * graph.size() /
+                       galois::runtime::pagePoolSize());
+  galois::reportPageAlloc("MeminfoPre");
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  switch (algo) {
+  case JPLargestDegreeFirst:
+    coloring.jonesPlassmann(ColoringOrder::LargestDegreeFirst);
+    break;
+  case JPSmallestLast:
+    coloring.jonesPlassmann(ColoringOrder::SmallestLast);
+    break;
+  case Speculative:
+    coloring.speculative();
+    break;
+  default:
+    std::cerr << "Unknown algorithm: " << algo << "\n";
+    abort();
+  }
+  execTime.stop();
+
+  galois::reportPageAlloc("MeminfoPost");
+
+  size_t largest = 0;
+  for (uint32_t c = 0; c < coloring.numColors(); ++c) {
+    largest = std::max(largest, coloring.bucketSize(c));
+  }
+  std::cout << "Number of colors: " << coloring.numColors() << "\n";
+  std::cout << "Largest color class: " << largest << "\n";
+  galois::runtime::reportStat_Single("GraphColoring", "NumColors",
+                                     coloring.numColors());
+  galois::runtime::reportStat_Single("GraphColoring", "Rounds",
+                                     coloring.getRounds());
+
+  if (!skipVerify) {
+    size_t conflicts = coloring.countConflicts();
+    if (conflicts) {
+      GALOIS_DIE("verification failed: ", conflicts, " conflicting edges");
+    }
+    size_t colored = 0;
+    for (uint32_t c = 0; c < coloring.numColors(); ++c) {
+      colored += coloring.bucketSize(c);
+    }
+    GALOIS_ASSERT(colored == graph.size(), "color buckets miss nodes");
+    std::cout << "Verification successful.\n";
+  }
+
+  if (!outName.empty()) {
+    std::ofstream out(outName);
+    for (GNode n : graph) {
+      out << n << " " << coloring.getColor(n) << "\n";
+    }
+    galois::gInfo("Colors written to ", outName);
+  }
+
+  totalTime.stop();
+
+  return 0;
+}
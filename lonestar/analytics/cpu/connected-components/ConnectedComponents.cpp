@@ -29,12 +29,14 @@
 #include "galois/graphs/TypeTraits.h"
 #include "galois/runtime/Profile.h"
 #include "Lonestar/BoilerPlate.h"
+#include "Lonestar/IncrementalCC.h"
 
 #include "llvm/Support/CommandLine.h"
 
 #include <utility>
 #include <vector>
 #include <algorithm>
+#include <numeric>
 #include <iostream>
 
 #include <ostream>
@@ -56,6 +58,7 @@ enum Algo {
   afforest,
   edgeafforest,
   edgetiledafforest,
+  incremental,
 };
 
 static cll::opt<std::string>
@@ -76,7 +79,10 @@ static cll::opt<Algo> algo(
         clEnumValN(Algo::edgeafforest, "EdgeAfforest",
                    "Using Afforest sampling, Edge-wise"),
         clEnumValN(Algo::edgetiledafforest, "EdgetiledAfforest",
-                   "Using Afforest sampling, EdgeTiled")
+                   "Using Afforest sampling, EdgeTiled"),
+        clEnumValN(Algo::incremental, "Incremental",
+                   "Afforest, then unions batches of new edges "
+                   "(see -edgeStream)")
 
             ),
     cll::init(Algo::edgetiledasync));
@@ -131,6 +137,22 @@ static cll::opt<uint32_t> COMPONENT_SAMPLES(
               "(default 1024)"),
     // cll::cat(ParamCat),
     cll::init(1024));
+static cll::opt<std::string>
+    edgeStream("edgeStream",
+               cll::desc("(For Incremental) .gr file whose edges are added "
+                         "to the input graph after the initial labeling"),
+               cll::init(""));
+static cll::opt<uint32_t>
+    streamPercent("streamPercent",
+                  cll::desc("(For Incremental) percentage of the input's "
+                            "edges that are left out of the initial labeling "
+                            "and added as a stream instead (default 0)"),
+                  cll::init(0));
+static cll::opt<uint32_t>
+    streamBatchSize("streamBatchSize",
+                    cll::desc("(For Incremental) number of edges per batch "
+                              "(default 65536)"),
+                    cll::init(65536));
 
 struct Node : public galois::UnionFindNode<Node> {
   using component_type = Node*;
@@ -1204,6 +1226,145 @@ void run() {
   }
 }
 
+//! Whether -streamPercent moves the input edge {u, v} to the stream; both
+//! directions of an edge get the same answer
+static bool heldBack(uint32_t u, uint32_t v) {
+  uint64_t x = (uint64_t(std::min(u, v)) << 32) | std::max(u, v);
+  x          = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x          = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return u != v && x % 100 < streamPercent;
+}
+
+/**
+ * Incremental CC: label the input graph, then add the edges of -edgeStream
+ * in batches of -streamBatchSize as if they arrived over time. With
+ * -streamPercent, that share of the input's edges is held back from the
+ * initial graph and streamed ahead of the -edgeStream edges.
+ */
+void runIncremental() {
+  using Graph = galois::graphs::LC_CSR_Graph<void, void>::with_no_lockable<
+      true>::type::with_numa_alloc<true>::type;
+  using GNode = Graph::GraphNode;
+  using CC    = IncrementalCC<Graph>;
+
+  Graph graph;
+  std::vector<CC::Edge> stream;
+  if (streamPercent) {
+    galois::graphs::FileGraph input;
+    input.fromFile(inputFile);
+    std::vector<uint64_t> ends(input.size());
+    galois::do_all(
+        galois::iterate(input),
+        [&](GNode src) {
+          for (auto e : input.edges(src)) {
+            if (!heldBack(src, input.getEdgeDst(e)))
+              ++ends[src];
+          }
+        },
+        galois::steal(), galois::loopname("IncCC-CountKept"));
+    std::partial_sum(ends.begin(), ends.end(), ends.begin());
+
+    graph.allocateFrom(input.size(), ends.empty() ? 0 : ends.back());
+    graph.constructNodes();
+    galois::do_all(
+        galois::iterate(input),
+        [&](GNode src) {
+          uint64_t next = src ? ends[src - 1] : 0;
+          for (auto e : input.edges(src)) {
+            GNode dst = input.getEdgeDst(e);
+            if (!heldBack(src, dst))
+              graph.constructEdge(next++, dst);
+          }
+          graph.fixEndEdge(src, ends[src]);
+        },
+        galois::steal(), galois::loopname("IncCC-BuildKept"));
+    graph.initializeLocalRanges();
+
+    for (GNode src : input) {
+      for (auto e : input.edges(src)) {
+        GNode dst = input.getEdgeDst(e);
+        if (src < dst && heldBack(src, dst))
+          stream.emplace_back(src, dst);
+      }
+    }
+  } else {
+    galois::graphs::readGraph(graph, inputFile);
+  }
+  std::cout << "Read " << graph.size() << " nodes\n";
+
+  if (!edgeStream.empty()) {
+    galois::graphs::FileGraph streamGraph;
+    streamGraph.fromFile(edgeStream);
+    if (streamGraph.size() > graph.size()) {
+      GALOIS_DIE("edge stream has more nodes than the input graph");
+    }
+    for (GNode src : streamGraph) {
+      for (auto e : streamGraph.edges(src)) {
+        GNode dst = streamGraph.getEdgeDst(e);
+        if (src != dst)
+          stream.emplace_back(src, dst);
+      }
+    }
+  }
+  std::cout << "Edge stream: " << stream.size() << " edges\n";
+  GALOIS_ASSERT(streamBatchSize > 0, "-streamBatchSize must be positive");
+
+  CC cc(graph);
+
+  galois::preAlloc(numThreads + (3 * graph.size() * sizeof(GNode)) /
+                                    galois::runtime::pagePoolSize());
+  galois::reportPageAlloc("MeminfoPre");
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  cc.initialize(NEIGHBOR_SAMPLES, COMPONENT_SAMPLES);
+  execTime.stop();
+  std::cout << "Initial components: " << cc.numComponents() << "\n";
+
+  galois::StatTimer streamTime("TimerStream");
+  size_t batches = 0;
+  size_t changed = 0;
+  streamTime.start();
+  for (size_t i = 0; i < stream.size(); i += streamBatchSize) {
+    auto end = stream.begin() + std::min(stream.size(), i + streamBatchSize);
+    std::vector<CC::Edge> batch(stream.begin() + i, end);
+    changed += cc.addEdges(batch).size();
+    ++batches;
+  }
+  streamTime.stop();
+
+  galois::reportPageAlloc("MeminfoPost");
+
+  std::cout << "Total components: " << cc.numComponents() << "\n";
+  galois::runtime::reportStat_Single("CC-Incremental", "Batches", batches);
+  galois::runtime::reportStat_Single("CC-Incremental", "ChangedComponents",
+                                     changed);
+  galois::runtime::reportStat_Single("CC-Incremental", "Compactions",
+                                     cc.numCompactions());
+
+  if (!skipVerify) {
+    galois::GAccumulator<size_t> roots;
+    auto is_bad = [&](GNode n) {
+      if (cc.component(n) == n)
+        roots += 1;
+      for (auto e : graph.edges(n)) {
+        if (!cc.sameComponent(n, graph.getEdgeDst(e)))
+          return true;
+      }
+      return false;
+    };
+    bool bad = galois::ParallelSTL::find_if(graph.begin(), graph.end(),
+                                            is_bad) != graph.end();
+    for (auto& e : stream) {
+      bad = bad || !cc.sameComponent(e.first, e.second);
+    }
+    if (bad || roots.reduce() != cc.numComponents()) {
+      GALOIS_DIE("verification failed");
+    }
+  }
+}
+
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
   LonestarStart(argc, argv, name, desc, nullptr, &inputFile);
@@ -1248,6 +1409,9 @@ int main(int argc, char** argv) {
   case Algo::edgetiledafforest:
     run<EdgeTiledAfforestAlgo>();
     break;
+  case Algo::incremental:
+    runIncremental();
+    break;
 
   default:
     std::cerr << "Unknown algorithm\n";
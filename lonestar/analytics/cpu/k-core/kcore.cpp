@@ -26,19 +26,23 @@
 
 #include "llvm/Support/CommandLine.h"
 
+#include <fstream>
+#include <limits>
+
 constexpr static const char* const REGION_NAME = "k-core";
 constexpr static const char* const name        = "k-core";
 constexpr static const char* const desc        = "Finds the k-core of a graph, "
                                           "defined as the subgraph where"
                                           " all vertices have degree at "
-                                          "least k.";
+                                          "least k, or the coreness of "
+                                          "every vertex.";
 
 /*******************************************************************************
  * Declaration of command line arguments
  ******************************************************************************/
 namespace cll = llvm::cl;
 
-enum Algo { Async = 0, Sync };
+enum Algo { Async = 0, Sync, Decompose };
 
 static cll::opt<std::string>
     inputFile(cll::Positional, cll::desc("<input file>"), cll::Required);
@@ -47,21 +51,39 @@ static cll::opt<std::string>
 static cll::opt<Algo> algo("algo",
                            cll::desc("Choose an algorithm (default Sync):"),
                            cll::values(clEnumVal(Async, "Asynchronous"),
-                                       clEnumVal(Sync, "Synchronous")),
+                                       clEnumVal(Sync, "Synchronous"),
+                                       clEnumVal(Decompose,
+                                                 "Coreness of every node")),
                            cll::init(Sync));
 
-//! Required k specification for k-core.
-static cll::opt<unsigned int> k_core_num("kcore", cll::desc("k-core value"),
-                                         cll::Required);
+//! k specification for k-core; required unless decomposing.
+static cll::opt<unsigned int>
+    k_core_num("kcore",
+               cll::desc("k-core value (Decompose: optional, also reports "
+                         "the size of this core)"),
+               cll::init(0));
+
+//! Remaining node count below which decomposition finishes sequentially.
+static cll::opt<unsigned int>
+    tailSize("tailSize",
+             cll::desc("Decompose: peel the last N nodes with a sequential "
+                       "histogram bucket sort (default 65536)"),
+             cll::init(65536));
+
+static cll::opt<std::string>
+    outName("o", cll::desc("Decompose: output file for the coreness of "
+                           "every node"));
 
 /*******************************************************************************
  * Graph structure declarations + other inits
  ******************************************************************************/
 
 //! Node deadness can be derived from current degree and k value, so no field
-//! necessary.
+//! necessary. The other fields are only used by Decompose.
 struct NodeData {
   std::atomic<uint32_t> currentDegree;
+  std::atomic<uint32_t> coreness;
+  std::atomic<uint32_t> movedRound;
 };
 
 //! Typedef for graph used, CSR graph (edge-type is void).
@@ -73,6 +95,11 @@ using GNode = Graph::GraphNode;
 //! Chunksize for for_each worklist: best chunksize will depend on input.
 constexpr static const unsigned CHUNK_SIZE = 64u;
 
+//! Coreness of a node that has not been peeled yet.
+constexpr static const uint32_t UNPEELED = std::numeric_limits<uint32_t>::max();
+//! Number of consecutive degree buckets materialized at a time.
+constexpr static const uint32_t OPEN_BUCKETS = 128u;
+
 /*******************************************************************************
  * Functions for running the algorithm
  ******************************************************************************/
@@ -189,6 +216,254 @@ void asyncCascadeKCore(Graph& graph,
       galois::loopname("AsyncCascadeDeadNodes"));
 }
 
+/**
+ * Claims a node for the current peeling round; the first caller wins.
+ */
+bool claimNode(NodeData& data, uint32_t k) {
+  uint32_t unpeeled = UNPEELED;
+  return data.coreness.compare_exchange_strong(unpeeled, k);
+}
+
+/**
+ * Degree buckets in the style of Julienne: OPEN_BUCKETS consecutive degree
+ * values starting at base each have a bag, and everything above goes into a
+ * single overflow bag. Nodes are inserted again whenever their degree drops
+ * rather than being removed from their old bucket, so a bucket may hold stale
+ * entries; those are filtered out when the bucket is popped.
+ */
+class DegreeBuckets {
+  std::vector<galois::InsertBag<GNode>> open;
+  galois::InsertBag<GNode> overflow;
+  uint32_t base = 0;
+
+public:
+  DegreeBuckets() : open(OPEN_BUCKETS) {}
+
+  void insert(GNode n, uint32_t degree) {
+    if (degree - base < OPEN_BUCKETS) {
+      open[degree - base].push(n);
+    } else {
+      overflow.push(n);
+    }
+  }
+
+  /**
+   * Moves the unpeeled nodes of the first non-empty bucket at or above k into
+   * frontier and returns that bucket's degree. Once the window is used up,
+   * it is moved to start at the smallest degree in the overflow bag.
+   */
+  uint32_t popMin(Graph& graph, uint32_t k,
+                  galois::InsertBag<GNode>& frontier) {
+    while (true) {
+      for (; k - base < OPEN_BUCKETS; ++k) {
+        galois::InsertBag<GNode>& bucket = open[k - base];
+        if (bucket.empty()) {
+          continue;
+        }
+        galois::do_all(
+            galois::iterate(bucket),
+            [&](GNode n) {
+              NodeData& data = graph.getData(n);
+              if (data.currentDegree == k && claimNode(data, k)) {
+                frontier.push(n);
+              }
+            },
+            galois::no_stats(), galois::loopname("PopBucket"));
+        bucket.clear();
+        if (!frontier.empty()) {
+          return k;
+        }
+      }
+
+      galois::GReduceMin<uint32_t> minDegree;
+      galois::do_all(
+          galois::iterate(overflow),
+          [&](GNode n) {
+            NodeData& data = graph.getData(n);
+            if (data.coreness == UNPEELED) {
+              minDegree.update(data.currentDegree);
+            }
+          },
+          galois::no_stats(), galois::loopname("OverflowMin"));
+      GALOIS_ASSERT(minDegree.reduce() != UNPEELED, "no nodes left to peel");
+
+      base = k = minDegree.reduce();
+      galois::InsertBag<GNode> old;
+      std::swap(old, overflow);
+      galois::do_all(
+          galois::iterate(old),
+          [&](GNode n) {
+            NodeData& data = graph.getData(n);
+            if (data.coreness == UNPEELED) {
+              insert(n, data.currentDegree);
+            }
+          },
+          galois::no_stats(), galois::loopname("RedistributeOverflow"));
+    }
+  }
+};
+
+/**
+ * Sequential peeling of the remaining nodes with the bucket sort of Batagelj
+ * and Zaversnik: nodes are kept sorted by degree in one array with the start
+ * of every degree's bin, so moving a node to the next lower bin is a swap.
+ * Used for the tail of the decomposition, where rounds of the parallel
+ * peeling would only peel a handful of nodes each.
+ *
+ * @param graph Graph to operate on
+ * @param k current coreness; all remaining nodes have degree at least k
+ */
+void histogramPeelTail(Graph& graph, uint32_t k) {
+  galois::InsertBag<GNode> remaining;
+  galois::GReduceMax<uint32_t> maxDegree;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        NodeData& data = graph.getData(n);
+        if (data.coreness == UNPEELED) {
+          remaining.push(n);
+          maxDegree.update(data.currentDegree);
+        }
+      },
+      galois::no_stats(), galois::loopname("CollectTail"));
+  if (remaining.empty()) {
+    return;
+  }
+
+  // histogram of degrees, then prefix sum for the start of each bin
+  std::vector<GNode> vert(remaining.begin(), remaining.end());
+  std::vector<uint32_t> binStart(maxDegree.reduce() - k + 2, 0);
+  for (GNode n : vert) {
+    binStart[graph.getData(n).currentDegree - k + 1]++;
+  }
+  for (size_t d = 1; d < binStart.size(); ++d) {
+    binStart[d] += binStart[d - 1];
+  }
+  std::vector<uint32_t> fill(binStart.begin(), binStart.end() - 1);
+  std::vector<uint32_t> pos(graph.size());
+  std::vector<GNode> sorted(vert.size());
+  for (GNode n : vert) {
+    uint32_t p = fill[graph.getData(n).currentDegree - k]++;
+    sorted[p]  = n;
+    pos[n]     = p;
+  }
+
+  for (size_t i = 0; i < sorted.size(); ++i) {
+    GNode v        = sorted[i];
+    uint32_t coreV = graph.getData(v).currentDegree;
+    graph.getData(v).coreness = coreV;
+    for (auto e : graph.edges(v)) {
+      GNode u         = graph.getEdgeDst(e);
+      NodeData& uData = graph.getData(u);
+      uint32_t du     = uData.currentDegree;
+      if (uData.coreness != UNPEELED || du <= coreV) {
+        continue;
+      }
+      // swap u with the first node of its bin, then shrink the bin by one
+      uint32_t pu    = pos[u];
+      uint32_t pw    = binStart[du - k];
+      GNode w        = sorted[pw];
+      sorted[pu]     = w;
+      pos[w]         = pu;
+      sorted[pw]     = u;
+      pos[u]         = pw;
+      binStart[du - k]++;
+      uData.currentDegree = du - 1;
+    }
+  }
+}
+
+/**
+ * Computes the coreness of every node. Peels the nodes of the lowest
+ * non-empty degree bucket k in rounds: a peeled node decrements the degree
+ * of its unpeeled neighbors, but never below k, and neighbors that reach k
+ * are peeled in the next round. Neighbors whose degree dropped are inserted
+ * into their new bucket once per round.
+ *
+ * @param graph Graph to operate on; currentDegree must hold the degrees
+ */
+void decomposeKCore(Graph& graph) {
+  DegreeBuckets buckets;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](GNode n) {
+        NodeData& data = graph.getData(n);
+        data.coreness  = UNPEELED;
+        data.movedRound = 0;
+        buckets.insert(n, data.currentDegree);
+      },
+      galois::no_stats(), galois::loopname("InitializeBuckets"));
+
+  size_t remaining = graph.size();
+  uint32_t k       = 0;
+  uint32_t round   = 0;
+  galois::InsertBag<GNode> frontier;
+  galois::InsertBag<GNode> next;
+  galois::InsertBag<GNode> moved;
+  galois::GAccumulator<size_t> peeled;
+
+  while (remaining > tailSize && remaining > 0) {
+    k = buckets.popMin(graph, k, frontier);
+
+    while (!frontier.empty()) {
+      ++round;
+      peeled.reset();
+      galois::do_all(
+          galois::iterate(frontier),
+          [&](GNode n) {
+            peeled += 1;
+            for (auto e : graph.edges(n)) {
+              GNode dest         = graph.getEdgeDst(e);
+              NodeData& destData = graph.getData(dest);
+              if (destData.coreness != UNPEELED) {
+                continue;
+              }
+              //! never drop a neighbor below the level being peeled
+              auto& degree = destData.currentDegree;
+              uint32_t old = degree;
+              while (old > k && !degree.compare_exchange_weak(old, old - 1)) {
+              }
+              if (old <= k) {
+                continue;
+              }
+              if (old - 1 == k) {
+                if (claimNode(destData, k)) {
+                  next.push(dest);
+                }
+              } else {
+                uint32_t last = destData.movedRound;
+                if (last != round &&
+                    destData.movedRound.compare_exchange_strong(last, round)) {
+                  moved.push(dest);
+                }
+              }
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("PeelRound"));
+
+      galois::do_all(
+          galois::iterate(moved),
+          [&](GNode n) {
+            NodeData& data = graph.getData(n);
+            if (data.coreness == UNPEELED) {
+              buckets.insert(n, data.currentDegree);
+            }
+          },
+          galois::no_stats(), galois::loopname("Rebucket"));
+
+      remaining -= peeled.reduce();
+      moved.clear();
+      frontier.clear();
+      std::swap(frontier, next);
+    }
+  }
+
+  galois::runtime::reportStat_Single(REGION_NAME, "PeelRounds", round);
+  galois::runtime::reportStat_Single(REGION_NAME, "TailNodes", remaining);
+  histogramPeelTail(graph, k);
+}
+
 /*******************************************************************************
  * Sanity check operators
  ******************************************************************************/
@@ -216,6 +491,63 @@ void kCoreSanity(Graph& graph) {
                  aliveNodes.reduce(), "\n");
 }
 
+/**
+ * Print the degeneracy and size of the densest core, plus the size of the
+ * -kcore core if requested. Also checks that the coreness values are
+ * consistent: a node of coreness c has at least c neighbors of coreness at
+ * least c, and fewer than c + 1 neighbors of coreness above c.
+ *
+ * @param graph Graph with decomposition results
+ */
+void decomposeSanity(Graph& graph) {
+  galois::GReduceMax<uint32_t> maxCore;
+  galois::GAccumulator<uint32_t> inCore;
+  galois::GAccumulator<uint32_t> inMaxCore;
+  galois::GAccumulator<uint32_t> inconsistent;
+
+  galois::do_all(
+      galois::iterate(graph.begin(), graph.end()),
+      [&](GNode curNode) {
+        uint32_t core = graph.getData(curNode).coreness;
+        maxCore.update(core);
+        if (core >= k_core_num) {
+          inCore += 1;
+        }
+        uint32_t atLeast = 0, above = 0;
+        for (auto e : graph.edges(curNode)) {
+          uint32_t other = graph.getData(graph.getEdgeDst(e)).coreness;
+          atLeast += (other >= core);
+          above += (other > core);
+        }
+        if (atLeast < core || above > core) {
+          inconsistent += 1;
+        }
+      },
+      galois::loopname("DecomposeSanityCheck"), galois::no_stats());
+
+  uint32_t degeneracy = maxCore.reduce();
+  galois::do_all(
+      galois::iterate(graph.begin(), graph.end()),
+      [&](GNode curNode) {
+        if (graph.getData(curNode).coreness == degeneracy) {
+          inMaxCore += 1;
+        }
+      },
+      galois::loopname("DecomposeSanityMax"), galois::no_stats());
+
+  galois::gPrint("Max coreness is ", degeneracy, "\n");
+  galois::gPrint("Number of nodes in the ", degeneracy, "-core is ",
+                 inMaxCore.reduce(), "\n");
+  if (k_core_num.getNumOccurrences()) {
+    galois::gPrint("Number of nodes in the ", k_core_num, "-core is ",
+                   inCore.reduce(), "\n");
+  }
+  if (inconsistent.reduce()) {
+    GALOIS_DIE("coreness of ", inconsistent.reduce(),
+               " nodes is inconsistent with their neighbors");
+  }
+}
+
 /*******************************************************************************
  * Main method for running
  ******************************************************************************/
@@ -232,6 +564,9 @@ int main(int argc, char** argv) {
                " please use the -symmetricGraph flag "
                " to indicate the input is a symmetric graph.");
   }
+  if (algo != Decompose && !k_core_num.getNumOccurrences()) {
+    GALOIS_DIE("-kcore is required for the Async and Sync algorithms");
+  }
 
   //! Some initial stat reporting.
   galois::gInfo("Worklist chunk size of ", CHUNK_SIZE,
@@ -277,6 +612,10 @@ int main(int argc, char** argv) {
     galois::gInfo("Running synchronous k-core with k-core number ", k_core_num);
     //! Synchronous k-core.
     syncCascadeKCore(graph);
+  } else if (algo == Decompose) {
+    galois::gInfo("Running k-core decomposition");
+    //! Coreness of all nodes by peeling buckets of increasing degree.
+    decomposeKCore(graph);
   } else {
     GALOIS_DIE("invalid specification of k-core algorithm");
   }
@@ -287,7 +626,19 @@ int main(int argc, char** argv) {
 
   //! Sanity check.
   if (!skipVerify) {
-    kCoreSanity(graph);
+    if (algo == Decompose) {
+      decomposeSanity(graph);
+    } else {
+      kCoreSanity(graph);
+    }
+  }
+
+  if (algo == Decompose && !outName.empty()) {
+    std::ofstream out(outName);
+    for (GNode n : graph) {
+      out << n << " " << graph.getData(n).coreness << "\n";
+    }
+    galois::gInfo("Coreness written to ", outName);
   }
 
   totalTime.stop();
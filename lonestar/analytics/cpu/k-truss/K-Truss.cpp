@@ -19,6 +19,7 @@
 
 #include "galois/Galois.h"
 #include "galois/Reduction.h"
+#include "galois/SetIntersect.h"
 #include "galois/Bag.h"
 #include "galois/Timer.h"
 #include "galois/graphs/Graph.h"
@@ -350,35 +351,19 @@ bool isSupportNoLessThanJ(Graph& g, GNode src, GNode dst, unsigned int j) {
        srcE            = g.edge_end(src, galois::MethodFlag::UNPROTECTED),
        dstI            = g.edge_begin(dst, galois::MethodFlag::UNPROTECTED),
        dstE            = g.edge_end(dst, galois::MethodFlag::UNPROTECTED);
-
-  while (true) {
-    //! Find the first valid edge.
-    while (srcI != srcE && (g.getEdgeData(srcI) & removed)) {
-      ++srcI;
-    }
-    while (dstI != dstE && (g.getEdgeData(dstI) & removed)) {
-      ++dstI;
-    }
-
-    if (srcI == srcE || dstI == dstE) {
-      return numValidEqual >= j;
-    }
-
-    //! Check for intersection.
-    auto sN = g.getEdgeDst(srcI), dN = g.getEdgeDst(dstI);
-    if (sN < dN) {
-      ++srcI;
-    } else if (dN < sN) {
-      ++dstI;
-    } else {
-      numValidEqual += 1;
-      if (numValidEqual >= j) {
-        return true;
-      }
-      ++srcI;
-      ++dstI;
-    }
-  }
+  const uint32_t* dsts = g.edgeDstArray();
+
+  //! Removed edges stay in the lists, so check both edges of each common
+  //! neighbor and stop as soon as j valid ones are found.
+  galois::setintersect::forEachCommon(
+      dsts + *srcI, *srcE - *srcI, dsts + *dstI, *dstE - *dstI,
+      [&](size_t s, size_t d) {
+        if (!(g.getEdgeData(srcI + s) & removed) &&
+            !(g.getEdgeData(dstI + d) & removed)) {
+          numValidEqual += 1;
+        }
+        return numValidEqual < j;
+      });
 
   return numValidEqual >= j;
 }
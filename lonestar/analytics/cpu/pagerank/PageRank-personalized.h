@@ -0,0 +1,407 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_PAGERANK_PERSONALIZED_H
+#define LONESTAR_PAGERANK_PERSONALIZED_H
+
+#include "galois/substrate/PerThreadStorage.h"
+
+#include <array>
+#include <fstream>
+#include <sstream>
+
+static cll::opt<std::string>
+    seedFile("seedFile",
+             cll::desc("Personalized: file with one seed set per line "
+                       "(whitespace separated node ids)"));
+static cll::opt<unsigned int>
+    batchWidth("batchWidth",
+               cll::desc("Personalized: rank vectors computed per pass over "
+                         "the graph, 1, 8, 16 or 32 (default value 16)"),
+               cll::init(16));
+static cll::opt<unsigned int>
+    topN("topN",
+         cll::desc("Personalized: nodes written per seed set (default 20)"),
+         cll::init(PRINT_TOP));
+static cll::opt<std::string>
+    personalizedOut("personalizedOut",
+                    cll::desc("Personalized: output file with lines "
+                              "<seed set> <rank> <node> <value>"));
+
+using SeedSet = std::vector<GNode>;
+
+//! Rank lanes processed per vector instruction: 8 floats fill an AVX register,
+//! and GCC and Clang split the arithmetic into SSE or scalar code otherwise.
+constexpr static const unsigned VEC_WIDTH = 8;
+typedef PRTy PRVec
+    __attribute__((vector_size(VEC_WIDTH * sizeof(PRTy)), may_alias));
+
+//! Reads one seed set per non-empty line.
+std::vector<SeedSet> readSeedSets(const std::string& file, size_t numNodes) {
+  std::ifstream in(file);
+  if (!in) {
+    GALOIS_DIE("failed to open seed file ", file);
+  }
+  std::vector<SeedSet> sets;
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream words(line);
+    SeedSet seeds;
+    uint64_t node;
+    while (words >> node) {
+      if (node >= numNodes) {
+        GALOIS_DIE("seed ", node, " is not a node of the graph");
+      }
+      seeds.push_back(node);
+    }
+    if (!seeds.empty()) {
+      sets.push_back(std::move(seeds));
+    }
+  }
+  return sets;
+}
+
+/**
+ * Personalized PageRank for K seed sets at once. Every node keeps K ranks
+ * (and K contributions, rank / outdegree) next to each other, so one pass
+ * over the in-edges of a node loads each edge once and updates all K rank
+ * vectors with K-wide arithmetic. The update is the in-place block
+ * Gauss-Seidel of the GaussSeidel algorithm, with the teleport going to the
+ * seed set of each vector:
+ *
+ *   rank_k(v) = (1 - ALPHA) * [v in S_k] / |S_k| + ALPHA * sum contrib_k(u)
+ *
+ * A vector stops changing once its L1 change in a round is at most the
+ * tolerance; the batch ends when all of its vectors have converged.
+ */
+template <unsigned K>
+class PersonalizedBatch {
+  Graph& graph;
+  const ContributionArray& invOut;
+  //! K entries per node, lane k of node n at n * K + k
+  galois::LargeArray<PRTy> rank;
+  galois::LargeArray<PRTy> contrib;
+  galois::LargeArray<PRTy> teleport;
+  //! 1 for lanes that have not converged yet, 0 otherwise
+  alignas(sizeof(PRVec)) std::array<PRTy, K> active;
+  std::array<unsigned, K> rounds;
+  unsigned passes = 0;
+
+  size_t idx(GNode n, unsigned lane) const { return size_t(n) * K + lane; }
+
+  //! The lanes of a node, VEC_WIDTH at a time
+  PRVec* vectors(galois::LargeArray<PRTy>& a, GNode n) {
+    return reinterpret_cast<PRVec*>(&a[idx(n, 0)]);
+  }
+
+  /**
+   * One Gauss-Seidel update of all lanes of src with vector arithmetic:
+   * every in-edge costs K / VEC_WIDTH vector loads and adds. Converged lanes
+   * are masked out and keep their ranks. change must be vector aligned.
+   */
+  void updateVectors(GNode src, std::array<PRTy, K>& change) {
+    constexpr unsigned V = K / VEC_WIDTH;
+    PRVec sum[V]         = {};
+    for (auto nbr : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+      const PRVec* c = vectors(contrib, graph.getEdgeDst(nbr));
+      for (unsigned v = 0; v < V; ++v) {
+        sum[v] += c[v];
+      }
+    }
+    PRVec* r       = vectors(rank, src);
+    PRVec* c       = vectors(contrib, src);
+    const PRVec* p = vectors(teleport, src);
+    PRVec* mask    = reinterpret_cast<PRVec*>(active.data());
+    PRVec* delta   = reinterpret_cast<PRVec*>(change.data());
+    const PRTy inv = invOut[src];
+    for (unsigned v = 0; v < V; ++v) {
+      PRVec diff = mask[v] * (p[v] + ALPHA * sum[v] - r[v]);
+      delta[v] += diff > 0 ? diff : -diff;
+      r[v] += diff;
+      c[v] = r[v] * inv;
+    }
+  }
+
+  //! updateVectors for widths that are not a multiple of VEC_WIDTH
+  void updateScalars(GNode src, std::array<PRTy, K>& change) {
+    PRTy sum[K] = {};
+    for (auto nbr : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+      const PRTy* c = &contrib[idx(graph.getEdgeDst(nbr), 0)];
+      for (unsigned k = 0; k < K; ++k) {
+        sum[k] += c[k];
+      }
+    }
+    PRTy* r        = &rank[idx(src, 0)];
+    PRTy* c        = &contrib[idx(src, 0)];
+    const PRTy* p  = &teleport[idx(src, 0)];
+    const PRTy inv = invOut[src];
+    for (unsigned k = 0; k < K; ++k) {
+      PRTy diff = active[k] * (p[k] + ALPHA * sum[k] - r[k]);
+      change[k] += std::fabs(diff);
+      r[k] += diff;
+      c[k] = r[k] * inv;
+    }
+  }
+
+public:
+  PersonalizedBatch(Graph& g, const ContributionArray& inv)
+      : graph(g), invOut(inv) {
+    rank.allocateInterleaved(graph.size() * K);
+    contrib.allocateInterleaved(graph.size() * K);
+    teleport.allocateInterleaved(graph.size() * K);
+  }
+
+  //! Computes the rank vectors of up to K seed sets; unused lanes stay 0
+  void run(const SeedSet* sets, unsigned num) {
+    GALOIS_ASSERT(num <= K, "too many seed sets for one batch");
+    galois::do_all(
+        galois::iterate(size_t{0}, graph.size() * K),
+        [&](size_t i) { teleport[i] = 0; }, galois::no_stats(),
+        galois::loopname("ClearTeleport"));
+    for (unsigned k = 0; k < num; ++k) {
+      for (GNode seed : sets[k]) {
+        teleport[idx(seed, k)] += (1.0f - ALPHA) / sets[k].size();
+      }
+    }
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& n) {
+          for (unsigned k = 0; k < K; ++k) {
+            rank[idx(n, k)]    = teleport[idx(n, k)];
+            contrib[idx(n, k)] = teleport[idx(n, k)] * invOut[n];
+          }
+        },
+        galois::no_stats(), galois::loopname("InitRanks"));
+    for (unsigned k = 0; k < K; ++k) {
+      active[k] = k < num;
+      rounds[k] = 0;
+    }
+
+    const size_t numBlocks =
+        (graph.size() + GS_BLOCK_SIZE - 1) / GS_BLOCK_SIZE;
+    galois::substrate::PerThreadStorage<std::array<PRTy, K>> changes;
+    unsigned numActive = num;
+    passes = 0;
+    while (numActive && passes < maxIterations) {
+      ++passes;
+      for (unsigned t = 0; t < changes.size(); ++t) {
+        changes.getRemote(t)->fill(0);
+      }
+
+      galois::do_all(
+          galois::iterate(size_t{0}, numBlocks),
+          [&](size_t block) {
+            GNode beg = block * GS_BLOCK_SIZE;
+            GNode end = std::min<size_t>(beg + GS_BLOCK_SIZE, graph.size());
+            alignas(sizeof(PRVec)) std::array<PRTy, K> blockChange{};
+            for (GNode src = beg; src < end; ++src) {
+              if constexpr (K % VEC_WIDTH == 0) {
+                updateVectors(src, blockChange);
+              } else {
+                updateScalars(src, blockChange);
+              }
+            }
+            std::array<PRTy, K>& change = *changes.getLocal();
+            for (unsigned k = 0; k < K; ++k) {
+              change[k] += blockChange[k];
+            }
+          },
+          galois::no_stats(), galois::steal(), galois::chunk_size<1>(),
+          galois::loopname("PersonalizedPageRank"));
+
+      for (unsigned k = 0; k < num; ++k) {
+        if (!active[k]) {
+          continue;
+        }
+        PRTy change = 0;
+        for (unsigned t = 0; t < changes.size(); ++t) {
+          change += (*changes.getRemote(t))[k];
+        }
+        rounds[k] = passes;
+        if (change <= tolerance) {
+          active[k] = 0;
+          --numActive;
+        }
+      }
+    }
+    if (numActive) {
+      std::cerr << "ERROR: " << numActive << " rank vectors failed to converge"
+                << " in " << maxIterations << " iterations\n";
+    }
+  }
+
+  PRTy getRank(GNode n, unsigned lane) const { return rank[idx(n, lane)]; }
+
+  //! Rounds lane k took to converge in the last run
+  unsigned getRounds(unsigned lane) const { return rounds[lane]; }
+
+  //! Passes over the graph in the last run: the rounds of the slowest lane
+  unsigned getPasses() const { return passes; }
+
+  //! The topn highest ranked nodes of a lane, best first
+  std::vector<TopPair<GNode>> top(unsigned lane, unsigned topn) const {
+    // min-heap on the rank, so the front is the worst of the best
+    auto worse = [](const TopPair<GNode>& x, const TopPair<GNode>& y) {
+      return y < x;
+    };
+    std::vector<TopPair<GNode>> best;
+    for (GNode n = 0; n < graph.size(); ++n) {
+      TopPair<GNode> key(rank[idx(n, lane)], n);
+      if (best.size() < topn) {
+        best.push_back(key);
+        std::push_heap(best.begin(), best.end(), worse);
+      } else if (topn && best.front() < key) {
+        std::pop_heap(best.begin(), best.end(), worse);
+        best.back() = key;
+        std::push_heap(best.begin(), best.end(), worse);
+      }
+    }
+    std::sort_heap(best.begin(), best.end(), worse);
+    return best;
+  }
+
+  /**
+   * Largest relative L1 distance from the fixed point over the first num
+   * lanes, as in reportFixedPointError.
+   */
+  double maxFixedPointError(unsigned num) {
+    galois::substrate::PerThreadStorage<std::array<double, K>> errors;
+    galois::substrate::PerThreadStorage<std::array<double, K>> norms;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          std::array<double, K> sum{};
+          for (auto nbr : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(nbr);
+            for (unsigned k = 0; k < K; ++k) {
+              sum[k] += double(rank[idx(dst, k)]) * invOut[dst];
+            }
+          }
+          for (unsigned k = 0; k < K; ++k) {
+            double value = rank[idx(src, k)];
+            (*errors.getLocal())[k] +=
+                std::fabs(teleport[idx(src, k)] + ALPHA * sum[k] - value);
+            (*norms.getLocal())[k] += value;
+          }
+        },
+        galois::steal(), galois::no_stats(),
+        galois::loopname("FixedPointError"));
+
+    double worst = 0;
+    for (unsigned k = 0; k < num; ++k) {
+      double error = 0, norm = 0;
+      for (unsigned t = 0; t < errors.size(); ++t) {
+        error += (*errors.getRemote(t))[k];
+        norm += (*norms.getRemote(t))[k];
+      }
+      worst = std::max(worst, error / norm);
+    }
+    return worst;
+  }
+};
+
+template <unsigned K>
+void runPersonalized(Graph& graph, const std::vector<SeedSet>& sets) {
+  galois::gInfo("Running batches of ", K, " seed sets");
+  galois::runtime::reportStat_Single("PageRank", "BatchWidth", K);
+
+  ContributionArray invOut;
+  invOut.allocateInterleaved(graph.size());
+  initNodeDataTopological(graph);
+  computeOutDeg(graph);
+  computeInverseOutDeg(graph, invOut);
+
+  PersonalizedBatch<K> batch(graph, invOut);
+  std::ofstream out;
+  if (!personalizedOut.empty()) {
+    out.open(personalizedOut);
+  }
+
+  galois::StatTimer execTime("Timer_0");
+  galois::StatTimer outputTime("OutputTime");
+  size_t totalRounds = 0;
+  size_t totalPasses = 0;
+  double worstError  = 0;
+  for (size_t i = 0; i < sets.size(); i += K) {
+    unsigned num = std::min<size_t>(K, sets.size() - i);
+    execTime.start();
+    batch.run(&sets[i], num);
+    execTime.stop();
+
+    totalPasses += batch.getPasses();
+    for (unsigned k = 0; k < num; ++k) {
+      totalRounds += batch.getRounds(k);
+    }
+    if (!skipVerify) {
+      worstError = std::max(worstError, batch.maxFixedPointError(num));
+    }
+
+    outputTime.start();
+    if (out.is_open()) {
+      for (unsigned k = 0; k < num; ++k) {
+        unsigned position = 1;
+        for (auto& p : batch.top(k, topN)) {
+          out << i + k << " " << position++ << " " << p.id << " " << p.value
+              << "\n";
+        }
+      }
+    }
+    outputTime.stop();
+  }
+
+  galois::runtime::reportStat_Single("PageRank", "SeedSets", sets.size());
+  galois::runtime::reportStat_Single("PageRank", "Rounds", totalRounds);
+  galois::runtime::reportStat_Single("PageRank", "GraphPasses", totalPasses);
+  galois::gInfo("Average rounds per seed set is ",
+                double(totalRounds) / sets.size());
+  if (!skipVerify) {
+    galois::gInfo("Largest relative distance from the fixed point is ",
+                  worstError);
+  }
+}
+
+void prPersonalized(Graph& graph) {
+  if (seedFile.empty()) {
+    GALOIS_DIE("-algo=Personalized requires -seedFile");
+  }
+  std::vector<SeedSet> sets = readSeedSets(seedFile, graph.size());
+  if (sets.empty()) {
+    GALOIS_DIE("no seed sets in ", seedFile);
+  }
+  galois::gInfo("Read ", sets.size(), " seed sets");
+
+  switch (batchWidth) {
+  case 1:
+    runPersonalized<1>(graph, sets);
+    break;
+  case 8:
+    runPersonalized<8>(graph, sets);
+    break;
+  case 16:
+    runPersonalized<16>(graph, sets);
+    break;
+  case 32:
+    runPersonalized<32>(graph, sets);
+    break;
+  default:
+    GALOIS_DIE("-batchWidth must be 1, 8, 16 or 32");
+  }
+}
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "Lonestar/BoilerPlate.h"
 #include "PageRank-constants.h"
+#include "galois/DynamicBitset.h"
 #include "galois/Galois.h"
 #include "galois/LargeArray.h"
 #include "galois/Timer.h"
@@ -26,15 +27,31 @@
 #include "galois/graphs/TypeTraits.h"
 #include "galois/gstl.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 const char* desc =
     "Computes page ranks a la Page and Brin. This is a pull-style algorithm.";
 
-enum Algo { Topo = 0, Residual };
+enum Algo { Topo = 0, Residual, GaussSeidel, Delta, Personalized };
 
-static cll::opt<Algo> algo("algo", cll::desc("Choose an algorithm:"),
-                           cll::values(clEnumVal(Topo, "Topological"),
-                                       clEnumVal(Residual, "Residual")),
-                           cll::init(Residual));
+static cll::opt<Algo> algo(
+    "algo", cll::desc("Choose an algorithm:"),
+    cll::values(clEnumVal(Topo, "Topological"),
+                clEnumVal(Residual, "Residual"),
+                clEnumVal(GaussSeidel, "In-place pull over blocks of nodes"),
+                clEnumVal(Delta, "Pull only from nodes that changed enough"),
+                clEnumVal(Personalized,
+                          "Personalized PageRank of many seed sets in "
+                          "batches (see -seedFile)")),
+    cll::init(Residual));
+
+static cll::opt<bool>
+    gatherKernel("gather",
+                 cll::desc("GaussSeidel/Delta: sum in-edge contributions with "
+                           "the vector gather kernel (default true)"),
+                 cll::init(true));
 
 //! Flag that forces user to be aware that they should be passing in a
 //! transposed graph.
@@ -44,6 +61,11 @@ static cll::opt<bool>
                     cll::init(false));
 
 constexpr static const unsigned CHUNK_SIZE = 32;
+//! Number of consecutive nodes a thread updates in place in GaussSeidel
+constexpr static const unsigned GS_BLOCK_SIZE = 1024;
+//! Delta pulls with the gather kernel once more than 1/DELTA_DENSE_FRACTION
+//! of the nodes are active, and tests the active bitset per edge otherwise
+constexpr static const unsigned DELTA_DENSE_FRACTION = 20;
 
 struct LNode {
   PRTy value;
@@ -54,8 +76,9 @@ typedef galois::graphs::LC_CSR_Graph<LNode, void>::with_no_lockable<
     true>::type ::with_numa_alloc<true>::type Graph;
 typedef typename Graph::GraphNode GNode;
 
-using DeltaArray    = galois::LargeArray<PRTy>;
-using ResidualArray = galois::LargeArray<PRTy>;
+using DeltaArray        = galois::LargeArray<PRTy>;
+using ResidualArray     = galois::LargeArray<PRTy>;
+using ContributionArray = galois::LargeArray<PRTy>;
 
 //! Initialize nodes for the topological algorithm.
 void initNodeDataTopological(Graph& g) {
@@ -183,6 +206,7 @@ void computePRResidual(Graph& graph, DeltaArray& delta,
   } ///< End while(true).
     //! [scalarreduction]
 
+  galois::runtime::reportStat_Single("PageRank", "Rounds", iterations);
   if (iterations >= maxIterations) {
     std::cerr << "ERROR: failed to converge in " << iterations
               << " iterations\n";
@@ -250,6 +274,184 @@ void computePRTopological(Graph& graph) {
   }
 }
 
+/**
+ * Sum of contrib[dst[e]] over the edges [beg, end). With AVX2, eight edge
+ * destinations are loaded at a time and their contributions are fetched with
+ * a single gather, so the loop runs over the CSR arrays directly instead of
+ * through edge iterators and node data.
+ */
+PRTy gatherSum(const uint32_t* dst, uint64_t beg, uint64_t end,
+               const PRTy* contrib) {
+  PRTy sum = 0;
+#if defined(__AVX2__)
+  __m256 acc = _mm256_setzero_ps();
+  for (; beg + 8 <= end; beg += 8) {
+    __m256i idx =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + beg));
+    acc = _mm256_add_ps(acc, _mm256_i32gather_ps(contrib, idx, sizeof(PRTy)));
+  }
+  __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc),
+                           _mm256_extractf128_ps(acc, 1));
+  half        = _mm_hadd_ps(half, half);
+  half        = _mm_hadd_ps(half, half);
+  sum         = _mm_cvtss_f32(half);
+#endif
+  for (; beg < end; ++beg) {
+    sum += contrib[dst[beg]];
+  }
+  return sum;
+}
+
+//! Sum of contrib over the in-edges of src
+PRTy pullSum(Graph& graph, const GNode& src, const PRTy* contrib) {
+  constexpr const galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+  if (gatherKernel) {
+    return gatherSum(graph.edgeDstArray(), *graph.edge_begin(src, flag),
+                     *graph.edge_end(src, flag), contrib);
+  }
+  PRTy sum = 0;
+  for (auto nbr : graph.edges(src, flag)) {
+    sum += contrib[graph.getEdgeDst(nbr)];
+  }
+  return sum;
+}
+
+//! 1 / outdegree in the original graph, or 0 for nodes without out-edges.
+void computeInverseOutDeg(Graph& graph, ContributionArray& invOut) {
+  // the gather kernel uses signed 32-bit indices
+  GALOIS_ASSERT(graph.size() < (size_t{1} << 31),
+                "too many nodes for the gather kernel");
+  galois::do_all(
+      galois::iterate(graph),
+      [&](const GNode& n) {
+        uint32_t nout = graph.getData(n, galois::MethodFlag::UNPROTECTED).nout;
+        invOut[n]     = nout ? 1.0f / nout : 0.0f;
+      },
+      galois::no_stats(), galois::loopname("InverseOutDeg"));
+}
+
+/**
+ * PageRank pull Gauss-Seidel. Nodes are split into blocks of GS_BLOCK_SIZE
+ * consecutive ids; a thread updates the nodes of a block in order and in
+ * place, so later nodes of the block (and of blocks processed later) already
+ * see the new ranks in the same round. Each node keeps its contribution
+ * (rank / outdegree) up to date for the gather kernel.
+ */
+void computePRGaussSeidel(Graph& graph, const ContributionArray& invOut,
+                          ContributionArray& contrib) {
+  unsigned int iteration = 0;
+  galois::GAccumulator<float> accum;
+
+  const float base_score = (1.0f - ALPHA) / graph.size();
+  const size_t numBlocks = (graph.size() + GS_BLOCK_SIZE - 1) / GS_BLOCK_SIZE;
+  while (true) {
+    galois::do_all(
+        galois::iterate(size_t{0}, numBlocks),
+        [&](size_t block) {
+          GNode beg = block * GS_BLOCK_SIZE;
+          GNode end = std::min<size_t>(beg + GS_BLOCK_SIZE, graph.size());
+          for (GNode src = beg; src < end; ++src) {
+            LNode& sdata =
+                graph.getData(src, galois::MethodFlag::UNPROTECTED);
+            float value = pullSum(graph, src, contrib.data()) * ALPHA +
+                          base_score;
+            accum += std::fabs(value - sdata.value);
+            sdata.value  = value;
+            contrib[src] = value * invOut[src];
+          }
+        },
+        galois::no_stats(), galois::steal(), galois::chunk_size<1>(),
+        galois::loopname("PageRank"));
+
+    iteration += 1;
+    if (accum.reduce() <= tolerance || iteration >= maxIterations) {
+      break;
+    }
+    accum.reset();
+  } ///< End while(true).
+
+  galois::runtime::reportStat_Single("PageRank", "Rounds", iteration);
+  if (iteration >= maxIterations) {
+    std::cerr << "ERROR: failed to converge in " << iteration
+              << " iterations\n";
+  }
+}
+
+/**
+ * Delta PageRank pull. Like the residual algorithm, every round folds the
+ * residuals above the tolerance into the ranks and sends residual * ALPHA /
+ * outdegree along the out-edges. Only those nodes are marked in a bitset, and
+ * a node pulls from an in-neighbor only if it is marked; while few nodes are
+ * active this replaces a float load per edge with a bit test. Residuals below
+ * the tolerance are kept and accumulated rather than overwritten.
+ */
+void computePRDelta(Graph& graph, const ContributionArray& invOut,
+                    DeltaArray& delta, ResidualArray& residual) {
+  unsigned int iterations = 0;
+  galois::GAccumulator<unsigned int> accum;
+  galois::DynamicBitSet active;
+  active.resize(graph.size());
+
+  while (true) {
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          auto& sdata = graph.getData(src, galois::MethodFlag::UNPROTECTED);
+          delta[src]  = 0;
+          if (residual[src] > tolerance) {
+            PRTy oldResidual = residual[src];
+            residual[src]    = 0.0;
+            sdata.value += oldResidual;
+            if (sdata.nout > 0) {
+              delta[src] = oldResidual * ALPHA * invOut[src];
+              active.set(src);
+              accum += 1;
+            }
+          }
+        },
+        galois::no_stats(), galois::loopname("PageRank_delta"));
+
+    unsigned int numActive = accum.reduce();
+    iterations++;
+    if (!numActive) {
+      break;
+    }
+
+    const bool dense = numActive > graph.size() / DELTA_DENSE_FRACTION;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          PRTy sum = 0;
+          if (dense) {
+            sum = pullSum(graph, src, delta.data());
+          } else {
+            for (auto nbr :
+                 graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+              GNode dst = graph.getEdgeDst(nbr);
+              if (active.test(dst)) {
+                sum += delta[dst];
+              }
+            }
+          }
+          residual[src] += sum;
+        },
+        galois::steal(), galois::chunk_size<CHUNK_SIZE>(), galois::no_stats(),
+        galois::loopname("PageRank"));
+
+    active.reset();
+    if (iterations >= maxIterations) {
+      break;
+    }
+    accum.reset();
+  } ///< End while(true).
+
+  galois::runtime::reportStat_Single("PageRank", "Rounds", iterations);
+  if (iterations >= maxIterations) {
+    std::cerr << "ERROR: failed to converge in " << iterations
+              << " iterations\n";
+  }
+}
+
 void prTopological(Graph& graph) {
   initNodeDataTopological(graph);
   computeOutDeg(graph);
@@ -275,6 +477,75 @@ void prResidual(Graph& graph) {
   execTime.stop();
 }
 
+void prGaussSeidel(Graph& graph) {
+  ContributionArray invOut;
+  invOut.allocateInterleaved(graph.size());
+  ContributionArray contrib;
+  contrib.allocateInterleaved(graph.size());
+
+  initNodeDataTopological(graph);
+  computeOutDeg(graph);
+  computeInverseOutDeg(graph, invOut);
+  galois::do_all(
+      galois::iterate(graph),
+      [&](const GNode& n) {
+        contrib[n] = graph.getData(n).value * invOut[n];
+      },
+      galois::no_stats(), galois::loopname("InitContributions"));
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  computePRGaussSeidel(graph, invOut, contrib);
+  execTime.stop();
+}
+
+void prDelta(Graph& graph) {
+  ContributionArray invOut;
+  invOut.allocateInterleaved(graph.size());
+  DeltaArray delta;
+  delta.allocateInterleaved(graph.size());
+  ResidualArray residual;
+  residual.allocateInterleaved(graph.size());
+
+  initNodeDataResidual(graph, delta, residual);
+  computeOutDeg(graph);
+  computeInverseOutDeg(graph, invOut);
+
+  galois::StatTimer execTime("Timer_0");
+  execTime.start();
+  computePRDelta(graph, invOut, delta, residual);
+  execTime.stop();
+}
+
+/**
+ * Distance of the ranks from the fixed point, ||r - (base + ALPHA * A r)||_1
+ * relative to ||r||_1, so that algorithms with different stopping criteria
+ * and scalings can be compared at the same accuracy.
+ */
+void reportFixedPointError(Graph& graph, float base_score) {
+  galois::GAccumulator<double> error;
+  galois::GAccumulator<double> norm;
+  galois::do_all(
+      galois::iterate(graph),
+      [&](const GNode& src) {
+        constexpr const galois::MethodFlag flag =
+            galois::MethodFlag::UNPROTECTED;
+        double sum = 0;
+        for (auto nbr : graph.edges(src, flag)) {
+          LNode& ddata = graph.getData(graph.getEdgeDst(nbr), flag);
+          sum += double(ddata.value) / ddata.nout;
+        }
+        double value = graph.getData(src, flag).value;
+        error += std::fabs(base_score + ALPHA * sum - value);
+        norm += value;
+      },
+      galois::steal(), galois::no_stats(), galois::loopname("FixedPointError"));
+  galois::gInfo("Relative distance from the fixed point is ",
+                error.reduce() / norm.reduce());
+}
+
+#include "PageRank-personalized.h"
+
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
   LonestarStart(argc, argv, name, desc, url, &inputFile);
@@ -314,12 +585,33 @@ int main(int argc, char** argv) {
               << ", maxIterations:" << maxIterations << "\n";
     prResidual(transposeGraph);
     break;
+  case GaussSeidel:
+    std::cout << "Running Pull Gauss-Seidel version, tolerance:" << tolerance
+              << ", maxIterations:" << maxIterations << "\n";
+    prGaussSeidel(transposeGraph);
+    break;
+  case Delta:
+    std::cout << "Running Pull Delta version, tolerance:" << tolerance
+              << ", maxIterations:" << maxIterations << "\n";
+    prDelta(transposeGraph);
+    break;
+  case Personalized:
+    std::cout << "Running Pull Personalized version, tolerance:" << tolerance
+              << ", maxIterations:" << maxIterations << "\n";
+    prPersonalized(transposeGraph);
+    break;
   default:
     std::abort();
   }
 
   galois::reportPageAlloc("MeminfoPost");
 
+  //! The personalized ranks are not node data; the batch checks them itself.
+  if (algo == Personalized) {
+    totalTime.stop();
+    return 0;
+  }
+
   //! Sanity checking code.
   galois::GReduceMax<PRTy> maxRank;
   galois::GReduceMin<PRTy> minRank;
@@ -350,6 +642,10 @@ int main(int argc, char** argv) {
 
   if (!skipVerify) {
     printTop(transposeGraph);
+    bool normalized = algo == Topo || algo == GaussSeidel;
+    reportFixedPointError(transposeGraph,
+                          normalized ? (1.0f - ALPHA) / transposeGraph.size()
+                                     : INIT_RESIDUAL);
   }
 
 #if DEBUG
@@ -20,6 +20,7 @@
 #include "galois/Galois.h"
 #include "galois/Reduction.h"
 #include "galois/Bag.h"
+#include "galois/LargeArray.h"
 #include "galois/Timer.h"
 #include "galois/graphs/LCGraph.h"
 #include "llvm/Support/CommandLine.h"
@@ -27,8 +28,11 @@
 
 #include <boost/iterator/iterator_adaptor.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iostream>
+#include <limits>
 
 namespace cll = llvm::cl;
 
@@ -59,8 +63,14 @@ static cll::opt<bool> useSymmetricDirectly(
 static cll::opt<int>
     relabelInt("relabel",
                cll::desc("relabel interval X: relabel every X iterations "
-                         "(default 0 uses default interval)"),
+                         "(default 0 adapts the interval to the cost of the "
+                         "previous relabel)"),
                cll::init(0));
+static cll::opt<bool>
+    useGap("gap",
+           cll::desc("Use the gap relabeling heuristic (non-deterministic "
+                     "algorithm only, default true)"),
+           cll::init(true));
 static cll::opt<DetAlgo>
     detAlgo(cll::desc("Deterministic algorithm:"),
             cll::values(clEnumVal(nondet, "Non-deterministic (default)"),
@@ -84,6 +94,18 @@ static const int ALPHA = 6;
  */
 static const int BETA = 12;
 
+/**
+ * With the adaptive relabel interval, the work between two global relabels
+ * is at least RELABEL_RATIO times the number of edges the last global relabel
+ * scanned, and it stays within [1 / RELABEL_RANGE, RELABEL_RANGE] times the
+ * Goldberg interval. Late in the run most nodes are cut off from the sink,
+ * global relabels get cheap and are done more often.
+ */
+static const int RELABEL_RATIO = 2;
+static const int RELABEL_RANGE = 8;
+
+constexpr static const unsigned CHUNK_SIZE = 64;
+
 struct Node {
   uint32_t id;
   int64_t excess;
@@ -112,6 +134,15 @@ struct PreflowPush {
   GNode source;
   int global_relabel_interval;
   bool should_global_relabel = false;
+  bool adaptive_relabel      = false;
+  int base_relabel_interval  = 0;
+  //! number of nodes of each height below graph.size(), for gap relabeling
+  galois::LargeArray<std::atomic<int>> heightCount;
+  //! lowest height that ran out of nodes during the current discharge loop
+  std::atomic<int> gapHeight;
+  //! discharge work since the last liftAboveGap
+  Counter gapWork;
+  Counter gapNodes;
   galois::LargeArray<Graph::edge_iterator>
       reverseDirectionEdgeIterator; // ideally should be on the graph as
                                     // graph.getReverseEdgeIterator()
@@ -225,13 +256,87 @@ struct PreflowPush {
     assert(minHeight != std::numeric_limits<int>::max());
     ++minHeight;
 
-    Node& node = graph.getData(src, galois::MethodFlag::UNPROTECTED);
-    if (minHeight < (int)graph.size()) {
-      node.height  = minHeight;
+    Node& node    = graph.getData(src, galois::MethodFlag::UNPROTECTED);
+    const int n   = graph.size();
+    const int old = node.height;
+    int newHeight = std::min(minHeight, n);
+    if (minHeight < n) {
       node.current = minEdge;
-    } else {
-      node.height = graph.size();
     }
+
+    if (useGap && detAlgo == nondet) {
+      // count the new height first so that a height being entered never
+      // looks empty
+      if (newHeight < n) {
+        heightCount[newHeight] += 1;
+      }
+      if (heightCount[old].fetch_sub(1) == 1 && newHeight > old) {
+        // src was the last node of its height and moves above it, so it can
+        // no longer reach the sink; liftAboveGap lifts the nodes above it
+        if (newHeight < n) {
+          heightCount[newHeight] -= 1;
+        }
+        newHeight = n;
+        markGap(old);
+        gapNodes += 1;
+      }
+    }
+    node.height = newHeight;
+  }
+
+  //! Records an empty height for liftAboveGap
+  void markGap(int height) {
+    int gap = gapHeight.load(std::memory_order_relaxed);
+    while (height < gap && !gapHeight.compare_exchange_weak(gap, height)) {
+    }
+  }
+
+  bool hasGap() const {
+    return gapHeight.load(std::memory_order_relaxed) !=
+           std::numeric_limits<int>::max();
+  }
+
+  /**
+   * Gap heuristic: when no node has height h, the nodes above h cannot
+   * reach the sink in the residual graph. Runs after a discharge loop that
+   * stopped on a gap, lifts every node above it to graph.size() and
+   * collects the active nodes left below it, which restores a valid
+   * labeling around the nodes relabel already lifted. Returns false without
+   * changing anything if the gap was refilled in the meantime: nodes above
+   * it may reach the sink again, and only a global relabel can tell them
+   * apart.
+   *
+   * This is a single pass over the nodes rather than per-height node lists
+   * as the pass is needed anyway to rebuild the worklist after the loop
+   * break; nonDetDischarge only stops for a gap once the discharge work
+   * since the last pass is about as large as the graph.
+   */
+  template <typename IncomingWL>
+  bool liftAboveGap(IncomingWL& incoming) {
+    const int n   = graph.size();
+    const int gap = gapHeight.exchange(std::numeric_limits<int>::max());
+    if (heightCount[gap].load(std::memory_order_relaxed) > 0) {
+      return false;
+    }
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          Node& node = graph.getData(src, galois::MethodFlag::UNPROTECTED);
+          if (src == source || node.height >= n)
+            return;
+          if (node.height > gap) {
+            heightCount[node.height] -= 1;
+            node.height = n;
+            gapNodes += 1;
+            return;
+          }
+          if (src != sink && node.excess > 0)
+            incoming.push_back(src);
+        },
+        galois::loopname("LiftAboveGap"));
+    gapWork.reset();
+    return true;
   }
 
   template <typename C>
@@ -352,10 +457,12 @@ struct PreflowPush {
     // per thread
     const int relabel_interval =
         global_relabel_interval / galois::getActiveThreads();
+    const int gap_interval = graph.size() / galois::getActiveThreads();
 
     galois::for_each(
         galois::iterate(initial),
-        [&counter, relabel_interval, this](GNode& src, auto& ctx) {
+        [&counter, relabel_interval, gap_interval, this](GNode& src,
+                                                         auto& ctx) {
           int increment = 1;
           this->acquire(src);
           if (this->discharge(src, ctx)) {
@@ -363,6 +470,7 @@ struct PreflowPush {
           }
 
           counter += increment;
+          this->gapWork += increment;
           if (this->global_relabel_interval > 0 &&
               counter.getLocal() >= relabel_interval) { // local check
 
@@ -370,6 +478,11 @@ struct PreflowPush {
             ctx.breakLoop();
             return;
           }
+          if (useGap && this->gapWork.getLocal() >= gap_interval &&
+              this->hasGap()) {
+            ctx.breakLoop();
+            return;
+          }
         },
         galois::loopname("nonDetDischarge"), galois::parallel_break(), wl_opt);
   }
@@ -440,8 +553,71 @@ struct PreflowPush {
         galois::loopname("updateHeights"));
   }
 
+  /**
+   * Reverse BFS on the residual graph from the sink, one level at a time.
+   * Each node is claimed by the first level that reaches it, so every node
+   * is expanded once; the source keeps its height. Returns the number of
+   * edges scanned.
+   *
+   * Unlike bfsDirectionOpt there is no pull step: the nodes cut off from the
+   * sink would rescan all their edges at every level.
+   */
+  size_t bfsHeights() {
+    galois::InsertBag<GNode> frontier;
+    galois::InsertBag<GNode> next;
+    galois::GAccumulator<size_t> scanned;
+    const int n = graph.size();
+
+    frontier.push(sink);
+    for (int level = 1; !frontier.empty(); ++level) {
+      galois::do_all(
+          galois::iterate(frontier),
+          [&](const GNode& src) {
+            size_t edges = 0;
+            for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+              ++edges;
+              GNode dst  = graph.getEdgeDst(ii);
+              Node& node = graph.getData(dst, galois::MethodFlag::UNPROTECTED);
+              // most neighbors are already labeled late in the BFS, so test
+              // that before loading the residual capacity
+              if (node.height != n || dst == source)
+                continue;
+              int64_t rdata =
+                  graph.getEdgeData(reverseDirectionEdgeIterator[*ii]);
+              if (rdata > 0 &&
+                  __sync_bool_compare_and_swap(&node.height, n, level)) {
+                next.push(dst);
+              }
+            }
+            scanned += edges;
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("BFSHeights"));
+      frontier.clear();
+      std::swap(frontier, next);
+    }
+    return scanned.reduce();
+  }
+
+  //! Clears the height counts and the recorded gap
+  void resetGaps() {
+    galois::do_all(
+        galois::iterate(size_t{0}, heightCount.size()),
+        [&](size_t h) { heightCount[h] = 0; }, galois::no_stats(),
+        galois::loopname("ResetHeightCounts"));
+    gapHeight = std::numeric_limits<int>::max();
+  }
+
+  /**
+   * Recomputes exact heights and collects the active nodes that can still
+   * reach the sink. Returns the number of edges the reverse BFS scanned.
+   */
   template <typename IncomingWL>
-  void globalRelabel(IncomingWL& incoming) {
+  size_t globalRelabel(IncomingWL& incoming) {
+    const bool countHeights = useGap && detAlgo == nondet;
+    if (countHeights) {
+      resetGaps();
+    }
 
     galois::do_all(
         galois::iterate(graph),
@@ -454,11 +630,11 @@ struct PreflowPush {
         },
         galois::loopname("ResetHeights"));
 
-    using BSWL = galois::worklists::BulkSynchronous<>;
-    using DWL  = galois::worklists::Deterministic<>;
+    size_t scanned = graph.sizeEdges();
+    using DWL      = galois::worklists::Deterministic<>;
     switch (detAlgo) {
     case nondet:
-      updateHeights<nondet, BSWL>();
+      scanned = bfsHeights();
       break;
     case detBase:
       updateHeights<detBase, DWL>();
@@ -471,18 +647,21 @@ struct PreflowPush {
       abort();
     }
 
+    // FindWork also builds the height counts used by the gap heuristic
     galois::do_all(
         galois::iterate(graph),
-        [&incoming, this](const GNode& src) {
+        [&, this](const GNode& src) {
           Node& node =
               this->graph.getData(src, galois::MethodFlag::UNPROTECTED);
-          if (src == this->sink || src == this->source ||
-              node.height >= (int)this->graph.size())
+          if (src == this->source || node.height >= (int)this->graph.size())
             return;
-          if (node.excess > 0)
+          if (countHeights)
+            heightCount[node.height] += 1;
+          if (src != this->sink && node.excess > 0)
             incoming.push_back(src);
         },
         galois::loopname("FindWork"));
+    return scanned;
   }
 
   template <typename C>
@@ -513,10 +692,27 @@ struct PreflowPush {
     galois::InsertBag<GNode> initial;
     initializePreflow(initial);
 
+    if (useGap && detAlgo == nondet) {
+      heightCount.allocateInterleaved(graph.size());
+    }
+
+    // start from exact heights instead of all ones
+    size_t scanned;
+    {
+      galois::StatTimer T_global_relabel("GlobalRelabelTime");
+      T_global_relabel.start();
+      initial.clear();
+      scanned = globalRelabel(initial);
+      T_global_relabel.stop();
+    }
+    int numRelabels = 1;
+    int numGaps     = 0;
+    // kept across gap lifts so that they do not postpone the global relabel
+    Counter counter;
+
     while (initial.begin() != initial.end()) {
       galois::StatTimer T_discharge("DischargeTime");
       T_discharge.start();
-      Counter counter;
       switch (detAlgo) {
       case nondet:
         if (useHLOrder) {
@@ -537,19 +733,55 @@ struct PreflowPush {
       }
       T_discharge.stop();
 
+      if (!should_global_relabel && useGap && detAlgo == nondet && hasGap()) {
+        galois::StatTimer T_gap("GapRelabelTime");
+        T_gap.start();
+        initial.clear();
+        should_global_relabel = !liftAboveGap(initial);
+        ++numGaps;
+        T_gap.stop();
+        if (!should_global_relabel) {
+          continue;
+        }
+      }
+
       if (should_global_relabel) {
         galois::StatTimer T_global_relabel("GlobalRelabelTime");
         T_global_relabel.start();
         initial.clear();
-        globalRelabel(initial);
+        scanned               = globalRelabel(initial);
         should_global_relabel = false;
+        ++numRelabels;
         std::cout << " Flow after global relabel: "
                   << graph.getData(sink).excess << "\n";
         T_global_relabel.stop();
+        counter.reset();
+        if (adaptive_relabel) {
+          adaptRelabelInterval(scanned);
+        }
       } else {
         break;
       }
     }
+
+    galois::runtime::reportStat_Single("PreflowPush", "GlobalRelabels",
+                                       numRelabels);
+    galois::runtime::reportStat_Single("PreflowPush", "GapRelabels", numGaps);
+    galois::runtime::reportStat_Single("PreflowPush", "GapNodes",
+                                       gapNodes.reduce());
+  }
+
+  /**
+   * Sets the next relabel interval from the cost of the last global relabel
+   * so that relabeling stays a fixed fraction of the discharge work.
+   */
+  void adaptRelabelInterval(size_t scanned) {
+    const int64_t lo = std::max(base_relabel_interval / RELABEL_RANGE, 1);
+    const int64_t hi = std::min<int64_t>(
+        int64_t{base_relabel_interval} * RELABEL_RANGE,
+        std::numeric_limits<int>::max());
+    const int64_t next      = int64_t{RELABEL_RATIO} * scanned;
+    global_relabel_interval = std::min(std::max(next, lo), hi);
   }
 
   template <typename EdgeTy>
@@ -817,9 +1049,46 @@ struct PreflowPush {
     }
   }
 
+  /**
+   * The preflow is maximum only if no node with excess other than the source
+   * can still reach the sink in the residual graph.
+   */
+  void checkActiveNodes() {
+    std::vector<uint8_t> visited(graph.size(), 0);
+    std::deque<GNode> queue;
+
+    visited[sink] = 1;
+    queue.push_back(sink);
+
+    while (!queue.empty()) {
+      GNode src = queue.front();
+      queue.pop_front();
+      for (auto ii : graph.edges(src)) {
+        GNode dst = graph.getEdgeDst(ii);
+        if (!visited[dst] &&
+            graph.getEdgeData(reverseDirectionEdgeIterator[*ii]) > 0) {
+          visited[dst] = 1;
+          queue.push_back(dst);
+        }
+      }
+    }
+
+    for (Graph::iterator ii = graph.begin(), ei = graph.end(); ii != ei; ++ii) {
+      GNode src = *ii;
+      if (src == source || src == sink || !visited[src])
+        continue;
+      if (graph.getData(src).excess > 0) {
+        std::cerr << "Active node can reach sink: " << graph.getData(src)
+                  << "\n";
+        abort();
+      }
+    }
+  }
+
   void verify(PreflowPush& orig) {
     // FIXME: doesn't fully check result
     checkHeights();
+    checkActiveNodes();
     checkConservation(orig);
     checkAugmentingPath();
   }
@@ -840,6 +1109,8 @@ int main(int argc, char** argv) {
   if (relabelInt == 0) {
     app.global_relabel_interval =
         app.graph.size() * ALPHA + app.graph.sizeEdges() / 3;
+    app.base_relabel_interval = app.global_relabel_interval;
+    app.adaptive_relabel      = detAlgo == nondet;
   } else {
     app.global_relabel_interval = relabelInt;
   }
@@ -19,6 +19,7 @@
 
 #include "galois/Galois.h"
 #include "galois/Bag.h"
+#include "galois/LargeArray.h"
 #include "galois/ParallelSTL.h"
 #include "galois/Reduction.h"
 #include "galois/Timer.h"
@@ -33,6 +34,8 @@
 #include <utility>
 #include <algorithm>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 namespace cll = llvm::cl;
 
@@ -40,13 +43,23 @@ static const char* name = "Boruvka's Minimum Spanning Tree Algorithm";
 static const char* desc = "Computes the minimum spanning forest of a graph";
 static const char* url  = "mst";
 
-enum Algo { parallel, exp_parallel };
+enum Algo { parallel, filterKruskal, contractBoruvka, exp_parallel };
 
 static cll::opt<std::string>
     inputFilename(cll::Positional, cll::desc("<input file>"), cll::Required);
 static cll::opt<Algo>
     algo("algo", cll::desc("Choose an algorithm (default value parallel):"),
-         cll::values(clEnumVal(parallel, "Parallel")), cll::init(parallel));
+         cll::values(clEnumVal(parallel, "Parallel"),
+                     clEnumVal(filterKruskal, "Filter-Kruskal"),
+                     clEnumVal(contractBoruvka,
+                               "Boruvka with edge-list contraction")),
+         cll::init(parallel));
+static cll::opt<unsigned>
+    kruskalBaseSize("baseSize",
+                    cll::desc("Filter-Kruskal sorts ranges of at most this "
+                              "many edges directly (default value 65536; "
+                              "at least 512)"),
+                    cll::init(1 << 16));
 
 typedef int EdgeData;
 
@@ -73,12 +86,130 @@ struct Edge {
       : src(s), dst(d), weight(w) {}
 };
 
+/**
+ * Graph, output and verification shared by all algorithms. The minimum
+ * spanning forest is left in mst and the components in the union-find of the
+ * nodes.
+ */
+struct MSTBase {
+  Graph graph;
+  galois::InsertBag<Edge> mst;
+  EdgeData inf;
+  EdgeData heaviest;
+
+  bool checkAcyclic(void) {
+    galois::GAccumulator<unsigned> roots;
+
+    galois::do_all(galois::iterate(graph), [&roots, this](const GNode& n) {
+      const auto& data = graph.getData(n, galois::MethodFlag::UNPROTECTED);
+      if (data.isRep())
+        roots += 1;
+    });
+
+    unsigned numRoots = roots.reduce();
+    unsigned numEdges = std::distance(mst.begin(), mst.end());
+
+    if (graph.size() - numRoots != numEdges) {
+      std::cerr << "Generated graph is not a forest. "
+                << "Expected " << graph.size() - numRoots << " edges but "
+                << "found " << numEdges << "\n";
+      return false;
+    }
+
+    std::cout << "Num trees: " << numRoots << "\n";
+    std::cout << "Tree edges: " << numEdges << "\n";
+    return true;
+  }
+
+  EdgeData sortEdges() {
+
+    galois::GReduceMax<EdgeData> heavy;
+
+    galois::do_all(galois::iterate(graph), [&heavy, this](const GNode& src) {
+      //! [sortEdgeByEdgeData]
+      graph.sortEdgesByEdgeData(src, std::less<EdgeData>(),
+                                galois::MethodFlag::UNPROTECTED);
+      //! [sortEdgeByEdgeData]
+
+      Graph::edge_iterator ii =
+          graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+      Graph::edge_iterator ei =
+          graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+      ptrdiff_t dist = std::distance(ii, ei);
+      if (dist == 0)
+        return;
+      std::advance(ii, dist - 1);
+      heavy.update(graph.getEdgeData(ii));
+    });
+
+    return heavy.reduce();
+  }
+
+  bool verify() {
+
+    auto is_bad_graph = [this](const GNode& n) {
+      Node& me = graph.getData(n);
+      for (auto ii : graph.edges(n)) {
+        GNode dst  = graph.getEdgeDst(ii);
+        Node& data = graph.getData(dst);
+        if (me.findAndCompress() != data.findAndCompress()) {
+          std::cerr << "not in same component: " << me << " and " << data
+                    << "\n";
+          return true;
+        }
+      }
+      return false;
+    };
+
+    auto is_bad_mst = [this](const Edge& e) {
+      return graph.getData(e.src).findAndCompress() !=
+             graph.getData(e.dst).findAndCompress();
+    };
+
+    if (galois::ParallelSTL::find_if(graph.begin(), graph.end(),
+                                     is_bad_graph) == graph.end()) {
+      if (galois::ParallelSTL::find_if(mst.begin(), mst.end(), is_bad_mst) ==
+          mst.end()) {
+        return checkAcyclic();
+      }
+    }
+    return false;
+  }
+
+  void initializeGraph() {
+    galois::graphs::FileGraph origGraph;
+    galois::graphs::FileGraph symGraph;
+
+    origGraph.fromFileInterleaved<EdgeData>(inputFilename);
+    if (!symmetricGraph)
+      galois::graphs::makeSymmetric<EdgeData>(origGraph, symGraph);
+    else
+      std::swap(symGraph, origGraph);
+
+    galois::graphs::readGraph(graph, symGraph);
+
+    galois::StatTimer Tsort("InitializeSortTime");
+    Tsort.start();
+    heaviest = sortEdges();
+    if (heaviest == std::numeric_limits<EdgeData>::max() ||
+        heaviest == std::numeric_limits<EdgeData>::min()) {
+      GALOIS_DIE("Edge weights of graph out of range");
+    }
+    inf = heaviest + 1;
+
+    Tsort.stop();
+
+    std::cout << "Nodes: " << graph.size() << " edges: " << graph.sizeEdges()
+              << " heaviest edge: " << heaviest << "\n";
+  }
+};
+
 /**
  * Boruvka's algorithm. Implemented bulk-synchronously in order to avoid the
  * need to merge edge lists.
  */
 template <bool useExp>
-struct ParallelAlgo {
+struct ParallelAlgo : public MSTBase {
   struct WorkItem {
     Edge edge;
     int cur;
@@ -88,16 +219,11 @@ struct ParallelAlgo {
 
   typedef galois::InsertBag<WorkItem> WL;
 
-  Graph graph;
-
   WL wls[3];
   WL* current;
   WL* next;
   WL* pending;
   EdgeData limit;
-  galois::InsertBag<Edge> mst;
-  EdgeData inf;
-  EdgeData heaviest;
 
   /**
    * Find lightest edge between components leaving a node and add it to the
@@ -274,111 +400,312 @@ struct ParallelAlgo {
       process();
     }
   }
+};
 
-  bool checkAcyclic(void) {
-    galois::GAccumulator<unsigned> roots;
+/**
+ * Total order on undirected edges used by the edge-list algorithms: by weight,
+ * then by the address of the weight in the graph. Each undirected edge is
+ * represented by its src < dst direction, so the order is strict and the
+ * minimum spanning forest it defines is unique.
+ */
+inline bool lighterEdge(const EdgeData* a, const EdgeData* b) {
+  return *a < *b || (*a == *b && a < b);
+}
 
-    galois::do_all(galois::iterate(graph), [&roots, this](const GNode& n) {
-      const auto& data = graph.getData(n, galois::MethodFlag::UNPROTECTED);
-      if (data.isRep())
-        roots += 1;
-    });
+/**
+ * Filter-Kruskal (Osipov, Sanders and Singler, ALENEX 2009). Edges are split
+ * into NUM_BUCKETS weight ranges with sample-sort splitters, and the buckets
+ * are processed lightest first. Before a bucket is processed, its edges whose
+ * endpoints are already connected are filtered out, so the heavy edges of a
+ * graph are never sorted. Small ranges are sorted and scanned with plain
+ * Kruskal. Partitioning and filtering are parallel; the scans are not.
+ */
+struct FilterKruskal : public MSTBase {
+  /**
+   * The key packs the weight, biased to sort as unsigned, above the index of
+   * the weight in the graph, so that keys compare like lighterEdge does on
+   * the weight addresses.
+   */
+  struct WeightedEdge {
+    uint64_t key;
+    GNode src;
+    GNode dst;
 
-    unsigned numRoots = roots.reduce();
-    unsigned numEdges = std::distance(mst.begin(), mst.end());
+    bool operator<(const WeightedEdge& o) const { return key < o.key; }
+  };
 
-    if (graph.size() - numRoots != numEdges) {
-      std::cerr << "Generated graph is not a forest. "
-                << "Expected " << graph.size() - numRoots << " edges but "
-                << "found " << numEdges << "\n";
-      return false;
-    }
+  constexpr static const unsigned NUM_BUCKETS = 64;
+  //! Sample size per bucket when choosing splitters
+  constexpr static const unsigned OVERSAMPLE = 8;
+  static_assert(NUM_BUCKETS < 256, "bucket ids are stored in a byte");
+
+  //! Ranges up to this size are sorted directly; larger ones must hold a
+  //! distinct edge for every splitter sample
+  const size_t baseSize =
+      std::max<size_t>(kruskalBaseSize, NUM_BUCKETS * OVERSAMPLE);
+
+  galois::LargeArray<WeightedEdge> edges;
+  galois::LargeArray<WeightedEdge> scratch;
+  galois::LargeArray<uint8_t> bucketIds;
+  EdgeData* weights = nullptr;
+  size_t partitions = 0;
+
+  uint64_t makeKey(EdgeData* weight) const {
+    uint32_t biased = uint32_t(*weight) ^ (uint32_t{1} << 31);
+    return (uint64_t(biased) << 32) | uint64_t(weight - weights);
+  }
 
-    std::cout << "Num trees: " << numRoots << "\n";
-    std::cout << "Tree edges: " << numEdges << "\n";
-    return true;
+  EdgeData* weightOf(const WeightedEdge& e) const {
+    return weights + (e.key & 0xFFFFFFFFu);
   }
 
-  EdgeData sortEdges() {
+  bool connected(const WeightedEdge& e) {
+    Node& sdata = graph.getData(e.src, galois::MethodFlag::UNPROTECTED);
+    Node& ddata = graph.getData(e.dst, galois::MethodFlag::UNPROTECTED);
+    return sdata.findAndCompress() == ddata.findAndCompress();
+  }
 
-    galois::GReduceMax<EdgeData> heavy;
+  //! Edge list with one entry per undirected edge
+  void collectEdges() {
+    GALOIS_ASSERT(graph.sizeEdges() <= std::numeric_limits<uint32_t>::max(),
+                  "Filter-Kruskal supports up to 2^32 edges");
+    weights = &graph.getEdgeData(graph.edge_begin(*graph.begin()));
+
+    std::vector<size_t> offsets(graph.size());
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          size_t count = 0;
+          for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+            if (graph.getEdgeDst(ii) > src)
+              ++count;
+          }
+          offsets[src] = count;
+        },
+        galois::steal(), galois::loopname("CountEdges"));
+    galois::ParallelSTL::partial_sum(offsets.begin(), offsets.end(),
+                                     offsets.begin());
+
+    const size_t numEdges = offsets.empty() ? 0 : offsets.back();
+    edges.allocateInterleaved(numEdges);
+    scratch.allocateInterleaved(numEdges);
+    bucketIds.allocateInterleaved(numEdges);
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          size_t pos = src == 0 ? 0 : offsets[src - 1];
+          for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(ii);
+            if (dst > src) {
+              edges[pos++] =
+                  WeightedEdge{makeKey(&graph.getEdgeData(ii)), src, dst};
+            }
+          }
+        },
+        galois::steal(), galois::loopname("CollectEdges"));
+  }
 
-    galois::do_all(galois::iterate(graph), [&heavy, this](const GNode& src) {
-      //! [sortEdgeByEdgeData]
-      graph.sortEdgesByEdgeData(src, std::less<EdgeData>(),
-                                galois::MethodFlag::UNPROTECTED);
-      //! [sortEdgeByEdgeData]
+  /**
+   * Moves the edges in [first, last) into the buckets given by bucketOf, in
+   * bucket order; edges mapped to numBuckets are dropped. Returns the bucket
+   * boundaries.
+   */
+  template <typename BucketFn>
+  std::vector<size_t> distribute(size_t first, size_t last,
+                                 unsigned numBuckets, BucketFn bucketOf) {
+    const unsigned numThreads = galois::getActiveThreads();
+    const size_t blockSize    = (last - first + numThreads - 1) / numThreads;
+    std::vector<size_t> counts(numThreads * numBuckets, 0);
+
+    auto block = [&](unsigned tid) {
+      size_t lo = std::min(first + tid * blockSize, last);
+      return std::make_pair(lo, std::min(lo + blockSize, last));
+    };
 
-      Graph::edge_iterator ii =
-          graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
-      Graph::edge_iterator ei =
-          graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
-      ptrdiff_t dist = std::distance(ii, ei);
-      if (dist == 0)
-        return;
-      std::advance(ii, dist - 1);
-      heavy.update(graph.getEdgeData(ii));
+    galois::on_each([&](unsigned tid, unsigned) {
+      auto range   = block(tid);
+      size_t* mine = &counts[tid * numBuckets];
+      for (size_t i = range.first; i < range.second; ++i) {
+        unsigned b   = bucketOf(edges[i]);
+        bucketIds[i] = b;
+        if (b < numBuckets)
+          ++mine[b];
+      }
     });
 
-    return heavy.reduce();
-  }
+    // bucket-major offsets: bucket b of thread t follows bucket b of t - 1
+    std::vector<size_t> bounds(numBuckets + 1);
+    size_t offset = first;
+    for (unsigned b = 0; b < numBuckets; ++b) {
+      bounds[b] = offset;
+      for (unsigned t = 0; t < numThreads; ++t) {
+        size_t count               = counts[t * numBuckets + b];
+        counts[t * numBuckets + b] = offset;
+        offset += count;
+      }
+    }
+    bounds[numBuckets] = offset;
+
+    galois::on_each([&](unsigned tid, unsigned) {
+      auto range   = block(tid);
+      size_t* next = &counts[tid * numBuckets];
+      for (size_t i = range.first; i < range.second; ++i) {
+        unsigned b = bucketIds[i];
+        if (b < numBuckets)
+          scratch[next[b]++] = edges[i];
+      }
+    });
 
-  bool verify() {
+    galois::do_all(
+        galois::iterate(first, offset),
+        [&](size_t i) { edges[i] = scratch[i]; }, galois::no_stats(),
+        galois::loopname("CopyBack"));
+    return bounds;
+  }
 
-    auto is_bad_graph = [this](const GNode& n) {
-      Node& me = graph.getData(n);
-      for (auto ii : graph.edges(n)) {
-        GNode dst  = graph.getEdgeDst(ii);
-        Node& data = graph.getData(dst);
-        if (me.findAndCompress() != data.findAndCompress()) {
-          std::cerr << "not in same component: " << me << " and " << data
-                    << "\n";
-          return true;
-        }
-      }
-      return false;
-    };
+  void kruskal(size_t first, size_t last) {
+    std::sort(edges.begin() + first, edges.begin() + last);
+    for (size_t i = first; i < last; ++i) {
+      const WeightedEdge& e = edges[i];
+      Node& sdata = graph.getData(e.src, galois::MethodFlag::UNPROTECTED);
+      Node& ddata = graph.getData(e.dst, galois::MethodFlag::UNPROTECTED);
+      if (sdata.merge(&ddata))
+        mst.push(Edge(e.src, e.dst, weightOf(e)));
+    }
+  }
 
-    auto is_bad_mst = [this](const Edge& e) {
-      return graph.getData(e.src).findAndCompress() !=
-             graph.getData(e.dst).findAndCompress();
-    };
+  void filterKruskal(size_t first, size_t last) {
+    if (last - first <= baseSize) {
+      kruskal(first, last);
+      return;
+    }
+    ++partitions;
+
+    // splitters from an evenly spaced sample; they are distinct, so every
+    // bucket but the first holds at least its splitter and the range shrinks
+    std::vector<uint64_t> sample;
+    const size_t stride = (last - first) / (NUM_BUCKETS * OVERSAMPLE);
+    for (size_t i = 0; i < NUM_BUCKETS * OVERSAMPLE; ++i)
+      sample.push_back(edges[first + i * stride].key);
+    std::sort(sample.begin(), sample.end());
+    std::vector<uint64_t> splitters;
+    for (unsigned b = 1; b < NUM_BUCKETS; ++b)
+      splitters.push_back(sample[b * OVERSAMPLE]);
+
+    auto bounds = distribute(first, last, NUM_BUCKETS, [&](const auto& e) {
+      return std::upper_bound(splitters.begin(), splitters.end(), e.key) -
+             splitters.begin();
+    });
 
-    if (galois::ParallelSTL::find_if(graph.begin(), graph.end(),
-                                     is_bad_graph) == graph.end()) {
-      if (galois::ParallelSTL::find_if(mst.begin(), mst.end(), is_bad_mst) ==
-          mst.end()) {
-        return checkAcyclic();
+    for (unsigned b = 0; b < NUM_BUCKETS; ++b) {
+      size_t lo = bounds[b];
+      size_t hi = bounds[b + 1];
+      if (b > 0 && lo < hi) {
+        hi = distribute(lo, hi, 1, [&](const auto& e) {
+               return connected(e) ? 1u : 0u;
+             })[1];
       }
+      filterKruskal(lo, hi);
     }
-    return false;
   }
 
-  void initializeGraph() {
-    galois::graphs::FileGraph origGraph;
-    galois::graphs::FileGraph symGraph;
-
-    origGraph.fromFileInterleaved<EdgeData>(inputFilename);
-    if (!symmetricGraph)
-      galois::graphs::makeSymmetric<EdgeData>(origGraph, symGraph);
-    else
-      std::swap(symGraph, origGraph);
+  void operator()() {
+    collectEdges();
+    filterKruskal(0, edges.size());
+    galois::runtime::reportStat_Single("FilterKruskal", "Partitions",
+                                       partitions);
+  }
+};
 
-    galois::graphs::readGraph(graph, symGraph);
+/**
+ * Boruvka's algorithm on an edge list that is contracted every round: each
+ * component picks its lightest edge, components are merged along them, and
+ * the surviving edges are relabeled to the new components while edges inside
+ * a component are dropped. Late rounds only touch the edges that still
+ * connect different components.
+ */
+struct ContractBoruvka : public MSTBase {
+  struct ComponentEdge {
+    Node* u;
+    Node* v;
+    GNode src;
+    GNode dst;
+    EdgeData* weight;
+  };
 
-    galois::StatTimer Tsort("InitializeSortTime");
-    Tsort.start();
-    heaviest = sortEdges();
-    if (heaviest == std::numeric_limits<EdgeData>::max() ||
-        heaviest == std::numeric_limits<EdgeData>::min()) {
-      GALOIS_DIE("Edge weights of graph out of range");
+  void lighten(Node* rep, EdgeData* weight) {
+    EdgeData* old = rep->lightest;
+    while (lighterEdge(weight, old) &&
+           !rep->lightest.compare_exchange_weak(old, weight)) {
     }
-    inf = heaviest + 1;
+  }
 
-    Tsort.stop();
+  void operator()() {
+    constexpr unsigned CHUNK_SIZE = 64;
+
+    galois::InsertBag<ComponentEdge> bags[2];
+    galois::InsertBag<ComponentEdge>* current = &bags[0];
+    galois::InsertBag<ComponentEdge>* next    = &bags[1];
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](const GNode& src) {
+          Node& sdata    = graph.getData(src, galois::MethodFlag::UNPROTECTED);
+          sdata.lightest = &inf;
+          for (auto ii : graph.edges(src, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(ii);
+            if (dst > src) {
+              Node& ddata = graph.getData(dst, galois::MethodFlag::UNPROTECTED);
+              current->push(ComponentEdge{&sdata, &ddata, src, dst,
+                                          &graph.getEdgeData(ii)});
+            }
+          }
+        },
+        galois::steal(), galois::loopname("CollectEdges"));
 
-    std::cout << "Nodes: " << graph.size() << " edges: " << graph.sizeEdges()
-              << " heaviest edge: " << heaviest << "\n";
+    size_t rounds = 0;
+    while (!current->empty()) {
+      rounds += 1;
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](const ComponentEdge& e) {
+            lighten(e.u, e.weight);
+            lighten(e.v, e.weight);
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("FindLightest"));
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](const ComponentEdge& e) {
+            if ((e.u->lightest == e.weight || e.v->lightest == e.weight) &&
+                e.u->merge(e.v)) {
+              mst.push(Edge(e.src, e.dst, e.weight));
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("Hook"));
+
+      galois::do_all(
+          galois::iterate(*current),
+          [&](const ComponentEdge& e) {
+            Node* u = e.u->findAndCompress();
+            Node* v = e.v->findAndCompress();
+            if (u == v)
+              return;
+            u->lightest = &inf;
+            v->lightest = &inf;
+            next->push(ComponentEdge{u, v, e.src, e.dst, e.weight});
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("Contract"));
+
+      current->clear();
+      std::swap(current, next);
+    }
+
+    galois::runtime::reportStat_Single("Boruvka", "rounds", rounds);
   }
 };
 
@@ -427,6 +754,12 @@ int main(int argc, char** argv) {
   case parallel:
     run<ParallelAlgo<false>>();
     break;
+  case filterKruskal:
+    run<FilterKruskal>();
+    break;
+  case contractBoruvka:
+    run<ContractBoruvka>();
+    break;
   case exp_parallel:
     run<ParallelAlgo<true>>();
     break;
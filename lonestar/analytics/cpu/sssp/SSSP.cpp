@@ -31,6 +31,7 @@
 #include "llvm/Support/CommandLine.h"
 
 #include <iostream>
+#include <random>
 
 namespace cll = llvm::cl;
 
@@ -52,8 +53,20 @@ static cll::opt<unsigned int>
                cll::init(1));
 static cll::opt<unsigned int>
     stepShift("delta",
-              cll::desc("Shift value for the deltastep (default value 13)"),
+              cll::desc("Shift value for the deltastep (default value 13; "
+                        "the auto algorithm samples edge weights and degrees "
+                        "to choose it)"),
               cll::init(13));
+static cll::opt<unsigned int>
+    rho("rho",
+        cll::desc("rhoStep: number of closest frontier nodes settled per step "
+                  "(default value 65536)"),
+        cll::init(1 << 16));
+static cll::opt<unsigned int> radiusRho(
+    "radiusRho",
+    cll::desc("radiusStep: a node's radius is its radiusRho-th lightest edge "
+              "(default value 16)"),
+    cll::init(16));
 
 enum Algo {
   deltaTile = 0,
@@ -65,13 +78,15 @@ enum Algo {
   dijkstra,
   topo,
   topoTile,
+  rhoStep,
+  radiusStep,
   AutoAlgo
 };
 
 const char* const ALGO_NAMES[] = {
     "deltaTile", "deltaStep",    "deltaStepBarrier", "serDeltaTile",
     "serDelta",  "dijkstraTile", "dijkstra",         "topo",
-    "topoTile",  "Auto"};
+    "topoTile",  "rhoStep",      "radiusStep",       "Auto"};
 
 static cll::opt<Algo> algo(
     "algo", cll::desc("Choose an algorithm (default value auto):"),
@@ -83,6 +98,8 @@ static cll::opt<Algo> algo(
                 clEnumVal(dijkstraTile, "dijkstraTile"),
                 clEnumVal(dijkstra, "dijkstra"), clEnumVal(topo, "topo"),
                 clEnumVal(topoTile, "topoTile"),
+                clEnumVal(rhoStep, "rhoStep"),
+                clEnumVal(radiusStep, "radiusStep"),
                 clEnumVal(AutoAlgo,
                           "auto: choose among the algorithms automatically")),
     cll::init(AutoAlgo));
@@ -352,6 +369,168 @@ void topoTileAlgo(Graph& graph, const GNode& source) {
   galois::runtime::reportStat_Single("SSSP-topo", "rounds", rounds);
 }
 
+/**
+ * Stepping framework shared by rho-stepping and radius-stepping (Dong et al.,
+ * 2021; Blelloch et al., 2016). Every step picks a distance threshold from the
+ * current frontier and settles everything at or below it with an OBIM
+ * for_each; relaxations that land above the threshold wait in the frontier of
+ * the next step. Unlike delta-stepping, the amount of work per step is set by
+ * the frontier rather than by a fixed bucket width.
+ */
+template <typename T, typename P, typename R, typename ThresholdFn>
+void steppingAlgo(Graph& graph, GNode source, const P& pushWrap,
+                  const R& edgeRange, const ThresholdFn& chooseThreshold) {
+
+  graph.getData(source) = 0;
+
+  galois::InsertBag<T> frontier;
+  galois::InsertBag<T> next;
+  pushWrap(frontier, source, 0, "parallel");
+
+  size_t steps = 0;
+  while (!frontier.empty()) {
+    ++steps;
+    const Dist threshold = chooseThreshold(frontier);
+
+    galois::for_each(
+        galois::iterate(frontier),
+        [&](const T& item, auto& ctx) {
+          constexpr galois::MethodFlag flag = galois::MethodFlag::UNPROTECTED;
+          const auto& sdata                 = graph.getData(item.src, flag);
+
+          if (sdata < item.dist) {
+            return;
+          }
+          if (item.dist > threshold) {
+            next.push(item);
+            return;
+          }
+
+          for (auto ii : edgeRange(item)) {
+            GNode dst          = graph.getEdgeDst(ii);
+            auto& ddist        = graph.getData(dst, flag);
+            Dist ew            = graph.getEdgeData(ii, flag);
+            const Dist newDist = sdata + ew;
+            Dist oldDist       = galois::atomicMin<uint32_t>(ddist, newDist);
+            if (newDist < oldDist) {
+              if (newDist <= threshold) {
+                pushWrap(ctx, dst, newDist);
+              } else {
+                pushWrap(next, dst, newDist);
+              }
+            }
+          }
+        },
+        galois::wl<OBIM>(UpdateRequestIndexer{stepShift}),
+        galois::disable_conflict_detection(), galois::loopname("SSSP"));
+
+    frontier.clear();
+    std::swap(frontier, next);
+  }
+
+  galois::runtime::reportStat_Single("SSSP", "Steps", steps);
+}
+
+/**
+ * Rho-stepping threshold: the distance of roughly the rho-th closest live item
+ * in the frontier, estimated from a random sample of the frontier, or the
+ * farthest live item if there are at most rho of them.
+ */
+template <typename T>
+struct RhoThreshold {
+  constexpr static const size_t SAMPLES = 1024;
+
+  Graph& graph;
+  mutable galois::substrate::PerThreadStorage<std::minstd_rand> rngs;
+
+  explicit RhoThreshold(Graph& g) : graph(g) {}
+
+  Dist operator()(galois::InsertBag<T>& frontier) const {
+    galois::GAccumulator<size_t> live;
+    galois::GReduceMax<Dist> farthest;
+    galois::do_all(
+        galois::iterate(frontier),
+        [&](const T& item) {
+          if (graph.getData(item.src) >= item.dist) {
+            live += 1;
+            farthest.update(item.dist);
+          }
+        },
+        galois::no_stats(), galois::loopname("CountFrontier"));
+    if (live.reduce() <= rho) {
+      return farthest.reduce();
+    }
+
+    // keep every item with probability SAMPLES / live
+    const uint64_t keep = std::min<uint64_t>(
+        uint64_t{std::minstd_rand::max()} / live.reduce() * SAMPLES,
+        std::minstd_rand::max());
+    galois::InsertBag<Dist> sampleBag;
+    galois::do_all(
+        galois::iterate(frontier),
+        [&](const T& item) {
+          if (graph.getData(item.src) >= item.dist &&
+              (*rngs.getLocal())() < keep) {
+            sampleBag.push(item.dist);
+          }
+        },
+        galois::no_stats(), galois::loopname("SampleFrontier"));
+    std::vector<Dist> samples(sampleBag.begin(), sampleBag.end());
+    if (samples.empty()) {
+      return SSSP::DIST_INFINITY;
+    }
+    auto nth = samples.begin() + samples.size() * rho / live.reduce();
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+  }
+};
+
+/**
+ * Radius-stepping threshold: the smallest distance plus radius over the live
+ * frontier. The radius of a node approximates the distance to its
+ * radiusRho-th nearest node by its radiusRho-th lightest out-edge.
+ */
+template <typename T>
+struct RadiusThreshold {
+  Graph& graph;
+  galois::LargeArray<Dist> radius;
+
+  explicit RadiusThreshold(Graph& g) : graph(g) {
+    radius.allocateInterleaved(graph.size());
+    galois::substrate::PerThreadStorage<std::vector<Dist>> weights;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          std::vector<Dist>& w = *weights.getLocal();
+          w.clear();
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            w.push_back(graph.getEdgeData(e));
+          }
+          if (w.empty()) {
+            radius[n] = 0;
+            return;
+          }
+          auto nth = w.begin() + std::min<size_t>(radiusRho, w.size()) - 1;
+          std::nth_element(w.begin(), nth, w.end());
+          radius[n] = *nth;
+        },
+        galois::steal(), galois::no_stats(), galois::loopname("Radius"));
+  }
+
+  Dist operator()(galois::InsertBag<T>& frontier) const {
+    galois::GReduceMin<uint64_t> threshold;
+    galois::do_all(
+        galois::iterate(frontier),
+        [&](const T& item) {
+          if (graph.getData(item.src) >= item.dist) {
+            threshold.update(uint64_t{item.dist} + radius[item.src]);
+          }
+        },
+        galois::no_stats(), galois::loopname("FrontierRadius"));
+    return std::min<uint64_t>(threshold.reduce(), SSSP::DIST_INFINITY);
+  }
+};
+
 int main(int argc, char** argv) {
   galois::SharedMemSys G;
   LonestarStart(argc, argv, name, desc, url, &inputFile);
@@ -414,8 +593,17 @@ int main(int argc, char** argv) {
     } else {
       algo = deltaStepBarrier;
     }
+    if (!stepShift.getNumOccurrences()) {
+      galois::StatTimer deltaTimer("ChooseDelta");
+      deltaTimer.start();
+      stepShift = chooseDeltaShift(graph);
+      deltaTimer.stop();
+      galois::runtime::reportStat_Single("SSSP", "DeltaShift",
+                                         stepShift.getValue());
+    }
     autoAlgoTimer.stop();
-    galois::gInfo("Choosing ", ALGO_NAMES[algo], " algorithm");
+    galois::gInfo("Choosing ", ALGO_NAMES[algo], " algorithm with delta ",
+                  1 << stepShift);
   }
 
   switch (algo) {
@@ -449,6 +637,16 @@ int main(int argc, char** argv) {
   case topoTile:
     topoTileAlgo(graph, source);
     break;
+  case rhoStep:
+    steppingAlgo<UpdateRequest>(graph, source, ReqPushWrap(),
+                                OutEdgeRangeFn{graph},
+                                RhoThreshold<UpdateRequest>{graph});
+    break;
+  case radiusStep:
+    steppingAlgo<UpdateRequest>(graph, source, ReqPushWrap(),
+                                OutEdgeRangeFn{graph},
+                                RadiusThreshold<UpdateRequest>{graph});
+    break;
 
   case deltaStepBarrier:
     deltaStepAlgo<UpdateRequest, OBIM_Barrier>(graph, source, ReqPushWrap(),
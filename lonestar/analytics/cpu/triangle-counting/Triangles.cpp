@@ -21,6 +21,7 @@
 #include "galois/Bag.h"
 #include "galois/ParallelSTL.h"
 #include "galois/Reduction.h"
+#include "galois/SetIntersect.h"
 #include "galois/Timer.h"
 #include "galois/graphs/LCGraph.h"
 #include "galois/graphs/BufferedGraph.h"
@@ -61,6 +62,13 @@ static cll::opt<bool>
                       "choose automatically)"),
             cll::init(false));
 
+static cll::opt<unsigned int>
+    hubDegree("hubDegree",
+              cll::desc("Lower-ordered neighbor count from which orderedCount "
+                        "intersects against a per-thread bitmap instead of "
+                        "merging (0 disables; default value 2048)"),
+              cll::init(2048));
+
 typedef galois::graphs::LC_CSR_Graph<void, void>::with_numa_alloc<
     true>::type ::with_no_lockable<true>::type Graph;
 
@@ -101,21 +109,8 @@ template <typename G>
 size_t countEqual(G& g, typename G::edge_iterator aa,
                   typename G::edge_iterator ea, typename G::edge_iterator bb,
                   typename G::edge_iterator eb) {
-  size_t retval = 0;
-  while (aa != ea && bb != eb) {
-    typename G::GraphNode a = g.getEdgeDst(aa);
-    typename G::GraphNode b = g.getEdgeDst(bb);
-    if (a < b) {
-      ++aa;
-    } else if (b < a) {
-      ++bb;
-    } else {
-      retval += 1;
-      ++aa;
-      ++bb;
-    }
-  }
-  return retval;
+  const uint32_t* dst = g.edgeDstArray();
+  return galois::intersectCount(dst + *aa, *ea - *aa, dst + *bb, *eb - *bb);
 }
 
 template <typename G>
@@ -237,29 +232,43 @@ void nodeIteratingAlgo(Graph& graph) {
 }
 
 /**
- * Lambda function to count triangles
+ * Lambda function to count triangles. Counts, for each lower-ordered neighbor
+ * v of n, the common neighbors of n and v ordered below v. If n has many
+ * lower-ordered neighbors, they are marked in a bitmap once rather than
+ * merged against every N(v).
  */
 void orderedCountFunc(Graph& graph, GNode n,
+                      galois::setintersect::Bitmap& bitmap,
                       galois::GAccumulator<size_t>& numTriangles) {
+  const uint32_t* dst = graph.edgeDstArray();
+  const uint32_t* nBegin =
+      dst + *graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
+  const uint32_t* nEnd = std::upper_bound(
+      nBegin, dst + *graph.edge_end(n, galois::MethodFlag::UNPROTECTED), n);
+  bool useBitmap = hubDegree && size_t(nEnd - nBegin) >= hubDegree;
+  if (useBitmap) {
+    bitmap.mark(nBegin, nEnd - nBegin);
+  }
+
   size_t numTriangles_local = 0;
-  for (auto it_v : graph.edges(n)) {
-    auto v = graph.getEdgeDst(it_v);
-    if (v > n)
-      break;
-    Graph::edge_iterator it_n =
-        graph.edge_begin(n, galois::MethodFlag::UNPROTECTED);
-
-    for (auto it_vv : graph.edges(v)) {
-      auto vv = graph.getEdgeDst(it_vv);
-      if (vv > v)
-        break;
-      while (graph.getEdgeDst(it_n) < vv)
-        it_n++;
-      if (vv == graph.getEdgeDst(it_n)) {
-        numTriangles_local += 1;
-      }
+  for (const uint32_t* it_v = nBegin; it_v != nEnd; ++it_v) {
+    GNode v = *it_v;
+    const uint32_t* vBegin =
+        dst + *graph.edge_begin(v, galois::MethodFlag::UNPROTECTED);
+    const uint32_t* vEnd = std::upper_bound(
+        vBegin, dst + *graph.edge_end(v, galois::MethodFlag::UNPROTECTED), v);
+    if (useBitmap) {
+      numTriangles_local += bitmap.count(vBegin, vEnd - vBegin);
+    } else {
+      numTriangles_local +=
+          galois::intersectCount(nBegin, it_v - nBegin + 1, vBegin,
+                                 size_t(vEnd - vBegin));
     }
   }
+
+  if (useBitmap) {
+    bitmap.unmark(nBegin, nEnd - nBegin);
+  }
   numTriangles += numTriangles_local;
 }
 
@@ -268,9 +277,18 @@ void orderedCountFunc(Graph& graph, GNode n,
  */
 void orderedCountAlgo(Graph& graph) {
   galois::GAccumulator<size_t> numTriangles;
+  galois::substrate::PerThreadStorage<galois::setintersect::Bitmap> bitmaps;
+  if (hubDegree) {
+    galois::on_each([&](unsigned, unsigned) {
+      bitmaps.getLocal()->resize(graph.size());
+    });
+  }
+
   galois::do_all(
       galois::iterate(graph),
-      [&](const GNode& n) { orderedCountFunc(graph, n, numTriangles); },
+      [&](const GNode& n) {
+        orderedCountFunc(graph, n, *bitmaps.getLocal(), numTriangles);
+      },
       galois::chunk_size<CHUNK_SIZE>(), galois::steal(),
       galois::loopname("orderedCountAlgo"));
 
@@ -116,6 +116,19 @@ std::unique_ptr<galois::graphs::GluonSubstrate<Graph>> syncSubstrate;
 // sync structures
 #include "bc_level_sync.hh"
 
+//! Checkpointed state: centrality is the only field kept across sources
+struct Checkpoint_betweeness_centrality {
+  typedef float ValTy;
+
+  static ValTy extract(uint32_t, const struct NodeData& node) {
+    return node.betweeness_centrality;
+  }
+
+  static void setVal(uint32_t, struct NodeData& node, ValTy y) {
+    node.betweeness_centrality = y;
+  }
+};
+
 /******************************************************************************/
 /* Functors for running the algorithm */
 /******************************************************************************/
@@ -694,7 +707,12 @@ int main(int argc, char** argv) {
 
     galois::StatTimer StatTimer_main(timer_str.c_str(), REGION_NAME);
 
-    for (uint64_t i = 0; i < loop_end; i++) {
+    // resume after the last checkpointed source if restarting
+    uint32_t sourcesDone = 0;
+    syncSubstrate->checkpointApplyNodeData<Checkpoint_betweeness_centrality>(
+        sourcesDone);
+
+    for (uint64_t i = sourcesDone; i < loop_end; i++) {
       if (singleSourceBC) {
         // only 1 source; specified start source in command line
         assert(loop_end == 1);
@@ -736,6 +754,9 @@ int main(int argc, char** argv) {
             REGION_NAME, std::string("TotalRounds_") + std::to_string(run),
             globalRoundNumber + backRounds);
       }
+
+      syncSubstrate->checkpointSaveNodeData<Checkpoint_betweeness_centrality>(
+          i + 1);
     }
 
     Sanity::go(*h_graph, dga_max, dga_min, dga_sum);
@@ -217,6 +217,12 @@ struct SGD {
     galois::gPrint("Nodes with edges on : ", net.ID, " : ",
                    std::distance(nodesWithEdges.begin(), nodesWithEdges.end()),
                    "\n");
+
+    // resume from the last checkpointed iteration if restarting; residuals
+    // are zero between iterations, so the latent vectors are all the state
+    syncSubstrate->checkpointApplyNodeData<Reduce_set_latent_vector>(
+        _num_iterations);
+
     do {
       galois::gPrint("ITERATION : ", _num_iterations, "\n");
 
@@ -241,6 +247,9 @@ struct SGD {
       rms_normalized = std::sqrt(dga.reduce() / _graph.globalSizeEdges());
       galois::gDebug("RMS Normalized : ", rms_normalized);
       galois::gPrint("RMS Normalized: ", rms_normalized, "\n");
+
+      syncSubstrate->checkpointSaveNodeData<Reduce_set_latent_vector>(
+          _num_iterations);
     } while ((_num_iterations < maxIterations) && (rms_normalized > 1));
 
     if (galois::runtime::getSystemNetworkInterface().ID == 0) {
@@ -52,6 +52,11 @@ static cll::opt<unsigned int>
     maxIterations("maxIterations",
                   cll::desc("Maximum iterations: Default 1000"),
                   cll::init(1000));
+static cll::opt<unsigned int>
+    topK("topK",
+         cll::desc("Number of highest ranked nodes to print after the sanity "
+                   "check (computed on CPU hosts only): Default 0"),
+         cll::init(0));
 
 enum Exec { Sync, Async };
 
@@ -270,6 +275,25 @@ struct PageRank {
 #else
         abort();
 #endif
+      } else if (personality == CPU && !async) {
+        // pull into mirrors first so that their residuals are on the wire
+        // while the masters pull; masters are local ids [0, numMasters)
+        uint32_t numMasters = _graph.numMasters();
+        uint32_t numEdged   = _graph.getNumNodesWithEdges();
+        uint32_t mastersEnd = std::min(numMasters, numEdged);
+        galois::do_all(
+            galois::iterate(mastersEnd, numEdged), PageRank{&_graph},
+            galois::steal(), galois::no_stats(),
+            galois::loopname(
+                syncSubstrate->get_run_identifier("PageRank").c_str()));
+        syncSubstrate->syncStart<writeSource, readDestination,
+                                 Reduce_add_residual, Bitset_residual>(
+            "PageRank");
+        galois::do_all(
+            galois::iterate(0u, mastersEnd), PageRank{&_graph},
+            galois::steal(), galois::no_stats(),
+            galois::loopname(
+                syncSubstrate->get_run_identifier("PageRank").c_str()));
       } else if (personality == CPU) {
         galois::do_all(
             galois::iterate(nodesWithEdges), PageRank{&_graph}, galois::steal(),
@@ -278,8 +302,14 @@ struct PageRank {
                 syncSubstrate->get_run_identifier("PageRank").c_str()));
       }
 
-      syncSubstrate->sync<writeSource, readDestination, Reduce_add_residual,
-                          Bitset_residual, async>("PageRank");
+      if (personality == CPU && !async) {
+        syncSubstrate->syncWait<writeSource, readDestination,
+                                Reduce_add_residual, Bitset_residual>(
+            "PageRank");
+      } else {
+        syncSubstrate->sync<writeSource, readDestination, Reduce_add_residual,
+                            Bitset_residual, async>("PageRank");
+      }
 
       galois::runtime::reportStat_Tsum(
           REGION_NAME, "NumWorkItems_" + (syncSubstrate->get_run_identifier()),
@@ -411,6 +441,26 @@ struct PageRankSanity {
       galois::gPrint("Max residual is ", max_res, "\n");
       galois::gPrint("Min residual is ", min_res, "\n");
     }
+
+    if (topK) {
+      // merged over a tree of hosts instead of gathering ranks at host 0
+      galois::DGTopK<std::pair<float, uint64_t>> top(topK);
+      if (personality == CPU) {
+        galois::do_all(
+            galois::iterate(_graph.masterNodesRange().begin(),
+                            _graph.masterNodesRange().end()),
+            [&](GNode src) {
+              top.update(std::make_pair(_graph.getData(src).value,
+                                        _graph.getGID(src)));
+            },
+            galois::no_stats(), galois::loopname("PageRankTopK"));
+      }
+      const auto& ranks = top.reduce();
+      if (galois::runtime::getSystemNetworkInterface().ID == 0) {
+        for (auto& r : ranks)
+          galois::gPrint("Top rank node ", r.second, " ", r.first, "\n");
+      }
+    }
   }
 
   /* Gets the max, min rank from all owned nodes and
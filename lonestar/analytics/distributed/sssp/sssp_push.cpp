@@ -215,6 +215,9 @@ struct SSSP {
     else
       priority = 0;
     DGTerminatorDetector dga;
+    // async termination depends on the sync messages, so only the bulk
+    // synchronous CPU version can overlap the two
+    const bool overlapTermination = !async && personality == CPU;
     DGAccumulatorTy work_edges;
 
     do {
@@ -247,15 +250,30 @@ struct SSSP {
             galois::steal());
       }
 
-      syncSubstrate->sync<writeDestination, readSource, Reduce_min_dist_current,
-                          Bitset_dist_current, async>("SSSP");
+      if (overlapTermination) {
+        // the min reduction is sent to the masters while the termination
+        // all-reduce is in progress; it only depends on this round's count
+        syncSubstrate->syncStart<writeDestination, readSource,
+                                 Reduce_min_dist_current, Bitset_dist_current>(
+            "SSSP");
+        dga.reduce(syncSubstrate->get_run_identifier());
+        syncSubstrate->syncWait<writeDestination, readSource,
+                                Reduce_min_dist_current, Bitset_dist_current>(
+            "SSSP");
+      } else {
+        syncSubstrate->sync<writeDestination, readSource,
+                            Reduce_min_dist_current, Bitset_dist_current,
+                            async>("SSSP");
+      }
 
       galois::runtime::reportStat_Tsum(
           "SSSP", "NumWorkItems_" + (syncSubstrate->get_run_identifier()),
           work_edges.read_local());
       ++_num_iterations;
     } while ((async || (_num_iterations < maxIterations)) &&
-             dga.reduce(syncSubstrate->get_run_identifier()));
+             (overlapTermination
+                  ? dga.read()
+                  : dga.reduce(syncSubstrate->get_run_identifier())));
 
     galois::runtime::reportStat_Tmax(
         "SSSP", "NumIterations_" + std::to_string(syncSubstrate->get_run_num()),
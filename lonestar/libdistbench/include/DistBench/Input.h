@@ -44,9 +44,13 @@ enum PARTITIONING_SCHEME {
   // CEC,                   //!< custom edge cut
   GINGER_O, //!< Ginger, outgoing
   GINGER_I, //!< Ginger, incoming
-  FENNEL_O, //!< Fennel, oec
-  FENNEL_I, //!< Fennel, iec
-  SUGAR_O   //!< Sugar, oec
+  FENNEL_O,          //!< Fennel, oec
+  FENNEL_I,          //!< Fennel, iec
+  SUGAR_O,           //!< Sugar, oec
+  FENNEL_RESTREAM_O, //!< restreaming Fennel, oec
+  FENNEL_RESTREAM_I, //!< restreaming Fennel, iec
+  LDG_RESTREAM_O,    //!< restreaming LDG, oec
+  LDG_RESTREAM_I     //!< restreaming LDG, iec
 };
 
 /**
@@ -81,6 +85,14 @@ inline const char* EnumToString(PARTITIONING_SCHEME e) {
     return "fennel-iec";
   case SUGAR_O:
     return "sugar-oec";
+  case FENNEL_RESTREAM_O:
+    return "fennel-restream-oec";
+  case FENNEL_RESTREAM_I:
+    return "fennel-restream-iec";
+  case LDG_RESTREAM_O:
+    return "ldg-restream-oec";
+  case LDG_RESTREAM_I:
+    return "ldg-restream-iec";
   default:
     GALOIS_DIE("unsupported partition scheme: ", e);
   }
@@ -109,6 +121,10 @@ extern cll::opt<std::string> localGraphFileName;
 extern cll::opt<bool> saveLocalGraph;
 //! file specifying blocking of masters
 extern cll::opt<std::string> mastersFile;
+//! passes over the edges made by restreaming partitioners
+extern cll::opt<uint32_t> restreamPasses;
+//! allowed load imbalance for restreaming partitioners
+extern cll::opt<double> restreamImbalance;
 
 // @todo command line argument for read balancing across hosts
 
@@ -120,6 +136,31 @@ template <typename NodeData, typename EdgeData>
 using DistGraphPtr =
     std::unique_ptr<galois::graphs::DistGraph<NodeData, EdgeData>>;
 
+/**
+ * Partitions the input with CuSP, or reads this host's partition from
+ * localGraphFileName if -readFromFile is set.
+ *
+ * @tparam PartitionPolicy CuSP policy; must match the policy used when the
+ * local graph was saved
+ * @tparam NodeData node data to store in graph
+ * @tparam EdgeData edge data to store in graph
+ * @returns a pointer to a newly allocated DistGraph
+ */
+template <typename PartitionPolicy, typename NodeData, typename EdgeData>
+DistGraphPtr<NodeData, EdgeData>
+partitionOrReadGraph(const std::string& graphFile,
+                     galois::CUSP_GRAPH_TYPE inputType,
+                     galois::CUSP_GRAPH_TYPE outputType, bool symmetric,
+                     const std::string& transposeGraphFile,
+                     const std::string& masterBlockFile = "") {
+  RestreamOptions::passes    = restreamPasses;
+  RestreamOptions::imbalance = restreamImbalance;
+  return galois::cuspPartitionGraph<PartitionPolicy, NodeData, EdgeData>(
+      graphFile, inputType, outputType, symmetric, transposeGraphFile,
+      masterBlockFile, true, 100, galois::graphs::BALANCED_EDGES_OF_MASTERS, 0,
+      0, readFromFile, localGraphFileName);
+}
+
 /**
  * Loads a symmetric graph file (i.e. directed graph with edges in both
  * directions)
@@ -142,18 +183,18 @@ constructSymmetricGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
   switch (partitionScheme) {
   case OEC:
   case IEC:
-    return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
-        inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true, inputFileTranspose,
-        mastersFile);
+    return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
+        inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
+        inputFileTranspose, mastersFile);
   case HOVC:
   case HIVC:
-    return galois::cuspPartitionGraph<GenericHVC, NodeData, EdgeData>(
+    return partitionOrReadGraph<GenericHVC, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
         inputFileTranspose);
 
   case CART_VCUT:
   case CART_VCUT_IEC:
-    return galois::cuspPartitionGraph<GenericCVC, NodeData, EdgeData>(
+    return partitionOrReadGraph<GenericCVC, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
         inputFileTranspose);
 
@@ -163,18 +204,30 @@ constructSymmetricGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
 
   case GINGER_O:
   case GINGER_I:
-    return galois::cuspPartitionGraph<GingerP, NodeData, EdgeData>(
+    return partitionOrReadGraph<GingerP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
         inputFileTranspose);
 
   case FENNEL_O:
   case FENNEL_I:
-    return galois::cuspPartitionGraph<FennelP, NodeData, EdgeData>(
+    return partitionOrReadGraph<FennelP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
         inputFileTranspose);
 
   case SUGAR_O:
-    return galois::cuspPartitionGraph<SugarP, NodeData, EdgeData>(
+    return partitionOrReadGraph<SugarP, NodeData, EdgeData>(
+        inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
+        inputFileTranspose);
+
+  case FENNEL_RESTREAM_O:
+  case FENNEL_RESTREAM_I:
+    return partitionOrReadGraph<FennelRestreamP, NodeData, EdgeData>(
+        inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
+        inputFileTranspose);
+
+  case LDG_RESTREAM_O:
+  case LDG_RESTREAM_I:
+    return partitionOrReadGraph<LDGRestreamP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, true,
         inputFileTranspose);
   default:
@@ -203,19 +256,19 @@ constructGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
   // 1 host = no concept of cut; just load from edgeCut, no transpose
   auto& net = galois::runtime::getSystemNetworkInterface();
   if (net.Num == 1) {
-    return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
+    return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
         inputFileTranspose);
   }
 
   switch (partitionScheme) {
   case OEC:
-    return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
+    return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
         inputFileTranspose, mastersFile);
   case IEC:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
+      return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSR, false,
           inputFileTranspose, mastersFile);
     } else {
@@ -224,12 +277,12 @@ constructGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
     }
 
   case HOVC:
-    return galois::cuspPartitionGraph<GenericHVC, NodeData, EdgeData>(
+    return partitionOrReadGraph<GenericHVC, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
         inputFileTranspose);
   case HIVC:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<GenericHVC, NodeData, EdgeData>(
+      return partitionOrReadGraph<GenericHVC, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSR, false,
           inputFileTranspose);
     } else {
@@ -238,13 +291,13 @@ constructGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
     }
 
   case CART_VCUT:
-    return galois::cuspPartitionGraph<GenericCVC, NodeData, EdgeData>(
+    return partitionOrReadGraph<GenericCVC, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
         inputFileTranspose);
 
   case CART_VCUT_IEC:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<GenericCVC, NodeData, EdgeData>(
+      return partitionOrReadGraph<GenericCVC, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSR, false,
           inputFileTranspose);
     } else {
@@ -257,12 +310,12 @@ constructGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
     //                                 scaleFactor, vertexIDMapFileName, false);
 
   case GINGER_O:
-    return galois::cuspPartitionGraph<GingerP, NodeData, EdgeData>(
+    return partitionOrReadGraph<GingerP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
         inputFileTranspose);
   case GINGER_I:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<GingerP, NodeData, EdgeData>(
+      return partitionOrReadGraph<GingerP, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSR, false,
           inputFileTranspose);
     } else {
@@ -271,12 +324,12 @@ constructGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
     }
 
   case FENNEL_O:
-    return galois::cuspPartitionGraph<FennelP, NodeData, EdgeData>(
+    return partitionOrReadGraph<FennelP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
         inputFileTranspose);
   case FENNEL_I:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<FennelP, NodeData, EdgeData>(
+      return partitionOrReadGraph<FennelP, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSR, false,
           inputFileTranspose);
     } else {
@@ -285,9 +338,37 @@ constructGraph(std::vector<unsigned>& GALOIS_UNUSED(scaleFactor)) {
     }
 
   case SUGAR_O:
-    return galois::cuspPartitionGraph<SugarP, NodeData, EdgeData>(
+    return partitionOrReadGraph<SugarP, NodeData, EdgeData>(
+        inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
+        inputFileTranspose);
+
+  case FENNEL_RESTREAM_O:
+    return partitionOrReadGraph<FennelRestreamP, NodeData, EdgeData>(
+        inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
+        inputFileTranspose);
+  case FENNEL_RESTREAM_I:
+    if (inputFileTranspose.size()) {
+      return partitionOrReadGraph<FennelRestreamP, NodeData, EdgeData>(
+          inputFile, galois::CUSP_CSC, galois::CUSP_CSR, false,
+          inputFileTranspose);
+    } else {
+      GALOIS_DIE("Restreaming Fennel requires transpose graph");
+      break;
+    }
+
+  case LDG_RESTREAM_O:
+    return partitionOrReadGraph<LDGRestreamP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSR, false,
         inputFileTranspose);
+  case LDG_RESTREAM_I:
+    if (inputFileTranspose.size()) {
+      return partitionOrReadGraph<LDGRestreamP, NodeData, EdgeData>(
+          inputFile, galois::CUSP_CSC, galois::CUSP_CSR, false,
+          inputFileTranspose);
+    } else {
+      GALOIS_DIE("Restreaming LDG requires transpose graph");
+      break;
+    }
 
   default:
     GALOIS_DIE("partition scheme specified is invalid: ", partitionScheme);
@@ -317,7 +398,7 @@ DistGraphPtr<NodeData, EdgeData> constructGraph(std::vector<unsigned>&) {
   // 1 host = no concept of cut; just load from edgeCut
   if (net.Num == 1) {
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
+      return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
           inputFileTranspose);
     } else {
@@ -325,7 +406,7 @@ DistGraphPtr<NodeData, EdgeData> constructGraph(std::vector<unsigned>&) {
                       "transpose to iterate over in-edges: pass in transpose "
                       "graph with -graphTranspose to avoid unnecessary "
                       "overhead.\n");
-      return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
+      return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
           inputFileTranspose);
     }
@@ -333,12 +414,12 @@ DistGraphPtr<NodeData, EdgeData> constructGraph(std::vector<unsigned>&) {
 
   switch (partitionScheme) {
   case OEC:
-    return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
+    return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
         inputFileTranspose, mastersFile);
   case IEC:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<NoCommunication, NodeData, EdgeData>(
+      return partitionOrReadGraph<NoCommunication, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
           inputFileTranspose, mastersFile);
     } else {
@@ -347,12 +428,12 @@ DistGraphPtr<NodeData, EdgeData> constructGraph(std::vector<unsigned>&) {
     }
 
   case HOVC:
-    return galois::cuspPartitionGraph<GenericHVC, NodeData, EdgeData>(
+    return partitionOrReadGraph<GenericHVC, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
         inputFileTranspose);
   case HIVC:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<GenericHVC, NodeData, EdgeData>(
+      return partitionOrReadGraph<GenericHVC, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
           inputFileTranspose);
     } else {
@@ -361,27 +442,26 @@ DistGraphPtr<NodeData, EdgeData> constructGraph(std::vector<unsigned>&) {
     }
 
   case CART_VCUT:
-    return galois::cuspPartitionGraph<GenericCVCColumnFlip, NodeData, EdgeData>(
+    return partitionOrReadGraph<GenericCVCColumnFlip, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
         inputFileTranspose);
   case CART_VCUT_IEC:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<GenericCVCColumnFlip, NodeData,
-                                        EdgeData>(inputFile, galois::CUSP_CSC,
-                                                  galois::CUSP_CSC, false,
-                                                  inputFileTranspose);
+      return partitionOrReadGraph<GenericCVCColumnFlip, NodeData, EdgeData>(
+          inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
+          inputFileTranspose);
     } else {
       GALOIS_DIE("cvc requires transpose graph");
       break;
     }
 
   case GINGER_O:
-    return galois::cuspPartitionGraph<GingerP, NodeData, EdgeData>(
+    return partitionOrReadGraph<GingerP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
         inputFileTranspose);
   case GINGER_I:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<GingerP, NodeData, EdgeData>(
+      return partitionOrReadGraph<GingerP, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
           inputFileTranspose);
     } else {
@@ -390,12 +470,12 @@ DistGraphPtr<NodeData, EdgeData> constructGraph(std::vector<unsigned>&) {
     }
 
   case FENNEL_O:
-    return galois::cuspPartitionGraph<FennelP, NodeData, EdgeData>(
+    return partitionOrReadGraph<FennelP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
         inputFileTranspose);
   case FENNEL_I:
     if (inputFileTranspose.size()) {
-      return galois::cuspPartitionGraph<FennelP, NodeData, EdgeData>(
+      return partitionOrReadGraph<FennelP, NodeData, EdgeData>(
           inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
           inputFileTranspose);
     } else {
@@ -404,10 +484,38 @@ DistGraphPtr<NodeData, EdgeData> constructGraph(std::vector<unsigned>&) {
     }
 
   case SUGAR_O:
-    return galois::cuspPartitionGraph<SugarColumnFlipP, NodeData, EdgeData>(
+    return partitionOrReadGraph<SugarColumnFlipP, NodeData, EdgeData>(
         inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
         inputFileTranspose);
 
+  case FENNEL_RESTREAM_O:
+    return partitionOrReadGraph<FennelRestreamP, NodeData, EdgeData>(
+        inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
+        inputFileTranspose);
+  case FENNEL_RESTREAM_I:
+    if (inputFileTranspose.size()) {
+      return partitionOrReadGraph<FennelRestreamP, NodeData, EdgeData>(
+          inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
+          inputFileTranspose);
+    } else {
+      GALOIS_DIE("Restreaming Fennel requires transpose graph");
+      break;
+    }
+
+  case LDG_RESTREAM_O:
+    return partitionOrReadGraph<LDGRestreamP, NodeData, EdgeData>(
+        inputFile, galois::CUSP_CSR, galois::CUSP_CSC, false,
+        inputFileTranspose);
+  case LDG_RESTREAM_I:
+    if (inputFileTranspose.size()) {
+      return partitionOrReadGraph<LDGRestreamP, NodeData, EdgeData>(
+          inputFile, galois::CUSP_CSC, galois::CUSP_CSC, false,
+          inputFileTranspose);
+    } else {
+      GALOIS_DIE("Restreaming LDG requires transpose graph");
+      break;
+    }
+
   default:
     GALOIS_DIE("partition scheme specified is invalid: ", partitionScheme);
     return DistGraphPtr<NodeData, EdgeData>(nullptr);
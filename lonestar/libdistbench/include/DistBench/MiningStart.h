@@ -186,6 +186,9 @@ distGraphInitialization(
   // hence the use of ! to negate
   s = std::make_unique<Substrate>(*g, net.ID, net.Num, !loadProxyEdges,
                                   commMetadata);
+#ifdef GALOIS_ENABLE_GPU
+  s->set_compressed_offsets(personality_set.find('g') == std::string::npos);
+#endif
 
 // marshal graph to GPU as necessary
 #ifdef GALOIS_ENABLE_GPU
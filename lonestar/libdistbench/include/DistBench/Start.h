@@ -45,6 +45,18 @@ extern cll::opt<std::string> statFile;
 extern cll::opt<bool> partitionAgnostic;
 //! Set method for metadata sends
 extern cll::opt<DataCommMode> commMetadata;
+//! Shared nodes per sync message (0 = no pipelining)
+extern cll::opt<unsigned> syncChunkSize;
+//! Directory for node data checkpoints (empty = no checkpoints)
+extern cll::opt<std::string> checkpointDir;
+//! Expected seconds between failures, for the checkpoint interval
+extern cll::opt<double> checkpointMTBF;
+//! Resume from the last complete checkpoint
+extern cll::opt<bool> checkpointRestart;
+//! Report partition quality and estimated sync volume after partitioning
+extern cll::opt<bool> partitionReport;
+//! Value size assumed by the sync volume estimate
+extern cll::opt<unsigned> reportValueBytes;
 //! Where to write output if output is set
 extern cll::opt<std::string> outputLocation;
 extern cll::opt<bool> output;
@@ -152,8 +164,9 @@ loadDistGraph(std::vector<unsigned>& scaleFactor) {
   dGraphTimer.stop();
 
   // Save local graph structure
-  // if (saveLocalGraph)
-  //  (*loadedGraph).save_local_graph_to_file(localGraphFileName);
+  if (saveLocalGraph && !readFromFile) {
+    loadedGraph->save_local_graph_to_file(localGraphFileName);
+  }
 
   return loadedGraph;
 }
@@ -194,8 +207,9 @@ loadSymmetricDistGraph(std::vector<unsigned>& scaleFactor) {
   dGraphTimer.stop();
 
   // Save local graph structure
-  // if (saveLocalGraph)
-  //  (*loadedGraph).save_local_graph_to_file(localGraphFileName);
+  if (saveLocalGraph && !readFromFile) {
+    loadedGraph->save_local_graph_to_file(localGraphFileName);
+  }
 
   return loadedGraph;
 }
@@ -238,6 +252,15 @@ distGraphInitialization() {
   s = std::make_unique<Substrate>(*g, net.ID, net.Num, g->isTransposed(),
                                   g->cartesianGrid(), partitionAgnostic,
                                   commMetadata);
+  s->set_sync_chunk_size(syncChunkSize);
+#ifdef GALOIS_ENABLE_GPU
+  s->set_compressed_offsets(personality_set.find('g') == std::string::npos);
+#endif
+  s->set_checkpoint_options(checkpointDir, checkpointMTBF, checkpointRestart);
+  if (partitionReport) {
+    g->reportPartitionQuality();
+    s->reportSyncVolumeEstimate(reportValueBytes);
+  }
 
 // marshal graph to GPU as necessary
 #ifdef GALOIS_ENABLE_GPU
@@ -283,6 +306,15 @@ symmetricDistGraphInitialization() {
   s = std::make_unique<Substrate>(*g, net.ID, net.Num, g->isTransposed(),
                                   g->cartesianGrid(), partitionAgnostic,
                                   commMetadata);
+  s->set_sync_chunk_size(syncChunkSize);
+#ifdef GALOIS_ENABLE_GPU
+  s->set_compressed_offsets(personality_set.find('g') == std::string::npos);
+#endif
+  s->set_checkpoint_options(checkpointDir, checkpointMTBF, checkpointRestart);
+  if (partitionReport) {
+    g->reportPartitionQuality();
+    s->reportSyncVolumeEstimate(reportValueBytes);
+  }
 
 // marshal graph to GPU as necessary
 #ifdef GALOIS_ENABLE_GPU
@@ -57,26 +57,47 @@ cll::opt<PARTITIONING_SCHEME> partitionScheme(
         clEnumValN(FENNEL_I, "fennel-i",
                    "fennel, incoming edge cut, using CuSP"),
         clEnumValN(SUGAR_O, "sugar-o",
-                   "fennel, incoming edge cut, using CuSP")),
+                   "fennel, incoming edge cut, using CuSP"),
+        clEnumValN(FENNEL_RESTREAM_O, "fennel-restream-o",
+                   "restreaming fennel, outgoing edge cut, using CuSP"),
+        clEnumValN(FENNEL_RESTREAM_I, "fennel-restream-i",
+                   "restreaming fennel, incoming edge cut, using CuSP"),
+        clEnumValN(LDG_RESTREAM_O, "ldg-restream-o",
+                   "restreaming LDG, outgoing edge cut, using CuSP"),
+        clEnumValN(LDG_RESTREAM_I, "ldg-restream-i",
+                   "restreaming LDG, incoming edge cut, using CuSP")),
     cll::init(OEC));
 
 cll::opt<bool> readFromFile("readFromFile",
-                            cll::desc("Set this flag if graph is to be "
-                                      "constructed from file (file must be "
-                                      "created by Abelian CSR)"),
+                            cll::desc("Read each host's partition from "
+                                      "files written by -saveLocalGraph "
+                                      "instead of partitioning the input"),
                             cll::init(false), cll::Hidden);
 
 cll::opt<std::string>
     localGraphFileName("localGraphFileName",
-                       cll::desc("Name of the local file to construct "
-                                 "local graph (file must be created by "
-                                 "Abelian CSR)"),
+                       cll::desc("Prefix of the saved partition files "
+                                 "(one per host, suffixed with the host "
+                                 "id)"),
                        cll::init("local_graph"), cll::Hidden);
 
 cll::opt<bool> saveLocalGraph("saveLocalGraph",
                               cll::desc("Set to save the local CSR graph"),
                               cll::init(false), cll::Hidden);
 
+cll::opt<uint32_t>
+    restreamPasses("restreamPasses",
+                   cll::desc("Passes over the edges made by the restreaming "
+                             "partitioners (default 3)"),
+                   cll::init(3));
+
+cll::opt<double>
+    restreamImbalance("restreamImbalance",
+                      cll::desc("Fraction of node and edge load above a "
+                                "balanced partition that restreaming "
+                                "partitioners allow (default 0.1)"),
+                      cll::init(0.1));
+
 cll::opt<std::string> mastersFile("mastersFile",
                                   cll::desc("File specifying masters blocking"),
                                   cll::init(""), cll::Hidden);
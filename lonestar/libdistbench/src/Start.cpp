@@ -48,12 +48,53 @@ cll::opt<DataCommMode> commMetadata(
                 clEnumValN(bitsetData, "bitset", "Use bitset metadata always"),
                 clEnumValN(offsetsData, "offsets",
                            "Use offsets metadata always"),
+                clEnumValN(compressedOffsetsData, "compressed",
+                           "Use delta-varint compressed offsets always"),
                 clEnumValN(gidsData, "gids", "Use global IDs metadata always"),
                 clEnumValN(onlyData, "none",
                            "Do not use any metadata (sends "
                            "non-updated values)")),
     cll::init(noData), cll::Hidden);
 
+cll::opt<unsigned>
+    syncChunkSize("syncChunkSize",
+                  cll::desc("Shared nodes per sync message; pipelines "
+                            "extraction, transfer and application of large "
+                            "syncs (default 0: one message per host)"),
+                  cll::init(0), cll::Hidden);
+
+cll::opt<std::string> checkpointDir(
+    "checkpointDir",
+    cll::desc("Existing directory (may be host-local) to periodically "
+              "checkpoint node data to in apps that support it "
+              "(default: no checkpoints)"));
+
+cll::opt<double> checkpointMTBF(
+    "checkpointMTBF",
+    cll::desc("Expected seconds between failures; sets the checkpoint "
+              "interval together with the measured checkpoint cost "
+              "(default 86400)"),
+    cll::init(86400));
+
+cll::opt<bool> checkpointRestart(
+    "checkpointRestart",
+    cll::desc("Resume from the last complete checkpoint in -checkpointDir "
+              "(default false)"),
+    cll::init(false));
+
+cll::opt<bool> partitionReport(
+    "partitionReport",
+    cll::desc("After partitioning, report replication factor, balance, "
+              "communication partners and estimated bytes per sync "
+              "(default false)"),
+    cll::init(false));
+
+cll::opt<unsigned> reportValueBytes(
+    "reportValueBytes",
+    cll::desc("Bytes per synchronized value assumed by -partitionReport's "
+              "sync volume estimate (default 4)"),
+    cll::init(4));
+
 cll::opt<std::string> outputLocation(
     "outputLocation",
     cll::desc("Location (directory) to write results to when output is true"));
@@ -116,6 +157,23 @@ void DistBenchStart(int argc, char** argv, const char* app, const char* desc,
   numThreads = galois::setActiveThreads(numThreads);
   galois::runtime::setStatFile(statFile);
 
+#ifdef GALOIS_ENABLE_GPU
+  // GPU batch extraction works on whole shared node lists
+  if (syncChunkSize && personality_set.find('g') != std::string::npos) {
+    GALOIS_DIE("-syncChunkSize is only supported on CPU hosts");
+  }
+  // node data of GPU hosts lives on the device
+  if (!checkpointDir.empty() &&
+      personality_set.find('g') != std::string::npos) {
+    GALOIS_DIE("-checkpointDir is only supported on CPU hosts");
+  }
+  // GPU batch set cannot decode compressed offsets
+  if (commMetadata == compressedOffsetsData &&
+      personality_set.find('g') != std::string::npos) {
+    GALOIS_DIE("-metadata=compressed is only supported on CPU hosts");
+  }
+#endif
+
   auto& net = galois::runtime::getSystemNetworkInterface();
 
   if (net.ID == 0) {
@@ -153,6 +211,16 @@ void DistBenchStart(int argc, char** argv, const char* app, const char* desc,
     galois::runtime::reportParam("DistBench", "Input", inputFile);
     galois::runtime::reportParam("DistBench", "PartitionScheme",
                                  EnumToString(partitionScheme));
+    if (syncChunkSize) {
+      galois::runtime::reportParam("DistBench", "SyncChunkSize",
+                                   syncChunkSize);
+    }
+    if (!checkpointDir.empty()) {
+      galois::runtime::reportParam("DistBench", "CheckpointDir",
+                                   checkpointDir);
+      galois::runtime::reportParam("DistBench", "CheckpointMTBF",
+                                   checkpointMTBF);
+    }
   }
 
   char name[256];
@@ -0,0 +1,438 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_GRAPHCOLORING_H
+#define LONESTAR_GRAPHCOLORING_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * Vertex orders for Jones-Plassmann coloring; earlier nodes are colored
+ * first. Ties are broken by a hash of the node id.
+ */
+enum class ColoringOrder {
+  //! largest degree first
+  LargestDegreeFirst,
+  /**
+   * Smallest-last, approximated in parallel as in ADG (Besta et al., IPDPS
+   * 2020): each peeling round removes every node whose remaining degree is
+   * at most (1 + SL_EPSILON) times the average, so there are O(log n) rounds.
+   * Nodes removed last are colored first.
+   */
+  SmallestLast
+};
+
+/**
+ * Parallel distance-1 coloring of a symmetric graph, with the nodes grouped
+ * into one bucket per color. The nodes of a bucket are pairwise non-adjacent,
+ * so a loop over a single bucket can write its own node's data and read its
+ * neighbors' data without locks, and running the buckets one after another
+ * gives conflict-free phases (Gauss-Seidel sweeps, Louvain moves); see
+ * doAllByColor. Two nodes of a bucket may still share a neighbor, so updates
+ * to neighbor data need atomics or a distance-2 coloring.
+ *
+ * Two algorithms:
+ *  - jonesPlassmann(order): a node is colored once all its neighbors that
+ *    come earlier in the order are, with the smallest color they do not use.
+ *    The coloring depends only on the order, not on the schedule.
+ *  - speculative(): every uncolored node takes the smallest color free among
+ *    its neighbors at that time, all in parallel; adjacent nodes that ended
+ *    up with the same color are found afterwards and the one with the larger
+ *    id is recolored in the next round (Gebremedhin-Manne with the iterative
+ *    conflict repair of Catalyurek et al.).
+ *
+ * Colors are kept here rather than in the node data, and the graph is only
+ * accessed with MethodFlag::UNPROTECTED. Self loops are ignored.
+ */
+template <typename Graph>
+class GraphColoring {
+public:
+  using GNode = typename Graph::GraphNode;
+
+  constexpr static const uint32_t UNCOLORED =
+      std::numeric_limits<uint32_t>::max();
+  constexpr static const double SL_EPSILON = 0.1;
+
+private:
+  constexpr static const unsigned CHUNK_SIZE = 64;
+
+  //! marks[c] == stamp if a neighbor of the node being colored has color c
+  struct ColorMarks {
+    std::vector<uint32_t> marks;
+    uint32_t stamp = 0;
+  };
+
+  Graph& graph;
+  galois::LargeArray<uint32_t> colors;
+  galois::LargeArray<GNode> bucketNodes;
+  std::vector<size_t> bucketStart;
+  galois::substrate::PerThreadStorage<ColorMarks> colorMarks;
+  uint32_t maxDegree = 0;
+  size_t rounds      = 0;
+
+  static uint32_t hashNode(uint64_t n) {
+    n ^= n >> 33;
+    n *= 0xff51afd7ed558ccdULL;
+    n ^= n >> 33;
+    n *= 0xc4ceb9fe1a85ec53ULL;
+    n ^= n >> 33;
+    return uint32_t(n);
+  }
+
+  uint32_t loadColor(GNode n) const {
+    return __atomic_load_n(&colors[n], __ATOMIC_RELAXED);
+  }
+
+  void storeColor(GNode n, uint32_t c) {
+    __atomic_store_n(&colors[n], c, __ATOMIC_RELAXED);
+  }
+
+  uint32_t degree(GNode n) const {
+    return std::distance(graph.edge_begin(n, galois::MethodFlag::UNPROTECTED),
+                         graph.edge_end(n, galois::MethodFlag::UNPROTECTED));
+  }
+
+  //! Smallest color not used by a neighbor of n; at most maxDegree
+  uint32_t smallestFreeColor(GNode n) {
+    ColorMarks& m = *colorMarks.getLocal();
+    if (++m.stamp == 0) {
+      std::fill(m.marks.begin(), m.marks.end(), 0);
+      m.stamp = 1;
+    }
+    for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+      GNode dst = graph.getEdgeDst(e);
+      if (dst == n)
+        continue;
+      uint32_t c = loadColor(dst);
+      if (c < m.marks.size())
+        m.marks[c] = m.stamp;
+    }
+    uint32_t c = 0;
+    while (c < m.marks.size() && m.marks[c] == m.stamp)
+      ++c;
+    return c;
+  }
+
+  //! Peeling round of each node for the smallest-last order
+  void smallestLastPriorities(galois::LargeArray<uint32_t>& prio) {
+    constexpr uint32_t UNSET = std::numeric_limits<uint32_t>::max();
+    galois::LargeArray<std::atomic<uint32_t>> remaining;
+    remaining.allocateInterleaved(graph.size());
+
+    galois::InsertBag<GNode> bags[2];
+    galois::InsertBag<GNode>* active = &bags[0];
+    galois::InsertBag<GNode>* rest   = &bags[1];
+    galois::InsertBag<GNode> peeled;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          uint32_t d = 0;
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            if (graph.getEdgeDst(e) != n)
+              ++d;
+          }
+          remaining[n] = d;
+          prio[n]      = UNSET;
+          active->push(n);
+        },
+        galois::steal(), galois::no_stats(),
+        galois::loopname("SmallestLastInit"));
+
+    for (uint32_t round = 0; !active->empty(); ++round) {
+      galois::GAccumulator<uint64_t> degreeSum;
+      galois::GAccumulator<uint64_t> count;
+      galois::do_all(
+          galois::iterate(*active),
+          [&](GNode n) {
+            degreeSum += remaining[n].load(std::memory_order_relaxed);
+            count += 1;
+          },
+          galois::no_stats(), galois::loopname("SmallestLastAverage"));
+      const double threshold =
+          (1 + SL_EPSILON) * degreeSum.reduce() / count.reduce();
+
+      galois::do_all(
+          galois::iterate(*active),
+          [&](GNode n) {
+            if (remaining[n].load(std::memory_order_relaxed) <= threshold) {
+              prio[n] = round;
+              peeled.push(n);
+            } else {
+              rest->push(n);
+            }
+          },
+          galois::no_stats(), galois::loopname("SmallestLastSplit"));
+
+      galois::do_all(
+          galois::iterate(peeled),
+          [&](GNode n) {
+            for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+              GNode dst = graph.getEdgeDst(e);
+              if (dst != n && prio[dst] == UNSET)
+                remaining[dst].fetch_sub(1, std::memory_order_relaxed);
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::no_stats(), galois::loopname("SmallestLastPeel"));
+
+      peeled.clear();
+      active->clear();
+      std::swap(active, rest);
+    }
+  }
+
+  //! Groups the nodes by color
+  void buildBuckets() {
+    galois::GReduceMax<uint32_t> maxColor;
+    galois::do_all(
+        galois::iterate(graph), [&](GNode n) { maxColor.update(colors[n]); },
+        galois::no_stats(), galois::loopname("ColoringMax"));
+    const uint32_t numColors = graph.size() ? maxColor.reduce() + 1 : 0;
+
+    // per-thread counts over contiguous blocks of nodes, then a scatter in
+    // the same blocks
+    const unsigned numThreads = galois::getActiveThreads();
+    const size_t n            = graph.size();
+    const size_t blockSize    = (n + numThreads - 1) / numThreads;
+    std::vector<size_t> offsets(size_t(numThreads) * numColors, 0);
+
+    galois::on_each([&](unsigned tid, unsigned) {
+      size_t* mine = &offsets[size_t(tid) * numColors];
+      size_t lo    = std::min(tid * blockSize, n);
+      size_t hi    = std::min(lo + blockSize, n);
+      for (size_t i = lo; i < hi; ++i)
+        ++mine[colors[i]];
+    });
+
+    bucketStart.assign(numColors + 1, 0);
+    size_t offset = 0;
+    for (uint32_t c = 0; c < numColors; ++c) {
+      bucketStart[c] = offset;
+      for (unsigned t = 0; t < numThreads; ++t) {
+        size_t count                       = offsets[size_t(t) * numColors + c];
+        offsets[size_t(t) * numColors + c] = offset;
+        offset += count;
+      }
+    }
+    bucketStart[numColors] = offset;
+
+    galois::on_each([&](unsigned tid, unsigned) {
+      size_t* next = &offsets[size_t(tid) * numColors];
+      size_t lo    = std::min(tid * blockSize, n);
+      size_t hi    = std::min(lo + blockSize, n);
+      for (size_t i = lo; i < hi; ++i)
+        bucketNodes[next[colors[i]]++] = i;
+    });
+  }
+
+public:
+  explicit GraphColoring(Graph& g) : graph(g) {
+    colors.allocateInterleaved(graph.size());
+    bucketNodes.allocateInterleaved(graph.size());
+
+    galois::GReduceMax<uint32_t> maxDeg;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          colors[n] = UNCOLORED;
+          maxDeg.update(degree(n));
+        },
+        galois::no_stats(), galois::loopname("ColoringInit"));
+    maxDegree = maxDeg.reduce();
+
+    galois::on_each([&](unsigned, unsigned) {
+      colorMarks.getLocal()->marks.assign(maxDegree + 1, 0);
+    });
+  }
+
+  void jonesPlassmann(ColoringOrder order) {
+    galois::LargeArray<uint32_t> prio;
+    prio.allocateInterleaved(graph.size());
+    if (order == ColoringOrder::SmallestLast) {
+      smallestLastPriorities(prio);
+    } else {
+      galois::do_all(
+          galois::iterate(graph), [&](GNode n) { prio[n] = degree(n); },
+          galois::no_stats(), galois::loopname("LargestDegreeFirstInit"));
+    }
+
+    // strict order: priority, then hash, then id
+    galois::LargeArray<uint64_t> rank;
+    rank.allocateInterleaved(graph.size());
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) { rank[n] = (uint64_t(prio[n]) << 32) | hashNode(n); },
+        galois::no_stats(), galois::loopname("JonesPlassmannRank"));
+    auto before = [&](GNode a, GNode b) {
+      return rank[a] > rank[b] || (rank[a] == rank[b] && a < b);
+    };
+
+    galois::LargeArray<std::atomic<uint32_t>> waiting;
+    waiting.allocateInterleaved(graph.size());
+    galois::InsertBag<GNode> ready;
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          uint32_t w = 0;
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(e);
+            if (dst != n && before(dst, n))
+              ++w;
+          }
+          colors[n]  = UNCOLORED;
+          waiting[n] = w;
+          if (w == 0)
+            ready.push(n);
+        },
+        galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+        galois::loopname("JonesPlassmannInit"));
+
+    using WL = galois::worklists::PerSocketChunkFIFO<CHUNK_SIZE>;
+    galois::for_each(
+        galois::iterate(ready),
+        [&](GNode n, auto& ctx) {
+          storeColor(n, smallestFreeColor(n));
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(e);
+            if (dst != n && before(n, dst) &&
+                waiting[dst].fetch_sub(1, std::memory_order_acq_rel) == 1)
+              ctx.push(dst);
+          }
+        },
+        galois::wl<WL>(), galois::disable_conflict_detection(),
+        galois::loopname("JonesPlassmann"));
+
+    rounds = 1;
+    buildBuckets();
+  }
+
+  void speculative() {
+    galois::InsertBag<GNode> bags[2];
+    galois::InsertBag<GNode>* current = &bags[0];
+    galois::InsertBag<GNode>* next    = &bags[1];
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          colors[n] = UNCOLORED;
+          current->push(n);
+        },
+        galois::no_stats(), galois::loopname("SpeculativeInit"));
+
+    rounds = 0;
+    while (!current->empty()) {
+      ++rounds;
+      galois::do_all(
+          galois::iterate(*current),
+          [&](GNode n) { storeColor(n, smallestFreeColor(n)); },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("SpeculativeColor"));
+
+      // only nodes colored in this round can conflict, and of two such
+      // neighbors the one with the larger id gives up its color
+      galois::do_all(
+          galois::iterate(*current),
+          [&](GNode n) {
+            uint32_t c = loadColor(n);
+            for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+              GNode dst = graph.getEdgeDst(e);
+              if (dst < n && loadColor(dst) == c) {
+                next->push(n);
+                return;
+              }
+            }
+          },
+          galois::steal(), galois::chunk_size<CHUNK_SIZE>(),
+          galois::loopname("SpeculativeConflicts"));
+
+      // losers must not block their old color while the others are recolored
+      galois::do_all(
+          galois::iterate(*next), [&](GNode n) { storeColor(n, UNCOLORED); },
+          galois::no_stats(), galois::loopname("SpeculativeReset"));
+
+      current->clear();
+      std::swap(current, next);
+    }
+    buildBuckets();
+  }
+
+  uint32_t getColor(GNode n) const { return colors[n]; }
+
+  uint32_t numColors() const { return bucketStart.size() - 1; }
+
+  //! Rounds of the speculative algorithm; 1 for Jones-Plassmann
+  size_t getRounds() const { return rounds; }
+
+  //! Nodes of color c; no two of them are adjacent
+  const GNode* bucketBegin(uint32_t c) const {
+    return &bucketNodes[0] + bucketStart[c];
+  }
+  const GNode* bucketEnd(uint32_t c) const {
+    return &bucketNodes[0] + bucketStart[c + 1];
+  }
+  size_t bucketSize(uint32_t c) const {
+    return bucketStart[c + 1] - bucketStart[c];
+  }
+
+  /**
+   * Runs one do_all over each color bucket in color order, passing args to
+   * every loop. Within a loop, fn may write its node's data and read its
+   * neighbors' data without locks: no two nodes of the loop share an edge.
+   * Nodes of the loop may share neighbors, so fn must not write to neighbor
+   * data without atomics.
+   */
+  template <typename Fn, typename... Args>
+  void doAllByColor(const Fn& fn, const Args&... args) const {
+    for (uint32_t c = 0; c < numColors(); ++c) {
+      galois::do_all(galois::iterate(bucketBegin(c), bucketEnd(c)), fn,
+                     args...);
+    }
+  }
+
+  //! Number of edges whose endpoints share a color (0 for a valid coloring)
+  size_t countConflicts() const {
+    galois::GAccumulator<size_t> conflicts;
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode n) {
+          for (auto e : graph.edges(n, galois::MethodFlag::UNPROTECTED)) {
+            GNode dst = graph.getEdgeDst(e);
+            if (dst != n && colors[dst] == colors[n])
+              conflicts += 1;
+          }
+        },
+        galois::steal(), galois::no_stats(),
+        galois::loopname("ColoringConflicts"));
+    return conflicts.reduce();
+  }
+};
+
+#endif
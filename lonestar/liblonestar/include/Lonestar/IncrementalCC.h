@@ -0,0 +1,261 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_INCREMENTALCC_H
+#define LONESTAR_INCREMENTALCC_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/LargeArray.h"
+#include "galois/Reduction.h"
+#include "galois/UnionFind.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Connected components of a symmetric graph that is only ever extended: the
+ * components of the graph are computed once with Afforest, and batches of
+ * new edges are then unioned into the existing union-find forest instead of
+ * recomputing everything.
+ *
+ *  - initialize(): Afforest labeling of the graph (Sutton et al., IPDPS 2018).
+ *  - addEdges(batch): unions the endpoints of every edge of the batch in
+ *    parallel with the lock-free UnionFindNode::merge and returns the
+ *    components that grew.
+ *  - sameComponent(u, v), component(n): queries.
+ *  - compact(): points every node directly at its root so that queries are
+ *    a single indirection again. addEdges compacts by itself once enough
+ *    unions have happened since the last compaction.
+ *
+ * Both Afforest linking and merge hook the root with the larger address
+ * under the one with the smaller one, so the component id of a node is the
+ * smallest node id of its component, independent of the schedule and of how
+ * the edges were batched.
+ *
+ * The node set is fixed at construction; edges of a batch must connect
+ * existing nodes. Queries running concurrently with addEdges may miss
+ * unions of that batch but never report nodes of different components as
+ * connected.
+ */
+template <typename Graph>
+class IncrementalCC {
+public:
+  using GNode = typename Graph::GraphNode;
+  using Edge  = std::pair<GNode, GNode>;
+
+private:
+  struct CCNode : public galois::UnionFindNode<CCNode> {
+    CCNode() : galois::UnionFindNode<CCNode>(this) {}
+
+    //! Afforest link; cheaper than merge as it does not report the union
+    void link(CCNode* b) {
+      CCNode* a = this->m_component.load(std::memory_order_relaxed);
+      b         = b->m_component.load(std::memory_order_relaxed);
+      while (a != b) {
+        if (a < b)
+          std::swap(a, b);
+        CCNode* ac = a->m_component.load(std::memory_order_relaxed);
+        if ((ac == a && a->m_component.compare_exchange_strong(a, b)) ||
+            (b == ac))
+          break;
+        a = (a->m_component.load(std::memory_order_relaxed))
+                ->m_component.load(std::memory_order_relaxed);
+        b = b->m_component.load(std::memory_order_relaxed);
+      }
+    }
+  };
+
+  Graph& graph;
+  galois::LargeArray<CCNode> nodes;
+  //! dedups the roots reported by addEdges
+  galois::LargeArray<uint8_t> reported;
+  size_t components = 0;
+  size_t unionsSinceCompaction = 0;
+  size_t compactionThreshold;
+  size_t compactions = 0;
+
+  GNode id(const CCNode* n) const { return GNode(n - &nodes[0]); }
+
+  const CCNode* root(GNode n) const { return nodes[n].find(); }
+
+  //! Root of the component that most of the sampled nodes belong to
+  const CCNode* sampleLargest(uint32_t samples) const {
+    std::unordered_map<const CCNode*, uint32_t> freq;
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<size_t> dist(0, graph.size() - 1);
+    for (uint32_t i = 0; i < samples; ++i) {
+      ++freq[nodes[dist(rng)].get()];
+    }
+    return std::max_element(freq.begin(), freq.end(),
+                            [](const auto& a, const auto& b) {
+                              return a.second < b.second;
+                            })
+        ->first;
+  }
+
+  void compressAll() {
+    galois::do_all(
+        galois::iterate(size_t{0}, nodes.size()),
+        [&](size_t n) { nodes[n].compress(); }, galois::steal(),
+        galois::loopname("IncCC-Compact"));
+  }
+
+  size_t countRoots() const {
+    galois::GAccumulator<size_t> roots;
+    galois::do_all(
+        galois::iterate(size_t{0}, nodes.size()),
+        [&](size_t n) {
+          if (nodes[n].isRep())
+            roots += 1;
+        },
+        galois::no_stats(), galois::loopname("IncCC-CountRoots"));
+    return roots.reduce();
+  }
+
+public:
+  /**
+   * compactEvery: number of unions by addEdges after which the forest is
+   * compacted (0: a sixteenth of the node count)
+   */
+  explicit IncrementalCC(Graph& g, size_t compactEvery = 0)
+      : graph(g), compactionThreshold(compactEvery) {
+    nodes.allocateInterleaved(graph.size());
+    reported.allocateInterleaved(graph.size());
+    galois::do_all(
+        galois::iterate(size_t{0}, size_t(graph.size())),
+        [&](size_t n) {
+          nodes.constructAt(n);
+          reported[n] = 0;
+        },
+        galois::no_stats(), galois::loopname("IncCC-Init"));
+    components = graph.size();
+    if (!compactionThreshold)
+      compactionThreshold = graph.size() / 16 + 1;
+  }
+
+  /**
+   * Labels the graph passed to the constructor with Afforest: link the first
+   * neighborSamples edges of every node, find the (likely) largest component
+   * from componentSamples random nodes, and link the remaining edges of the
+   * nodes outside of it.
+   */
+  void initialize(uint32_t neighborSamples  = 2,
+                  uint32_t componentSamples = 1024) {
+    for (uint32_t r = 0; r < neighborSamples; ++r) {
+      galois::do_all(
+          galois::iterate(graph),
+          [&](GNode src) {
+            auto ii = graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+            auto ei = graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+            std::advance(ii, r);
+            if (ii < ei)
+              nodes[src].link(&nodes[graph.getEdgeDst(ii)]);
+          },
+          galois::steal(), galois::loopname("IncCC-VNS-Link"));
+      compressAll();
+    }
+
+    const CCNode* largest = sampleLargest(componentSamples);
+
+    galois::do_all(
+        galois::iterate(graph),
+        [&](GNode src) {
+          if (nodes[src].get() == largest)
+            return;
+          auto ii = graph.edge_begin(src, galois::MethodFlag::UNPROTECTED);
+          auto ei = graph.edge_end(src, galois::MethodFlag::UNPROTECTED);
+          for (std::advance(ii, neighborSamples); ii < ei; ++ii) {
+            nodes[src].link(&nodes[graph.getEdgeDst(ii)]);
+          }
+        },
+        galois::steal(), galois::loopname("IncCC-LCS-Link"));
+    compressAll();
+
+    components            = countRoots();
+    unionsSinceCompaction = 0;
+  }
+
+  /**
+   * Unions the endpoints of every edge in batch (any container galois::iterate
+   * accepts, holding Edge). Returns the ids of the components that absorbed
+   * another component, sorted; the ids of the absorbed components are no
+   * longer in use.
+   */
+  template <typename Batch>
+  std::vector<GNode> addEdges(const Batch& batch) {
+    galois::InsertBag<GNode> merged;
+    galois::GAccumulator<size_t> unions;
+
+    galois::do_all(
+        galois::iterate(batch),
+        [&](const Edge& e) {
+          if (nodes[e.first].merge(&nodes[e.second])) {
+            merged.push(e.first);
+            unions += 1;
+          }
+        },
+        galois::steal(), galois::loopname("IncCC-AddEdges"));
+
+    galois::InsertBag<GNode> changed;
+    galois::do_all(
+        galois::iterate(merged),
+        [&](GNode n) {
+          GNode r = id(root(n));
+          if (!reported[r] && !__sync_lock_test_and_set(&reported[r], 1))
+            changed.push(r);
+        },
+        galois::no_stats(), galois::loopname("IncCC-Changed"));
+
+    std::vector<GNode> result(changed.begin(), changed.end());
+    for (GNode r : result) {
+      reported[r] = 0;
+    }
+    std::sort(result.begin(), result.end());
+
+    components -= unions.reduce();
+    unionsSinceCompaction += unions.reduce();
+    if (unionsSinceCompaction >= compactionThreshold)
+      compact();
+    return result;
+  }
+
+  //! Points every node directly at its root. Not safe during addEdges.
+  void compact() {
+    compressAll();
+    unionsSinceCompaction = 0;
+    ++compactions;
+  }
+
+  //! Id of n's component: the smallest node id in it
+  GNode component(GNode n) const { return id(root(n)); }
+
+  bool sameComponent(GNode u, GNode v) const { return root(u) == root(v); }
+
+  size_t numComponents() const { return components; }
+
+  //! Compactions by compact() and addEdges; initialize() does not count
+  size_t numCompactions() const { return compactions; }
+};
+
+#endif
@@ -0,0 +1,296 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef LONESTAR_MULTISOURCEBFS_H
+#define LONESTAR_MULTISOURCEBFS_H
+
+#include "galois/Galois.h"
+#include "galois/Bag.h"
+#include "galois/LargeArray.h"
+#include "galois/substrate/PerThreadStorage.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+
+/**
+ * Number of sources a MultiSourceBFS runs at once by default: one lane per
+ * bit of a 256-bit vector register if the build targets AVX2, so that the
+ * per-node mask operations are a single vector instruction each, and one
+ * 64-bit word otherwise.
+ */
+#if defined(__AVX2__)
+constexpr unsigned MSBFS_DEFAULT_WIDTH = 256;
+#else
+constexpr unsigned MSBFS_DEFAULT_WIDTH = 64;
+#endif
+
+/**
+ * Fixed-width set of BFS sources (lanes), one bit each.
+ */
+template <unsigned WIDTH>
+struct SourceMask {
+  static_assert(WIDTH % 64 == 0, "width must be a multiple of 64");
+  constexpr static const unsigned WORDS = WIDTH / 64;
+
+  uint64_t words[WORDS];
+
+  bool any() const {
+    uint64_t r = 0;
+    for (unsigned i = 0; i < WORDS; ++i)
+      r |= words[i];
+    return r != 0;
+  }
+
+  void clear() { std::fill(words, words + WORDS, 0); }
+
+  void set(unsigned lane) { words[lane / 64] |= uint64_t{1} << (lane % 64); }
+
+  bool test(unsigned lane) const {
+    return (words[lane / 64] >> (lane % 64)) & 1;
+  }
+
+  //! this & ~other
+  SourceMask andNot(const SourceMask& other) const {
+    SourceMask r;
+    for (unsigned i = 0; i < WORDS; ++i)
+      r.words[i] = words[i] & ~other.words[i];
+    return r;
+  }
+
+  SourceMask operator&(const SourceMask& other) const {
+    SourceMask r;
+    for (unsigned i = 0; i < WORDS; ++i)
+      r.words[i] = words[i] & other.words[i];
+    return r;
+  }
+
+  SourceMask& operator|=(const SourceMask& other) {
+    for (unsigned i = 0; i < WORDS; ++i)
+      words[i] |= other.words[i];
+    return *this;
+  }
+
+  //! Thread-safe |=; skips words that would not change
+  void atomicOr(const SourceMask& other) {
+    for (unsigned i = 0; i < WORDS; ++i)
+      if (other.words[i] & ~__atomic_load_n(&words[i], __ATOMIC_RELAXED))
+        __atomic_fetch_or(&words[i], other.words[i], __ATOMIC_RELAXED);
+  }
+
+  //! Calls fn(lane) for each set lane in increasing order
+  template <typename Fn>
+  void forEach(Fn fn) const {
+    for (unsigned i = 0; i < WORDS; ++i)
+      for (uint64_t w = words[i]; w; w &= w - 1)
+        fn(i * 64 + __builtin_ctzll(w));
+  }
+};
+
+/**
+ * Level-synchronous BFS from up to WIDTH sources at once (MS-BFS). Each node
+ * keeps one bit per source for "seen" and "reached in the next level", so a
+ * node reached by many sources in the same level is expanded once, and its
+ * edges are traversed once per level for the whole batch.
+ *
+ * Clients hook into the traversal instead of subclassing:
+ *  - onEdge(u, v, lanes) is called for every edge u->v of the current level
+ *    with the lanes for which v is first reached through u. It runs in
+ *    parallel and may be called for the same v from several u; use it for
+ *    per-source path counts.
+ *  - onVisit(v, level, lanes) is called once per node and level with the
+ *    lanes that reached v at that level (distance level from those sources).
+ *
+ * The visited (node, lanes) pairs of every level are kept until the next
+ * run(), for backward passes such as Brandes dependency accumulation.
+ * Traversal follows out-edges only, so distances are directed.
+ */
+template <typename Graph, unsigned WIDTH = MSBFS_DEFAULT_WIDTH>
+class MultiSourceBFS {
+public:
+  using GNode = typename Graph::GraphNode;
+  using Mask  = SourceMask<WIDTH>;
+  constexpr static const unsigned width = WIDTH;
+
+  struct Visit {
+    GNode node;
+    Mask lanes;
+  };
+  using Level = galois::InsertBag<Visit>;
+
+private:
+  Graph& graph;
+  galois::LargeArray<Mask> seen;
+  galois::LargeArray<Mask> next;
+  galois::LargeArray<uint8_t> queued;
+  std::deque<Level> levelBags;
+  unsigned numSources = 0;
+
+public:
+  explicit MultiSourceBFS(Graph& g) : graph(g) {
+    seen.allocateInterleaved(graph.size());
+    next.allocateInterleaved(graph.size());
+    queued.allocateInterleaved(graph.size());
+    galois::do_all(
+        galois::iterate(size_t{0}, size_t(graph.size())),
+        [&](size_t n) {
+          seen[n].clear();
+          next[n].clear();
+          queued[n] = 0;
+        },
+        galois::no_stats(), galois::loopname("MSBFSInit"));
+  }
+
+  /**
+   * Runs one batch. Lane i is sources[i]; at most WIDTH sources. Duplicate
+   * sources share the traversal but keep separate lanes.
+   */
+  template <typename EdgeFn, typename VisitFn>
+  void run(const GNode* sources, unsigned num, EdgeFn&& onEdge,
+           VisitFn&& onVisit) {
+    GALOIS_ASSERT(num <= WIDTH, "too many sources for one batch");
+    reset();
+    numSources = num;
+
+    // level 0: the sources themselves
+    levelBags.emplace_back();
+    std::vector<GNode> first;
+    for (unsigned i = 0; i < num; ++i) {
+      if (!queued[sources[i]]) {
+        queued[sources[i]] = 1;
+        first.push_back(sources[i]);
+      }
+      seen[sources[i]].set(i);
+    }
+    for (GNode n : first) {
+      queued[n] = 0;
+      levelBags[0].push(Visit{n, seen[n]});
+      onVisit(n, 0u, seen[n]);
+    }
+
+    galois::InsertBag<GNode> reached;
+    for (uint32_t level = 0; !levelBags[level].empty(); ++level) {
+      // expand: lanes of u not yet seen at v move on to v
+      galois::do_all(
+          galois::iterate(levelBags[level]),
+          [&](const Visit& x) {
+            for (auto e :
+                 graph.edges(x.node, galois::MethodFlag::UNPROTECTED)) {
+              GNode v    = graph.getEdgeDst(e);
+              Mask lanes = x.lanes.andNot(seen[v]);
+              if (!lanes.any())
+                continue;
+              onEdge(x.node, v, lanes);
+              next[v].atomicOr(lanes);
+              if (!queued[v] && !__sync_lock_test_and_set(&queued[v], 1))
+                reached.push(v);
+            }
+          },
+          galois::steal(), galois::chunk_size<64>(), galois::no_stats(),
+          galois::loopname("MSBFSExpand"));
+
+      // commit: the lanes that reached v become part of v's seen set
+      levelBags.emplace_back();
+      Level& nextBag = levelBags[level + 1];
+      galois::do_all(
+          galois::iterate(reached),
+          [&](GNode v) {
+            Mask lanes = next[v];
+            seen[v] |= lanes;
+            next[v].clear();
+            queued[v] = 0;
+            nextBag.push(Visit{v, lanes});
+            onVisit(v, level + 1, lanes);
+          },
+          galois::no_stats(), galois::loopname("MSBFSCommit"));
+      reached.clear();
+    }
+    // the last level is always empty
+    levelBags.pop_back();
+  }
+
+  //! Runs one batch without hooks; results are available through levels()
+  void run(const GNode* sources, unsigned num) {
+    run(sources, num, [](GNode, GNode, const Mask&) {},
+        [](GNode, uint32_t, const Mask&) {});
+  }
+
+  //! Levels of the last run; levels()[d] holds the nodes at distance d
+  const std::deque<Level>& levels() const { return levelBags; }
+  std::deque<Level>& levels() { return levelBags; }
+
+  //! Largest distance from any source of the last run to a node it reached
+  uint32_t depth() const {
+    return levelBags.empty() ? 0 : levelBags.size() - 1;
+  }
+
+  /**
+   * Per-source distance statistics of the last run: the sum of distances to
+   * reached nodes (farness; closeness is (reached - 1) / farness), the number
+   * of reached nodes including the source, and the eccentricity (a lower
+   * bound on the diameter). Arrays must hold at least as many entries as
+   * there were sources.
+   */
+  void distanceStats(uint64_t* farness, uint64_t* reached, uint32_t* ecc) {
+    struct Partial {
+      std::array<uint64_t, WIDTH> farness{};
+      std::array<uint64_t, WIDTH> reached{};
+      std::array<uint32_t, WIDTH> ecc{};
+    };
+    galois::substrate::PerThreadStorage<Partial> partials;
+    for (uint32_t level = 0; level < levelBags.size(); ++level) {
+      galois::do_all(
+          galois::iterate(levelBags[level]),
+          [&](const Visit& x) {
+            Partial& p = *partials.getLocal();
+            x.lanes.forEach([&](unsigned s) {
+              p.farness[s] += level;
+              p.reached[s] += 1;
+              p.ecc[s] = level;
+            });
+          },
+          galois::no_stats(), galois::loopname("MSBFSStats"));
+    }
+    for (unsigned s = 0; s < numSources; ++s) {
+      farness[s] = reached[s] = ecc[s] = 0;
+    }
+    for (unsigned t = 0; t < partials.size(); ++t) {
+      Partial& p = *partials.getRemote(t);
+      for (unsigned s = 0; s < numSources; ++s) {
+        farness[s] += p.farness[s];
+        reached[s] += p.reached[s];
+        ecc[s] = std::max(ecc[s], p.ecc[s]);
+      }
+    }
+  }
+
+private:
+  //! Clears the seen sets touched by the previous run
+  void reset() {
+    for (Level& l : levelBags) {
+      galois::do_all(
+          galois::iterate(l), [&](const Visit& x) { seen[x.node].clear(); },
+          galois::no_stats(), galois::loopname("MSBFSReset"));
+    }
+    levelBags.clear();
+  }
+};
+
+#endif
@@ -4,6 +4,7 @@
 #include <random>
 #include <vector>
 #include <algorithm>
+#include <cmath>
 
 //! Used to pick random non-zero degree starting points for search algorithms
 //! This code has been copied from GAP benchmark suite
@@ -55,3 +56,42 @@ bool isApproximateDegreeDistributionPowerLaw(const Graph& graph) {
   double sample_median  = samples[num_samples / 2];
   return sample_average / 1.25 > sample_median;
 }
+
+//! Picks the bucket width (as a power-of-2 shift) for delta-stepping style
+//! shortest path algorithms by sampling the graph. Meyer and Sanders show
+//! delta ~ maxWeight / degree works well for random weights; the sample uses
+//! a high percentile of the weights and the expected degree of a node at the
+//! end of an edge (E[d^2] / E[d]), so that skewed degree distributions get
+//! narrow buckets and sparse, heavy-weight graphs such as road networks get
+//! wide ones.
+template <typename Graph>
+uint32_t chooseDeltaShift(Graph& graph) {
+  constexpr uint32_t EDGES_PER_SAMPLE = 16;
+  if (graph.sizeEdges() == 0)
+    return 0;
+  SourcePicker<Graph> sp(graph);
+  uint32_t num_samples = 1000;
+  if (num_samples > graph.size())
+    num_samples = graph.size();
+  double degree_sum    = 0;
+  double degree_sq_sum = 0;
+  std::vector<uint64_t> weights;
+  for (uint32_t trial = 0; trial < num_samples; trial++) {
+    typename Graph::GraphNode node = sp.PickNext();
+    double degree                  = graph.getDegree(node);
+    degree_sum += degree;
+    degree_sq_sum += degree * degree;
+    // spread the sampled edges over the whole edge list of the node
+    auto beg    = graph.edge_begin(node, galois::MethodFlag::UNPROTECTED);
+    auto end    = graph.edge_end(node, galois::MethodFlag::UNPROTECTED);
+    auto stride = std::max<ptrdiff_t>(1, (end - beg) / EDGES_PER_SAMPLE);
+    for (auto e = beg; e < end; e += stride) {
+      weights.push_back(graph.getEdgeData(e));
+    }
+  }
+  auto high = weights.begin() + weights.size() * 9 / 10;
+  std::nth_element(weights.begin(), high, weights.end());
+  double edge_end_degree = degree_sq_sum / degree_sum;
+  double delta = 2.0 * std::max<uint64_t>(1, *high) / edge_end_degree;
+  return std::lround(std::clamp(std::log2(delta), 0.0, 30.0));
+}